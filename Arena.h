@@ -0,0 +1,95 @@
+#pragma once
+
+#include <Core/Math.h>
+#include <Core/Simd.h>
+
+#include <cstddef>
+#include <memory_resource>
+#include <vector>
+
+/// \brief A bump allocator for scratch data that hands out memory from large blocks and releases all of it
+/// at once with Reset. Deallocating does nothing, so memory that is given back before Reset stays in use.
+///
+/// Every allocation is aligned to at least simd::Alignment so that the memory can be used by the batch
+/// kernels without straddling cache lines, the same as Pool. Both can be passed to Vector2fBuffer or to any
+/// of the std::pmr containers and neither of them is thread safe, each thread is meant to have its own.
+class Arena final : public std::pmr::memory_resource
+{
+public:
+	/// \brief The size of the blocks that are allocated when the arena runs out of memory.
+	static constexpr size_t s_DefaultBlockSize = 1024 * 1024;
+
+	/// \brief Construct an arena that doesn't allocate any memory until it is first used.
+	explicit Arena(const size_t blockSize = s_DefaultBlockSize) noexcept;
+	Arena(const Arena& rhs) = delete;
+	~Arena() override;
+
+	Arena& operator=(const Arena& rhs) = delete;
+
+	/// \brief Returns the number of bytes that have been allocated since the last reset, including padding.
+	size_t GetUsed() const noexcept { return m_Used; }
+	/// \brief Returns the number of bytes that are held by the blocks of the arena.
+	size_t GetCapacity() const noexcept { return m_Capacity; }
+
+	/// \brief Makes all of the memory available again without releasing it. If the allocations needed more
+	/// than one block then they are replaced by a single block that is large enough for all of them, so a
+	/// frame that allocates the same as the previous one doesn't touch the heap at all.
+	void Reset();
+	/// \brief Releases all of the memory back to the heap.
+	void Release() noexcept;
+
+private:
+	struct Block
+	{
+		std::byte* data;
+		size_t size;
+	};
+
+	void* do_allocate(size_t bytes, size_t alignment) override;
+	void do_deallocate(void* pointer, size_t bytes, size_t alignment) override;
+	bool do_is_equal(const std::pmr::memory_resource& rhs) const noexcept override { return this == &rhs; }
+
+private:
+	std::vector<Block> m_Blocks = {};
+	size_t m_BlockSize = s_DefaultBlockSize;
+	size_t m_Block = 0;
+	size_t m_Offset = 0;
+	size_t m_Used = 0;
+	size_t m_Capacity = 0;
+};
+
+/// \brief A cache of allocations with power of 2 sizes, so that memory which is given back is reused by the
+/// next allocation of the same size class instead of returning to the heap. Every allocation is aligned to
+/// at least simd::Alignment, those larger than s_MaxSize or with a larger alignment bypass the cache.
+class Pool final : public std::pmr::memory_resource
+{
+public:
+	/// \brief The size of the smallest size class.
+	static constexpr size_t s_MinSize = simd::Alignment;
+	/// \brief The size of the largest size class.
+	static constexpr size_t s_MaxSize = 64 * 1024 * 1024;
+
+	/// \brief Construct an empty pool.
+	Pool() noexcept = default;
+	Pool(const Pool& rhs) = delete;
+	~Pool() override;
+
+	Pool& operator=(const Pool& rhs) = delete;
+
+	/// \brief Returns the number of bytes that are cached and not in use.
+	size_t GetCached() const noexcept { return m_Cached; }
+
+	/// \brief Releases all of the cached memory back to the heap, memory that is in use isn't affected.
+	void Release() noexcept;
+
+private:
+	static constexpr int32 s_ClassCount = 21;
+
+	void* do_allocate(size_t bytes, size_t alignment) override;
+	void do_deallocate(void* pointer, size_t bytes, size_t alignment) override;
+	bool do_is_equal(const std::pmr::memory_resource& rhs) const noexcept override { return this == &rhs; }
+
+private:
+	std::vector<void*> m_Free[s_ClassCount] = {};
+	size_t m_Cached = 0;
+};
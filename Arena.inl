@@ -0,0 +1,145 @@
+#pragma once
+
+#include <Core/Math.h>
+#include <Core/Simd.h>
+
+#include <bit>
+#include <cstdint>
+#include <new>
+
+namespace math::detail
+{
+	inline size_t AlignUp(const size_t value, const size_t alignment) noexcept
+	{
+		return (value + alignment - 1) & ~(alignment - 1);
+	}
+
+	inline std::byte* AllocateAligned(const size_t bytes, const size_t alignment)
+	{
+		return static_cast<std::byte*>(::operator new[](bytes, std::align_val_t(math::Max(alignment, static_cast<size_t>(simd::Alignment)))));
+	}
+
+	inline void DeallocateAligned(void* pointer, const size_t alignment) noexcept
+	{
+		::operator delete[](pointer, std::align_val_t(math::Max(alignment, static_cast<size_t>(simd::Alignment))));
+	}
+
+	// the size classes are Pool::s_MinSize << index
+	inline int32 GetPoolClass(const size_t bytes) noexcept
+	{
+		const size_t size = math::Max(bytes, Pool::s_MinSize);
+		return static_cast<int32>(std::bit_width(size - 1)) - std::countr_zero(Pool::s_MinSize);
+	}
+}
+
+inline Arena::Arena(const size_t blockSize) noexcept
+	: m_BlockSize(blockSize)
+{
+}
+
+inline Arena::~Arena()
+{
+	Release();
+}
+
+inline void Arena::Reset()
+{
+	if (m_Blocks.size() > 1)
+	{
+		const size_t capacity = m_Capacity;
+		Release();
+		m_Blocks.push_back({ math::detail::AllocateAligned(capacity, simd::Alignment), capacity });
+		m_Capacity = capacity;
+	}
+	m_Block = 0;
+	m_Offset = 0;
+	m_Used = 0;
+}
+
+inline void Arena::Release() noexcept
+{
+	for (const Block& block : m_Blocks)
+		math::detail::DeallocateAligned(block.data, simd::Alignment);
+	m_Blocks.clear();
+	m_Block = 0;
+	m_Offset = 0;
+	m_Used = 0;
+	m_Capacity = 0;
+}
+
+inline void* Arena::do_allocate(const size_t bytes, size_t alignment)
+{
+	using namespace math::detail;
+	alignment = math::Max(alignment, static_cast<size_t>(simd::Alignment));
+
+	// the blocks that are kept by Reset are tried in order before a new one is allocated
+	for (; m_Block < m_Blocks.size(); ++m_Block, m_Offset = 0)
+	{
+		const Block& block = m_Blocks[m_Block];
+		const uintptr_t start = reinterpret_cast<uintptr_t>(block.data);
+		const size_t offset = AlignUp(start + m_Offset, alignment) - start;
+		if (offset + bytes <= block.size)
+		{
+			m_Used += offset + bytes - m_Offset;
+			m_Offset = offset + bytes;
+			return block.data + offset;
+		}
+	}
+
+	// blocks are aligned to simd::Alignment so a larger alignment needs room to move the start forward
+	const size_t size = math::Max(m_BlockSize, AlignUp(bytes + alignment - simd::Alignment, simd::Alignment));
+	m_Blocks.push_back({ AllocateAligned(size, simd::Alignment), size });
+	m_Block = m_Blocks.size() - 1;
+	m_Offset = 0;
+	m_Capacity += size;
+	return do_allocate(bytes, alignment);
+}
+
+inline void Arena::do_deallocate(void* /*pointer*/, const size_t /*bytes*/, const size_t /*alignment*/)
+{
+}
+
+inline Pool::~Pool()
+{
+	Release();
+}
+
+inline void Pool::Release() noexcept
+{
+	for (int32 i = 0; i < s_ClassCount; ++i)
+	{
+		for (void* pointer : m_Free[i])
+			math::detail::DeallocateAligned(pointer, simd::Alignment);
+		m_Free[i].clear();
+	}
+	m_Cached = 0;
+}
+
+inline void* Pool::do_allocate(const size_t bytes, const size_t alignment)
+{
+	if (bytes > s_MaxSize || alignment > simd::Alignment)
+		return math::detail::AllocateAligned(bytes, alignment);
+
+	const int32 index = math::detail::GetPoolClass(bytes);
+	std::vector<void*>& free = m_Free[index];
+	if (free.empty())
+		return math::detail::AllocateAligned(s_MinSize << index, simd::Alignment);
+
+	void* pointer = free.back();
+	free.pop_back();
+	m_Cached -= s_MinSize << index;
+	return pointer;
+}
+
+inline void Pool::do_deallocate(void* pointer, const size_t bytes, const size_t alignment)
+{
+	if (bytes > s_MaxSize || alignment > simd::Alignment)
+	{
+		math::detail::DeallocateAligned(pointer, alignment);
+		return;
+	}
+
+	const int32 index = math::detail::GetPoolClass(bytes);
+	m_Free[index].push_back(pointer);
+	m_Cached += s_MinSize << index;
+}
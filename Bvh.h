@@ -0,0 +1,127 @@
+#pragma once
+
+#include <Core/Geometry.h>
+#include <Core/Math.h>
+#include <Core/Parallel.h>
+#include <Core/Vector.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+/// \brief A node of a Bvh2f with up to 4 children whose bounds are stored as separate lanes so that
+/// all of them are tested at once in a single register.
+///
+/// A child that is >= 0 is the index of another node while a negative child is ~index of a box from the
+/// span that the hierarchy was built from, in which case its bounds are exactly that box. The children
+/// are packed at the start so only the first count of them are used.
+struct alignas(16) Bvh2fNode
+{
+	float minX[4];
+	float minY[4];
+	float maxX[4];
+	float maxY[4];
+	int32 children[4];
+	int32 count;
+};
+
+/// \brief Read only access to the nodes of a bounding volume hierarchy that doesn't own them, so that it
+/// can point at the nodes of a Bvh2f or directly into the bytes of a file that has been memory-mapped.
+class Bvh2fView
+{
+public:
+	/// \brief Construct an empty view.
+	constexpr Bvh2fView() noexcept = default;
+	/// \brief Construct a view of nodes that was built from count boxes.
+	constexpr explicit Bvh2fView(std::span<const Bvh2fNode> nodes, const int32 count) noexcept : m_Nodes(nodes), m_Count(count) {}
+
+	/// \brief Creates a view of the bytes written by Bvh2f::Serialize without copying the nodes. It returns
+	/// false if the header doesn't match, the bytes are too short or they aren't aligned to 16 bytes.
+	/// It also returns false if the nodes don't form a tree that is safe to traverse, where each child is
+	/// either a later node or a box that is less than the count, so that a corrupt file can't be queried.
+	static bool Deserialize(std::span<const std::byte> bytes, Bvh2fView& view);
+
+	/// \brief Returns the nodes where the first one is the root.
+	std::span<const Bvh2fNode> GetNodes() const noexcept { return m_Nodes; }
+	/// \brief Returns the number of boxes that the hierarchy was built from.
+	int32 GetCount() const noexcept { return m_Count; }
+	/// \brief Returns true if the hierarchy doesn't contain any boxes.
+	bool IsEmpty() const noexcept { return m_Nodes.empty(); }
+
+	/// \brief Appends the index of every box that overlaps or touches box to results.
+	void QueryBox(const AABB2f& box, std::vector<int32>& results) const;
+	/// \brief Appends the index of every box that overlaps or touches circle to results.
+	void QueryCircle(const Circle2f& circle, std::vector<int32>& results) const;
+	/// \brief Returns true if the ray hits a box within maxDistance and sets index and distance to the closest one,
+	/// the distance is 0 if the origin is inside of the box.
+	bool Raycast(const Ray2f& ray, const float maxDistance, int32& index, float& distance) const noexcept;
+
+private:
+	template<typename Test, typename Function>
+	void Traverse(Test&& test, Function&& function) const;
+
+private:
+	std::span<const Bvh2fNode> m_Nodes = {};
+	int32 m_Count = 0;
+};
+
+/// \brief A bounding volume hierarchy over static boxes that is stored as a flat array of 4 wide nodes.
+///
+/// It is built top-down by splitting the boxes in two along the axis with the largest spread of centers,
+/// picking the split between 16 bins that has the lowest surface area heuristic (the perimeter in 2d), and
+/// then splitting each half again to get the 4 children of a node. The parallel build splits the top of the
+/// hierarchy on the calling thread until each part has at most grainSize boxes and then builds the parts
+/// concurrently, the result is the same hierarchy as the single threaded build with the nodes in a different order.
+class Bvh2f
+{
+public:
+	/// \brief Replaces the contents of the hierarchy with the boxes.
+	void Build(std::span<const AABB2f> boxes);
+	/// \brief Replaces the contents of the hierarchy with the boxes and builds it across threads.
+	void Build(const parallel::Policy& policy, std::span<const AABB2f> boxes);
+	/// \brief Removes all boxes from the hierarchy without releasing its memory.
+	void Clear() noexcept { m_Nodes.clear(); m_Count = 0; }
+
+	/// \brief Returns a view of the nodes which is invalidated when the hierarchy is modified.
+	Bvh2fView GetView() const noexcept { return Bvh2fView(m_Nodes, m_Count); }
+	/// \brief Returns the number of boxes that the hierarchy was built from.
+	int32 GetCount() const noexcept { return m_Count; }
+	/// \brief Returns true if the hierarchy doesn't contain any boxes.
+	bool IsEmpty() const noexcept { return m_Nodes.empty(); }
+
+	/// \brief Replaces bytes with a header followed by the nodes, so that it can be written to a file and
+	/// later used in place with Bvh2fView::Deserialize. It uses the byte order of the machine.
+	void Serialize(std::vector<std::byte>& bytes) const;
+
+	/// \brief Appends the index of every box that overlaps or touches box to results.
+	void QueryBox(const AABB2f& box, std::vector<int32>& results) const { GetView().QueryBox(box, results); }
+	/// \brief Appends the index of every box that overlaps or touches circle to results.
+	void QueryCircle(const Circle2f& circle, std::vector<int32>& results) const { GetView().QueryCircle(circle, results); }
+	/// \brief Returns true if the ray hits a box within maxDistance and sets index and distance to the closest one.
+	bool Raycast(const Ray2f& ray, const float maxDistance, int32& index, float& distance) const noexcept { return GetView().Raycast(ray, maxDistance, index, distance); }
+
+private:
+	struct Primitive
+	{
+		AABB2f box;
+		Vector2f center;
+		int32 index;
+	};
+
+	struct Task
+	{
+		int32 node;
+		int32 slot;
+		int32 begin;
+		int32 end;
+		int32 depth;
+	};
+
+	static int32 Split(std::span<Primitive> primitives, const int32 depth);
+	static void BuildNode(std::vector<Bvh2fNode>& nodes, std::span<Primitive> primitives, const int32 node, const int32 first, const int32 depth, std::vector<Task>* tasks, const int32 grainSize);
+
+private:
+	std::vector<Bvh2fNode> m_Nodes;
+	int32 m_Count = 0;
+};
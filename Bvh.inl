@@ -0,0 +1,466 @@
+#pragma once
+
+#include <Core/Math.h>
+#include <Core/Parallel.h>
+#include <Core/Simd.h>
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+namespace math::detail
+{
+	constexpr uint32_t s_BvhMagic = 0x32485642; // "BVH2"
+	constexpr uint32_t s_BvhVersion = 1;
+	constexpr int32 s_BvhBins = 16;
+	// below this depth the boxes are split at the median which bounds the depth and the traversal stack
+	constexpr int32 s_BvhMaxSahDepth = 32;
+	constexpr int32 s_BvhStackSize = 256;
+	// each level of the traversal pops one node and pushes at most 4 so this depth can't overflow the stack
+	constexpr int32 s_BvhMaxDepth = (s_BvhStackSize - 4) / 3;
+
+	struct BvhHeader
+	{
+		uint32_t magic;
+		uint32_t version;
+		int32 nodeCount;
+		int32 count;
+	};
+
+	static_assert(std::is_trivially_copyable_v<Bvh2fNode>);
+	static_assert(sizeof(BvhHeader) % alignof(Bvh2fNode) == 0, "The nodes must be aligned after the header.");
+
+	inline AABB2f Merge(const AABB2f& a, const AABB2f& b) noexcept
+	{
+		return AABB2f(math::Min<Vector2f>(a.min, b.min), math::Max<Vector2f>(a.max, b.max));
+	}
+
+	inline float Perimeter(const AABB2f& box) noexcept
+	{
+		const Vector2f size = box.GetSize();
+		return (size.x + size.y) * 2.f;
+	}
+
+	inline constexpr AABB2f s_EmptyBox = AABB2f(Vector2f(std::numeric_limits<float>::max()), Vector2f(-std::numeric_limits<float>::max()));
+}
+
+inline bool Bvh2fView::Deserialize(std::span<const std::byte> bytes, Bvh2fView& view)
+{
+	using namespace math::detail;
+	if (bytes.size() < sizeof(BvhHeader))
+		return false;
+
+	BvhHeader header;
+	std::memcpy(&header, bytes.data(), sizeof(BvhHeader));
+	if (header.magic != s_BvhMagic || header.version != s_BvhVersion || header.nodeCount < 0 || header.count < 0)
+		return false;
+	if (bytes.size() < sizeof(BvhHeader) + static_cast<size_t>(header.nodeCount) * sizeof(Bvh2fNode))
+		return false;
+
+	const std::byte* data = bytes.data() + sizeof(BvhHeader);
+	if (reinterpret_cast<uintptr_t>(data) % alignof(Bvh2fNode) != 0)
+		return false;
+
+	// every node except the root must be the child of exactly one node that comes before it, which rules out
+	// cycles and shared nodes, and every box must be in range so that the traversal never reads out of bounds
+	const std::span nodes(reinterpret_cast<const Bvh2fNode*>(data), header.nodeCount);
+	std::vector<int32> depths(nodes.size(), -1);
+	if (!nodes.empty())
+		depths[0] = 0;
+	for (int32 i = 0; i < header.nodeCount; ++i)
+	{
+		const Bvh2fNode& node = nodes[i];
+		if (node.count < 0 || node.count > 4 || depths[i] < 0)
+			return false;
+
+		for (int32 slot = 0; slot < node.count; ++slot)
+		{
+			const int32 child = node.children[slot];
+			if (child >= 0)
+			{
+				if (child <= i || child >= header.nodeCount || depths[child] >= 0 || depths[i] + 1 > s_BvhMaxDepth)
+					return false;
+				depths[child] = depths[i] + 1;
+			}
+			else if (~child >= header.count)
+			{
+				return false;
+			}
+		}
+	}
+
+	view = Bvh2fView(nodes, header.count);
+	return true;
+}
+
+inline void Bvh2fView::QueryBox(const AABB2f& box, std::vector<int32>& results) const
+{
+	using simd::float4;
+	const float4 minX = simd::Splat<float4>(box.min.x);
+	const float4 minY = simd::Splat<float4>(box.min.y);
+	const float4 maxX = simd::Splat<float4>(box.max.x);
+	const float4 maxY = simd::Splat<float4>(box.max.y);
+	Traverse([&](const Bvh2fNode& node)
+	{
+		return simd::BitMask(simd::And(
+			simd::And(simd::CmpLe(minX, simd::Load<float4>(node.maxX)), simd::CmpLe(simd::Load<float4>(node.minX), maxX)),
+			simd::And(simd::CmpLe(minY, simd::Load<float4>(node.maxY)), simd::CmpLe(simd::Load<float4>(node.minY), maxY))));
+	},
+	[&](const int32 index)
+	{
+		results.push_back(index);
+	});
+}
+
+inline void Bvh2fView::QueryCircle(const Circle2f& circle, std::vector<int32>& results) const
+{
+	using simd::float4;
+	const float4 x = simd::Splat<float4>(circle.center.x);
+	const float4 y = simd::Splat<float4>(circle.center.y);
+	const float4 radiusSqr = simd::Splat<float4>(circle.radius * circle.radius);
+	Traverse([&](const Bvh2fNode& node)
+	{
+		// the distance from the center to the closest point of each box
+		const float4 dx = simd::Sub(simd::Min(simd::Max(x, simd::Load<float4>(node.minX)), simd::Load<float4>(node.maxX)), x);
+		const float4 dy = simd::Sub(simd::Min(simd::Max(y, simd::Load<float4>(node.minY)), simd::Load<float4>(node.maxY)), y);
+		return simd::BitMask(simd::CmpLe(simd::Add(simd::Mul(dx, dx), simd::Mul(dy, dy)), radiusSqr));
+	},
+	[&](const int32 index)
+	{
+		results.push_back(index);
+	});
+}
+
+inline bool Bvh2fView::Raycast(const Ray2f& ray, const float maxDistance, int32& index, float& distance) const noexcept
+{
+	using simd::float4;
+	if (m_Nodes.empty())
+		return false;
+
+	// the same reciprocal as math::Raycast so that a zero direction doesn't produce NaNs
+	const auto reciprocal = [](const float value) { return (value != 0.f) ? 1.f / value : std::numeric_limits<float>::max(); };
+	const float4 originX = simd::Splat<float4>(ray.origin.x);
+	const float4 originY = simd::Splat<float4>(ray.origin.y);
+	const float4 inverseX = simd::Splat<float4>(reciprocal(ray.direction.x));
+	const float4 inverseY = simd::Splat<float4>(reciprocal(ray.direction.y));
+
+	struct Entry
+	{
+		int32 node;
+		float distance;
+	};
+
+	Entry stack[math::detail::s_BvhStackSize];
+	int32 size = 0;
+	stack[size++] = Entry{ 0, 0.f };
+
+	float closest = maxDistance;
+	int32 hit = -1;
+	while (size > 0)
+	{
+		const Entry entry = stack[--size];
+		if (entry.distance > closest)
+			continue;
+
+		const Bvh2fNode& node = m_Nodes[entry.node];
+		const float4 x1 = simd::Mul(simd::Sub(simd::Load<float4>(node.minX), originX), inverseX);
+		const float4 x2 = simd::Mul(simd::Sub(simd::Load<float4>(node.maxX), originX), inverseX);
+		const float4 y1 = simd::Mul(simd::Sub(simd::Load<float4>(node.minY), originY), inverseY);
+		const float4 y2 = simd::Mul(simd::Sub(simd::Load<float4>(node.maxY), originY), inverseY);
+		const float4 enter = simd::Max(simd::Max(simd::Min(x1, x2), simd::Min(y1, y2)), simd::Splat<float4>(0.f));
+		const float4 exit = simd::Min(simd::Min(simd::Max(x1, x2), simd::Max(y1, y2)), simd::Splat<float4>(closest));
+
+		alignas(16) float distances[4];
+		simd::StoreAligned(distances, enter);
+		uint32_t mask = simd::BitMask(simd::CmpLe(enter, exit)) & ((1u << node.count) - 1);
+
+		// the children are sorted onto the stack furthest first so that the closest one is visited next and shrinks the ray
+		Entry children[4];
+		int32 count = 0;
+		while (mask != 0)
+		{
+			const int32 slot = std::countr_zero(mask);
+			mask &= mask - 1;
+
+			const int32 child = node.children[slot];
+			if (child >= 0)
+			{
+				children[count++] = Entry{ child, distances[slot] };
+			}
+			else if (hit < 0 || distances[slot] < closest)
+			{
+				closest = distances[slot];
+				hit = ~child;
+			}
+		}
+
+		const int32 base = size;
+		for (int32 i = 0; i < count; ++i)
+		{
+			int32 j = size++;
+			for (; j > base && stack[j - 1].distance < children[i].distance; --j)
+				stack[j] = stack[j - 1];
+			stack[j] = children[i];
+		}
+	}
+
+	if (hit < 0)
+		return false;
+
+	index = hit;
+	distance = closest;
+	return true;
+}
+
+template<typename Test, typename Function>
+inline void Bvh2fView::Traverse(Test&& test, Function&& function) const
+{
+	if (m_Nodes.empty())
+		return;
+
+	int32 stack[math::detail::s_BvhStackSize];
+	int32 size = 0;
+	stack[size++] = 0;
+	while (size > 0)
+	{
+		const Bvh2fNode& node = m_Nodes[stack[--size]];
+		uint32_t mask = test(node) & ((1u << node.count) - 1);
+		while (mask != 0)
+		{
+			const int32 slot = std::countr_zero(mask);
+			mask &= mask - 1;
+
+			const int32 child = node.children[slot];
+			if (child >= 0)
+			{
+				stack[size++] = child;
+			}
+			else
+			{
+				function(~child);
+			}
+		}
+	}
+}
+
+inline void Bvh2f::Build(std::span<const AABB2f> boxes)
+{
+	m_Nodes.clear();
+	m_Count = static_cast<int32>(boxes.size());
+	if (boxes.empty())
+		return;
+
+	std::vector<Primitive> primitives(boxes.size());
+	for (int32 i = 0; i < m_Count; ++i)
+		primitives[i] = Primitive{ boxes[i], boxes[i].GetCenter(), i };
+
+	m_Nodes.emplace_back();
+	BuildNode(m_Nodes, primitives, 0, 0, 0, nullptr, 0);
+}
+
+inline void Bvh2f::Build(const parallel::Policy& policy, std::span<const AABB2f> boxes)
+{
+	m_Nodes.clear();
+	m_Count = static_cast<int32>(boxes.size());
+	if (boxes.empty())
+		return;
+
+	std::vector<Primitive> primitives(boxes.size());
+	for (int32 i = 0; i < m_Count; ++i)
+		primitives[i] = Primitive{ boxes[i], boxes[i].GetCenter(), i };
+
+	// the top of the hierarchy is built here and the parts that are small enough are deferred as tasks
+	std::vector<Task> tasks;
+	m_Nodes.emplace_back();
+	BuildNode(m_Nodes, primitives, 0, 0, 0, &tasks, math::Max(policy.grainSize, 2));
+
+	std::vector<std::vector<Bvh2fNode>> parts(tasks.size());
+	parallel::ForEach(static_cast<int32>(tasks.size()), [&](const int32 i)
+	{
+		const Task& task = tasks[i];
+		parts[i].emplace_back();
+		BuildNode(parts[i], std::span(primitives).subspan(task.begin, task.end - task.begin), 0, task.begin, task.depth, nullptr, 0);
+	});
+
+	// each part is appended and its nodes are offset to where it ends up
+	for (int32 i = 0; i < static_cast<int32>(tasks.size()); ++i)
+	{
+		const int32 offset = static_cast<int32>(m_Nodes.size());
+		m_Nodes[tasks[i].node].children[tasks[i].slot] = offset;
+		for (Bvh2fNode node : parts[i])
+		{
+			for (int32 slot = 0; slot < node.count; ++slot)
+			{
+				if (node.children[slot] >= 0)
+					node.children[slot] += offset;
+			}
+			m_Nodes.push_back(node);
+		}
+	}
+}
+
+inline void Bvh2f::Serialize(std::vector<std::byte>& bytes) const
+{
+	using namespace math::detail;
+	const BvhHeader header = { s_BvhMagic, s_BvhVersion, static_cast<int32>(m_Nodes.size()), m_Count };
+	bytes.resize(sizeof(BvhHeader) + m_Nodes.size() * sizeof(Bvh2fNode));
+	std::memcpy(bytes.data(), &header, sizeof(BvhHeader));
+	if (!m_Nodes.empty())
+		std::memcpy(bytes.data() + sizeof(BvhHeader), m_Nodes.data(), m_Nodes.size() * sizeof(Bvh2fNode));
+}
+
+inline int32 Bvh2f::Split(std::span<Primitive> primitives, const int32 depth)
+{
+	using namespace math::detail;
+	const int32 count = static_cast<int32>(primitives.size());
+
+	AABB2f centers(primitives[0].center, primitives[0].center);
+	for (const Primitive& primitive : primitives)
+		centers = Merge(centers, AABB2f(primitive.center, primitive.center));
+
+	const Vector2f extents = centers.GetSize();
+	const int32 axis = (extents.y > extents.x) ? 1 : 0;
+	const auto get = [axis](const Vector2f& value) { return (axis == 0) ? value.x : value.y; };
+
+	const auto median = [&]()
+	{
+		const auto compare = [&](const Primitive& a, const Primitive& b) { return get(a.center) < get(b.center); };
+		std::nth_element(primitives.begin(), primitives.begin() + count / 2, primitives.end(), compare);
+		return count / 2;
+	};
+
+	const float length = get(extents);
+	if (depth >= s_BvhMaxSahDepth || !(length > 0.f))
+		return median();
+
+	struct Bin
+	{
+		AABB2f box = s_EmptyBox;
+		int32 count = 0;
+	};
+
+	const float origin = get(centers.min);
+	const float scale = s_BvhBins / length;
+	const auto toBin = [&](const Primitive& primitive)
+	{
+		return math::Min(static_cast<int32>((get(primitive.center) - origin) * scale), s_BvhBins - 1);
+	};
+
+	Bin bins[s_BvhBins];
+	for (const Primitive& primitive : primitives)
+	{
+		Bin& bin = bins[toBin(primitive)];
+		bin.box = Merge(bin.box, primitive.box);
+		bin.count++;
+	}
+
+	// the cost of the right side of each split is accumulated from the end, then the left side from the start
+	float rightCosts[s_BvhBins];
+	Bin right;
+	for (int32 i = s_BvhBins - 1; i > 0; --i)
+	{
+		right.box = Merge(right.box, bins[i].box);
+		right.count += bins[i].count;
+		rightCosts[i - 1] = (right.count > 0) ? Perimeter(right.box) * static_cast<float>(right.count) : 0.f;
+	}
+
+	Bin left;
+	int32 best = -1;
+	float bestCost = std::numeric_limits<float>::max();
+	for (int32 i = 0; i < s_BvhBins - 1; ++i)
+	{
+		left.box = Merge(left.box, bins[i].box);
+		left.count += bins[i].count;
+		if (left.count == 0 || left.count == count)
+			continue;
+
+		const float cost = Perimeter(left.box) * static_cast<float>(left.count) + rightCosts[i];
+		if (cost < bestCost)
+		{
+			bestCost = cost;
+			best = i;
+		}
+	}
+
+	if (best < 0)
+		return median();
+
+	const auto middle = std::partition(primitives.begin(), primitives.end(), [&](const Primitive& primitive) { return toBin(primitive) <= best; });
+	return static_cast<int32>(middle - primitives.begin());
+}
+
+inline void Bvh2f::BuildNode(std::vector<Bvh2fNode>& nodes, std::span<Primitive> primitives, const int32 node, const int32 first, const int32 depth, std::vector<Task>* tasks, const int32 grainSize)
+{
+	// the boxes are split in two and then each half is split again to get up to 4 groups
+	int32 ranges[4][2];
+	int32 groups = 0;
+	const int32 count = static_cast<int32>(primitives.size());
+	if (count <= 4)
+	{
+		for (int32 i = 0; i < count; ++i)
+		{
+			ranges[groups][0] = i;
+			ranges[groups][1] = i + 1;
+			groups++;
+		}
+	}
+	else
+	{
+		const int32 middle = Split(primitives, depth);
+		const int32 halves[2][2] = { { 0, middle }, { middle, count } };
+		for (const auto& half : halves)
+		{
+			if (half[1] - half[0] > 1)
+			{
+				const int32 split = half[0] + Split(primitives.subspan(half[0], half[1] - half[0]), depth);
+				ranges[groups][0] = half[0];
+				ranges[groups][1] = split;
+				groups++;
+				ranges[groups][0] = split;
+				ranges[groups][1] = half[1];
+				groups++;
+			}
+			else
+			{
+				ranges[groups][0] = half[0];
+				ranges[groups][1] = half[1];
+				groups++;
+			}
+		}
+	}
+
+	nodes[node].count = groups;
+	for (int32 slot = 0; slot < groups; ++slot)
+	{
+		const std::span<Primitive> group = primitives.subspan(ranges[slot][0], ranges[slot][1] - ranges[slot][0]);
+
+		AABB2f box = group[0].box;
+		for (const Primitive& primitive : group)
+			box = math::detail::Merge(box, primitive.box);
+
+		// the node is looked up again each time because the recursion can reallocate the nodes
+		nodes[node].minX[slot] = box.min.x;
+		nodes[node].minY[slot] = box.min.y;
+		nodes[node].maxX[slot] = box.max.x;
+		nodes[node].maxY[slot] = box.max.y;
+
+		if (group.size() == 1)
+		{
+			nodes[node].children[slot] = ~group[0].index;
+		}
+		else if (tasks && static_cast<int32>(group.size()) <= grainSize)
+		{
+			nodes[node].children[slot] = 0;
+			tasks->push_back(Task{ node, slot, first + ranges[slot][0], first + ranges[slot][1], depth + 1 });
+		}
+		else
+		{
+			const int32 child = static_cast<int32>(nodes.size());
+			nodes.emplace_back();
+			nodes[node].children[slot] = child;
+			BuildNode(nodes, group, child, first + ranges[slot][0], depth + 1, tasks, grainSize);
+		}
+	}
+}
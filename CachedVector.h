@@ -0,0 +1,119 @@
+#pragma once
+
+#include <Core/Math.h>
+#include <Core/Vector.h>
+#include <Core/VectorStream.h>
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+/// \brief A Vector2f that remembers its length and normal until it is changed, so that calling Length,
+/// Normalized and Limited many times on a vector that didn't change only computes the square root once.
+///
+/// The cache is filled the first time that one of them is called after a change, every assignment and
+/// compound operator marks it as dirty. The results are identical to the same calls on a Vector2f.
+class CachedVector2f
+{
+public:
+	/// \brief Construct a new vector with both members initialized to zero.
+	constexpr CachedVector2f() noexcept = default;
+	/// \brief Construct a new vector with the members of value.
+	constexpr explicit CachedVector2f(const Vector2f& value) noexcept : m_Value(value) {}
+	/// \brief Construct a new vector with members initialized to values x and y.
+	constexpr explicit CachedVector2f(const float x, const float y) noexcept : m_Value(x, y) {}
+
+	/// \brief Replaces the vector with value.
+	constexpr CachedVector2f& operator=(const Vector2f& value) noexcept { m_Value = value; m_Dirty = true; return *this; }
+
+	/// \brief Returns the vector so that it can be used anywhere a Vector2f is expected.
+	constexpr operator const Vector2f&() const noexcept { return m_Value; }
+	/// \brief Returns the vector.
+	constexpr const Vector2f& GetValue() const noexcept { return m_Value; }
+
+	/// \brief Adds the two vectors component-wise, stores the result in this vector and returns a reference.
+	constexpr CachedVector2f& operator+=(const Vector2f& rhs) noexcept { m_Value += rhs; m_Dirty = true; return *this; }
+	/// \brief Subtracts the two vectors component-wise, stores the result in this vector and returns a reference.
+	constexpr CachedVector2f& operator-=(const Vector2f& rhs) noexcept { m_Value -= rhs; m_Dirty = true; return *this; }
+	/// \brief Multiplies the vector by a value, stores the result in this vector and returns a reference.
+	constexpr CachedVector2f& operator*=(const float rhs) noexcept { m_Value *= rhs; m_Dirty = true; return *this; }
+	/// \brief Divides the vector by a value, stores the result in this vector and returns a reference.
+	constexpr CachedVector2f& operator/=(const float rhs) noexcept { m_Value /= rhs; m_Dirty = true; return *this; }
+
+	/// \brief Returns true if the vector changed since the cache was last filled.
+	constexpr bool IsDirty() const noexcept { return m_Dirty; }
+
+	/// \brief Returns the length of this vector.
+	float Length() const noexcept;
+	/// \brief Returns the squared length of this vector, which doesn't need the cache.
+	constexpr float LengthSqr() const noexcept { return m_Value.LengthSqr(); }
+
+	/// \brief Returns a vector whose length doesn't exceed value.
+	/// If the length of the vector is 0 and value is less than it returns a NaN vector.
+	[[nodiscard]] Vector2f Limited(const float value) const noexcept;
+	/// \brief Returns a normalized vector with a length of 1 unit.
+	/// If the length of the vector is 0 then it returns a zero vector.
+	[[nodiscard]] Vector2f Normalized() const noexcept;
+
+private:
+	void Refresh() const noexcept;
+
+private:
+	Vector2f m_Value = {};
+	mutable Vector2f m_Normal = {};
+	mutable float m_Length = 0.f;
+	mutable bool m_Dirty = true;
+};
+
+/// \brief A Vector2fStream of vectors with the lengths and normals that were computed for them, where only
+/// the vectors that changed since the last Update are computed again.
+///
+/// Each vector has a dirty bit that is set when it is changed. Update recomputes the vectors in blocks of the
+/// widest register, skipping the blocks without a dirty bit, and then clears the bits. The lengths and
+/// normals are those of the last Update and they match the same calls on a Vector2f unless a fused
+/// multiply-add changes a rounding.
+class CachedVector2fStream
+{
+public:
+	/// \brief Construct an empty stream.
+	CachedVector2fStream() noexcept = default;
+	/// \brief Construct a stream that is a copy of the values, which are all dirty.
+	explicit CachedVector2fStream(std::span<const Vector2f> values);
+
+	/// \brief Returns the vector at index.
+	Vector2f operator[](const int32 index) const noexcept { return m_Values[index]; }
+
+	/// \brief Returns the number of vectors in the stream.
+	int32 GetCount() const noexcept { return m_Values.GetCount(); }
+	/// \brief Returns the vectors.
+	const Vector2fStream& GetValues() const noexcept { return m_Values; }
+
+	/// \brief Replaces the vector at index, which becomes dirty unless it is identical.
+	void Set(const int32 index, const Vector2f& value) noexcept;
+	/// \brief Appends a vector to the end of the stream, which is dirty.
+	void Append(const Vector2f& value);
+	/// \brief Replaces the contents of the stream with the values, which are all dirty.
+	void Assign(std::span<const Vector2f> values);
+	/// \brief Removes all vectors without releasing the memory.
+	void Clear() noexcept;
+
+	/// \brief Returns true if the vector at index changed since the last Update.
+	bool IsDirty(const int32 index) const noexcept { return (m_Dirty[index >> 6] >> (index & 63)) & 1; }
+	/// \brief Recomputes the length and normal of the dirty vectors and clears the dirty bits.
+	void Update() noexcept;
+
+	/// \brief Returns the length of the vector at index as of the last Update.
+	float GetLength(const int32 index) const noexcept { return m_Lengths[index]; }
+	/// \brief Returns the normal of the vector at index as of the last Update.
+	Vector2f GetNormal(const int32 index) const noexcept { return m_Normals[index]; }
+	/// \brief Returns the length of every vector as of the last Update.
+	std::span<const float> GetLengths() const noexcept { return m_Lengths; }
+	/// \brief Returns the normal of every vector as of the last Update.
+	const Vector2fStream& GetNormals() const noexcept { return m_Normals; }
+
+private:
+	Vector2fStream m_Values;
+	Vector2fStream m_Normals;
+	std::vector<float> m_Lengths;
+	std::vector<uint64_t> m_Dirty;
+};
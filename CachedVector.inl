@@ -0,0 +1,109 @@
+#pragma once
+
+#include <Core/Math.h>
+#include <Core/Simd.h>
+
+#include <algorithm>
+
+namespace math::detail
+{
+	// the same epsilon as Vector2f::Normalize so that the normals are identical
+	constexpr float s_CachedEpsilon = 0.0000001f;
+}
+
+inline float CachedVector2f::Length() const noexcept
+{
+	if (m_Dirty)
+		Refresh();
+	return m_Length;
+}
+
+inline Vector2f CachedVector2f::Limited(const float value) const noexcept
+{
+	// assumes that value >= 0.f
+	const float length = Length();
+	return (length > value) ? m_Value * (value / length) : m_Value;
+}
+
+inline Vector2f CachedVector2f::Normalized() const noexcept
+{
+	if (m_Dirty)
+		Refresh();
+	return m_Normal;
+}
+
+inline void CachedVector2f::Refresh() const noexcept
+{
+	m_Length = m_Value.Length();
+	m_Normal = (m_Length > math::detail::s_CachedEpsilon) ? m_Value * (1.f / m_Length) : Vector2f::Zero;
+	m_Dirty = false;
+}
+
+inline CachedVector2fStream::CachedVector2fStream(std::span<const Vector2f> values)
+{
+	Assign(values);
+}
+
+inline void CachedVector2fStream::Set(const int32 index, const Vector2f& value) noexcept
+{
+	if (m_Values[index] == value)
+		return;
+	m_Values.Set(index, value);
+	m_Dirty[index >> 6] |= uint64_t(1) << (index & 63);
+}
+
+inline void CachedVector2fStream::Append(const Vector2f& value)
+{
+	const int32 index = GetCount();
+	if ((index & 63) == 0)
+		m_Dirty.push_back(0);
+	m_Values.Append(value);
+	m_Normals.Append(Vector2f::Zero);
+	m_Lengths.push_back(0.f);
+	m_Dirty[index >> 6] |= uint64_t(1) << (index & 63);
+}
+
+inline void CachedVector2fStream::Assign(std::span<const Vector2f> values)
+{
+	const int32 count = static_cast<int32>(values.size());
+	m_Values.Assign(values);
+	m_Normals.Resize(count);
+	m_Lengths.assign(count, 0.f);
+	m_Dirty.assign((count + 63) / 64, ~uint64_t(0));
+}
+
+inline void CachedVector2fStream::Clear() noexcept
+{
+	m_Values.Clear();
+	m_Normals.Clear();
+	m_Lengths.clear();
+	m_Dirty.clear();
+}
+
+inline void CachedVector2fStream::Update() noexcept
+{
+	// the blocks are aligned to the width of the register so their bits never cross a word, and the clean
+	// vectors in a dirty block are recomputed to the values that they already had
+	const float* inputX = m_Values.GetX();
+	const float* inputY = m_Values.GetY();
+	float* outputX = m_Normals.GetX();
+	float* outputY = m_Normals.GetY();
+	float* lengths = m_Lengths.data();
+	const uint64_t* dirty = m_Dirty.data();
+	simd::ForEach(GetCount(), [&]<typename Float>(const int32 i)
+	{
+		constexpr int32 width = sizeof(Float) / sizeof(float);
+		if (((dirty[i >> 6] >> (i & 63)) & ((uint64_t(1) << width) - 1)) == 0)
+			return;
+
+		const Float x = simd::Load<Float>(inputX + i);
+		const Float y = simd::Load<Float>(inputY + i);
+		const Float length = simd::Sqrt(simd::MulAdd(x, x, simd::Mul(y, y)));
+		const Float valid = simd::CmpGt(length, simd::Splat<Float>(math::detail::s_CachedEpsilon));
+		const Float reciprocal = simd::Div(simd::Splat<Float>(1.f), length);
+		simd::Store(lengths + i, length);
+		simd::Store(outputX + i, simd::And(valid, simd::Mul(x, reciprocal)));
+		simd::Store(outputY + i, simd::And(valid, simd::Mul(y, reciprocal)));
+	});
+	std::fill(m_Dirty.begin(), m_Dirty.end(), uint64_t(0));
+}
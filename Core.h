@@ -0,0 +1,71 @@
+#pragma once
+
+/// \brief Includes every header of the library followed by every inline definition, which is the order that
+/// the definitions need, so that it can be used as the one header of a precompiled header.
+///
+/// Including the headers one at a time also works as long as each .inl is included after all of the
+/// headers it depends on, this header is only a shortcut for the translation units that use most of them.
+/// MappedFile.h is left out because it includes the headers of the operating system.
+
+#include <Core/Math.h>
+#include <Core/Simd.h>
+#include <Core/Matrix.h>
+#include <Core/Quaternion.h>
+#include <Core/Vector.h>
+#include <Core/VectorDouble.h>
+#include <Core/VectorAligned.h>
+#include <Core/VectorStream.h>
+#include <Core/VectorWide.h>
+#include <Core/Trigonometry.h>
+#include <Core/SpatialHash.h>
+#include <Core/VectorBatch.h>
+#include <Core/Parallel.h>
+#include <Core/Dispatch.h>
+#include <Core/VectorPacked.h>
+#include <Core/VectorN.h>
+#include <Core/Geometry.h>
+#include <Core/Bvh.h>
+#include <Core/Interpolation.h>
+#include <Core/Random.h>
+#include <Core/VectorFile.h>
+#include <Core/Arena.h>
+#include <Core/VectorBuffer.h>
+#include <Core/Instrument.h>
+#include <Core/Polygon.h>
+#include <Core/VectorExpression.h>
+#include <Core/Direction.h>
+#include <Core/Rebase.h>
+#include <Core/SpatialOrder.h>
+#include <Core/Reduction.h>
+#include <Core/CachedVector.h>
+
+#include <Core/Math.inl>
+#include <Core/Vector.inl>
+#include <Core/VectorDouble.inl>
+#include <Core/VectorAligned.inl>
+#include <Core/VectorStream.inl>
+#include <Core/VectorWide.inl>
+#include <Core/Matrix.inl>
+#include <Core/Quaternion.inl>
+#include <Core/Trigonometry.inl>
+#include <Core/SpatialHash.inl>
+#include <Core/VectorBatch.inl>
+#include <Core/Parallel.inl>
+#include <Core/Dispatch.inl>
+#include <Core/VectorPacked.inl>
+#include <Core/VectorN.inl>
+#include <Core/Geometry.inl>
+#include <Core/Bvh.inl>
+#include <Core/Interpolation.inl>
+#include <Core/Random.inl>
+#include <Core/VectorFile.inl>
+#include <Core/Arena.inl>
+#include <Core/VectorBuffer.inl>
+#include <Core/Instrument.inl>
+#include <Core/Polygon.inl>
+#include <Core/VectorExpression.inl>
+#include <Core/Direction.inl>
+#include <Core/Rebase.inl>
+#include <Core/SpatialOrder.inl>
+#include <Core/Reduction.inl>
+#include <Core/CachedVector.inl>
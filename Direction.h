@@ -0,0 +1,60 @@
+#pragma once
+
+#include <Core/Math.h>
+#include <Core/Vector.h>
+#include <Core/VectorPacked.h>
+
+#include <concepts>
+#include <cstdint>
+#include <span>
+
+/// \brief Compact encodings of unit directions.
+///
+/// A 2d direction is encoded as its angle in a uint8_t or uint16_t, where the whole circle is split into
+/// equal steps starting from the positive x axis. The error is at most half of a step, which is 0.71 degrees
+/// for uint8_t and 0.0028 degrees for uint16_t.
+///
+/// A 3d direction is projected onto an octahedron which is unfolded onto a square, the two coordinates of the
+/// square are then stored as a Vector2i8 or a Vector2i16. The steps aren't equal across the sphere, the error
+/// is at most 0.96 degrees for Vector2i8 and 0.0038 degrees for Vector2i16.
+///
+/// The directions don't need to be normalized before they are encoded, the decoded directions are
+/// normalized. A zero vector is encoded the same as the positive x axis for 2d and the positive z axis for 3d.
+/// The batch versions process the directions in the widest registers and the input and output spans must have
+/// the same size, the results match the single versions unless a fused multiply-add changes a rounding.
+namespace math
+{
+	/// \brief Encodes the angle of a 2d direction.
+	template<typename Type> requires std::same_as<Type, uint8_t> || std::same_as<Type, uint16_t>
+	inline Type EncodeDirection(const Vector2f& direction) noexcept;
+	/// \brief Encodes the angle of each 2d direction.
+	inline void EncodeDirection(std::span<const Vector2f> directions, std::span<uint8_t> results) noexcept;
+	/// \brief Encodes the angle of each 2d direction.
+	inline void EncodeDirection(std::span<const Vector2f> directions, std::span<uint16_t> results) noexcept;
+
+	/// \brief Decodes an angle back to a 2d direction with a length of 1 unit.
+	inline Vector2f DecodeDirection(const uint8_t value) noexcept;
+	/// \brief Decodes an angle back to a 2d direction with a length of 1 unit.
+	inline Vector2f DecodeDirection(const uint16_t value) noexcept;
+	/// \brief Decodes each angle back to a 2d direction with a length of 1 unit.
+	inline void DecodeDirection(std::span<const uint8_t> values, std::span<Vector2f> results) noexcept;
+	/// \brief Decodes each angle back to a 2d direction with a length of 1 unit.
+	inline void DecodeDirection(std::span<const uint16_t> values, std::span<Vector2f> results) noexcept;
+
+	/// \brief Encodes a 3d direction onto the unfolded octahedron.
+	template<typename Type> requires std::same_as<Type, Vector2i8> || std::same_as<Type, Vector2i16>
+	inline Type EncodeDirection(const Vector3f& direction) noexcept;
+	/// \brief Encodes each 3d direction onto the unfolded octahedron.
+	inline void EncodeDirection(std::span<const Vector3f> directions, std::span<Vector2i8> results) noexcept;
+	/// \brief Encodes each 3d direction onto the unfolded octahedron.
+	inline void EncodeDirection(std::span<const Vector3f> directions, std::span<Vector2i16> results) noexcept;
+
+	/// \brief Decodes a point on the unfolded octahedron back to a 3d direction with a length of 1 unit.
+	inline Vector3f DecodeDirection(const Vector2i8& value) noexcept;
+	/// \brief Decodes a point on the unfolded octahedron back to a 3d direction with a length of 1 unit.
+	inline Vector3f DecodeDirection(const Vector2i16& value) noexcept;
+	/// \brief Decodes each point on the unfolded octahedron back to a 3d direction with a length of 1 unit.
+	inline void DecodeDirection(std::span<const Vector2i8> values, std::span<Vector3f> results) noexcept;
+	/// \brief Decodes each point on the unfolded octahedron back to a 3d direction with a length of 1 unit.
+	inline void DecodeDirection(std::span<const Vector2i16> values, std::span<Vector3f> results) noexcept;
+}
@@ -0,0 +1,297 @@
+#pragma once
+
+#include <Core/Math.h>
+#include <Core/Simd.h>
+#include <Core/Trigonometry.h>
+
+namespace math::detail
+{
+	// the number of directions that are converted at a time on the stack
+	constexpr int32 s_DirectionChunk = 256;
+	constexpr float s_DirectionScale8 = 127.f;
+	constexpr float s_DirectionScale16 = 32767.f;
+
+	template<typename Float>
+	inline Float Abs(const Float value) noexcept
+	{
+		return simd::Max(value, simd::Neg(value));
+	}
+
+	// returns magnitude with the sign bit of sign, magnitude must not be negative
+	template<typename Float>
+	inline Float CopySign(const Float magnitude, const Float sign) noexcept
+	{
+		return simd::Xor(magnitude, simd::And(sign, simd::Splat<Float>(-0.f)));
+	}
+
+	template<typename Float>
+	inline Float DirectionAngle(const Float x, const Float y) noexcept
+	{
+		// the ratio of the smaller to the larger component is in [0, 1] and is reduced to [-tan(PI/8), tan(PI/8)]
+		// around PI/4 for the polynomial, which is then unfolded to the octant, half and side of the circle
+		const Float absX = Abs(x);
+		const Float absY = Abs(y);
+		const Float larger = simd::Max(absX, absY);
+		const Float ratio = simd::Select(simd::CmpGt(larger, simd::Splat<Float>(0.f)), simd::Div(simd::Min(absX, absY), larger), simd::Splat<Float>(0.f));
+
+		const Float reduce = simd::CmpGt(ratio, simd::Splat<Float>(0.4142135623730950f));
+		const Float t = simd::Select(reduce, simd::Div(simd::Sub(ratio, simd::Splat<Float>(1.f)), simd::Add(ratio, simd::Splat<Float>(1.f))), ratio);
+		const Float t2 = simd::Mul(t, t);
+		Float p = simd::MulAdd(t2, simd::Splat<Float>(8.05374449538e-2f), simd::Splat<Float>(-1.38776856032e-1f));
+		p = simd::MulAdd(p, t2, simd::Splat<Float>(1.99777106478e-1f));
+		p = simd::MulAdd(p, t2, simd::Splat<Float>(-3.33329491539e-1f));
+		Float angle = simd::MulAdd(simd::Mul(p, t2), t, t);
+		angle = simd::Add(angle, simd::And(reduce, simd::Splat<Float>(PI_HALF * 0.5f)));
+
+		angle = simd::Select(simd::CmpGt(absY, absX), simd::Sub(simd::Splat<Float>(PI_HALF), angle), angle);
+		angle = simd::Select(simd::CmpLt(x, simd::Splat<Float>(0.f)), simd::Sub(simd::Splat<Float>(PI_ONE), angle), angle);
+		return CopySign(angle, y);
+	}
+
+	// the codes are signed so that both halves of the circle are symmetric, which wraps around the same as unsigned
+	template<int32 Bits, typename Float>
+	inline Float EncodeAngle(const Float x, const Float y) noexcept
+	{
+		constexpr float steps = static_cast<float>(1 << Bits);
+		const Float code = simd::Round(simd::Mul(DirectionAngle(x, y), simd::Splat<Float>(steps / PI_TWO)));
+		return simd::Select(simd::CmpGe(code, simd::Splat<Float>(steps * 0.5f)), simd::Sub(code, simd::Splat<Float>(steps)), code);
+	}
+
+	template<int32 Bits, typename Float>
+	inline void DecodeAngle(const Float code, Float& x, Float& y) noexcept
+	{
+		constexpr float steps = static_cast<float>(1 << Bits);
+		math::SinCos(simd::Mul(code, simd::Splat<Float>(PI_TWO / steps)), y, x);
+	}
+
+	template<typename Float>
+	inline void EncodeOctahedral(const Float x, const Float y, const Float z, const float scale, Float& u, Float& v) noexcept
+	{
+		// the direction is projected onto the octahedron |x| + |y| + |z| = 1 and the lower half is folded outwards
+		const Float length = simd::Add(simd::Add(Abs(x), Abs(y)), Abs(z));
+		const Float inverse = simd::Select(simd::CmpGt(length, simd::Splat<Float>(0.f)), simd::Div(simd::Splat<Float>(1.f), length), simd::Splat<Float>(0.f));
+		Float px = simd::Mul(x, inverse);
+		Float py = simd::Mul(y, inverse);
+
+		const Float lower = simd::CmpLt(z, simd::Splat<Float>(0.f));
+		const Float fx = CopySign(simd::Sub(simd::Splat<Float>(1.f), Abs(py)), px);
+		const Float fy = CopySign(simd::Sub(simd::Splat<Float>(1.f), Abs(px)), py);
+		px = simd::Select(lower, fx, px);
+		py = simd::Select(lower, fy, py);
+
+		const Float one = simd::Splat<Float>(1.f);
+		u = simd::Round(simd::Mul(simd::Min(simd::Max(px, simd::Neg(one)), one), simd::Splat<Float>(scale)));
+		v = simd::Round(simd::Mul(simd::Min(simd::Max(py, simd::Neg(one)), one), simd::Splat<Float>(scale)));
+	}
+
+	template<typename Float>
+	inline void DecodeOctahedral(const Float u, const Float v, const float scale, Float& x, Float& y, Float& z) noexcept
+	{
+		const Float px = simd::Div(u, simd::Splat<Float>(scale));
+		const Float py = simd::Div(v, simd::Splat<Float>(scale));
+		z = simd::Sub(simd::Sub(simd::Splat<Float>(1.f), Abs(px)), Abs(py));
+
+		const Float lower = simd::CmpLt(z, simd::Splat<Float>(0.f));
+		x = simd::Select(lower, CopySign(simd::Sub(simd::Splat<Float>(1.f), Abs(py)), px), px);
+		y = simd::Select(lower, CopySign(simd::Sub(simd::Splat<Float>(1.f), Abs(px)), py), py);
+
+		const Float inverse = simd::Div(simd::Splat<Float>(1.f), simd::Sqrt(simd::MulAdd(x, x, simd::MulAdd(y, y, simd::Mul(z, z)))));
+		x = simd::Mul(x, inverse);
+		y = simd::Mul(y, inverse);
+		z = simd::Mul(z, inverse);
+	}
+
+	// the codes are converted through a float buffer because there are only loads and stores for int16
+	inline void LoadCodes(const int8_t* values, const int32 count, float* codes) noexcept
+	{
+		for (int32 i = 0; i < count; ++i)
+			codes[i] = static_cast<float>(values[i]);
+	}
+
+	inline void LoadCodes(const int16_t* values, const int32 count, float* codes) noexcept
+	{
+		simd::ForEach(count, [&]<typename Float>(const int32 i)
+		{
+			simd::Store(codes + i, simd::LoadInt16<Float>(values + i));
+		});
+	}
+
+	inline void StoreCodes(const float* codes, const int32 count, int8_t* values) noexcept
+	{
+		for (int32 i = 0; i < count; ++i)
+			values[i] = static_cast<int8_t>(codes[i]);
+	}
+
+	inline void StoreCodes(const float* codes, const int32 count, int16_t* values) noexcept
+	{
+		simd::ForEach(count, [&]<typename Float>(const int32 i)
+		{
+			simd::StoreInt16(values + i, simd::Load<Float>(codes + i));
+		});
+	}
+
+	template<int32 Bits, typename Code>
+	inline void EncodeAngles(std::span<const Vector2f> directions, Code* output) noexcept
+	{
+		float codes[s_DirectionChunk];
+		const int32 size = static_cast<int32>(directions.size());
+		for (int32 begin = 0; begin < size; begin += s_DirectionChunk)
+		{
+			const int32 count = math::Min(size - begin, s_DirectionChunk);
+			const float* input = &directions[begin].x;
+			simd::ForEach(count, [&]<typename Float>(const int32 i)
+			{
+				Float x, y;
+				simd::Deinterleave(input + i * 2, x, y);
+				simd::Store(codes + i, EncodeAngle<Bits>(x, y));
+			});
+			StoreCodes(codes, count, output + begin);
+		}
+	}
+
+	template<int32 Bits, typename Code>
+	inline void DecodeAngles(const Code* input, std::span<Vector2f> results) noexcept
+	{
+		float codes[s_DirectionChunk];
+		const int32 size = static_cast<int32>(results.size());
+		for (int32 begin = 0; begin < size; begin += s_DirectionChunk)
+		{
+			const int32 count = math::Min(size - begin, s_DirectionChunk);
+			LoadCodes(input + begin, count, codes);
+
+			float* output = &results[begin].x;
+			simd::ForEach(count, [&]<typename Float>(const int32 i)
+			{
+				Float x, y;
+				DecodeAngle<Bits>(simd::Load<Float>(codes + i), x, y);
+				simd::Interleave(output + i * 2, x, y);
+			});
+		}
+	}
+
+	template<typename Code>
+	inline void EncodeOctahedrals(std::span<const Vector3f> directions, const float scale, Code* output) noexcept
+	{
+		float codes[s_DirectionChunk * 2];
+		const int32 size = static_cast<int32>(directions.size());
+		for (int32 begin = 0; begin < size; begin += s_DirectionChunk)
+		{
+			const int32 count = math::Min(size - begin, s_DirectionChunk);
+			const float* input = &directions[begin].x;
+			simd::ForEach(count, [&]<typename Float>(const int32 i)
+			{
+				Float x, y, z, u, v;
+				simd::Deinterleave3(input + i * 3, x, y, z);
+				EncodeOctahedral(x, y, z, scale, u, v);
+				simd::Interleave(codes + i * 2, u, v);
+			});
+			StoreCodes(codes, count * 2, output + begin * 2);
+		}
+	}
+
+	template<typename Code>
+	inline void DecodeOctahedrals(const Code* input, const float scale, std::span<Vector3f> results) noexcept
+	{
+		float codes[s_DirectionChunk * 2];
+		const int32 size = static_cast<int32>(results.size());
+		for (int32 begin = 0; begin < size; begin += s_DirectionChunk)
+		{
+			const int32 count = math::Min(size - begin, s_DirectionChunk);
+			LoadCodes(input + begin * 2, count * 2, codes);
+
+			float* output = &results[begin].x;
+			simd::ForEach(count, [&]<typename Float>(const int32 i)
+			{
+				Float u, v, x, y, z;
+				simd::Deinterleave(codes + i * 2, u, v);
+				DecodeOctahedral(u, v, scale, x, y, z);
+				simd::Interleave3(output + i * 3, x, y, z);
+			});
+		}
+	}
+}
+
+template<typename Type> requires std::same_as<Type, uint8_t> || std::same_as<Type, uint16_t>
+inline Type math::EncodeDirection(const Vector2f& direction) noexcept
+{
+	const float code = detail::EncodeAngle<sizeof(Type) * 8>(direction.x, direction.y);
+	return static_cast<Type>(static_cast<int32>(code));
+}
+
+inline void math::EncodeDirection(std::span<const Vector2f> directions, std::span<uint8_t> results) noexcept
+{
+	detail::EncodeAngles<8>(directions, reinterpret_cast<int8_t*>(results.data()));
+}
+
+inline void math::EncodeDirection(std::span<const Vector2f> directions, std::span<uint16_t> results) noexcept
+{
+	detail::EncodeAngles<16>(directions, reinterpret_cast<int16_t*>(results.data()));
+}
+
+inline Vector2f math::DecodeDirection(const uint8_t value) noexcept
+{
+	float x, y;
+	detail::DecodeAngle<8>(static_cast<float>(static_cast<int8_t>(value)), x, y);
+	return Vector2f(x, y);
+}
+
+inline Vector2f math::DecodeDirection(const uint16_t value) noexcept
+{
+	float x, y;
+	detail::DecodeAngle<16>(static_cast<float>(static_cast<int16_t>(value)), x, y);
+	return Vector2f(x, y);
+}
+
+inline void math::DecodeDirection(std::span<const uint8_t> values, std::span<Vector2f> results) noexcept
+{
+	detail::DecodeAngles<8>(reinterpret_cast<const int8_t*>(values.data()), results);
+}
+
+inline void math::DecodeDirection(std::span<const uint16_t> values, std::span<Vector2f> results) noexcept
+{
+	detail::DecodeAngles<16>(reinterpret_cast<const int16_t*>(values.data()), results);
+}
+
+template<typename Type> requires std::same_as<Type, Vector2i8> || std::same_as<Type, Vector2i16>
+inline Type math::EncodeDirection(const Vector3f& direction) noexcept
+{
+	using Component = decltype(Type::x);
+	constexpr float scale = std::same_as<Type, Vector2i8> ? detail::s_DirectionScale8 : detail::s_DirectionScale16;
+	float u, v;
+	detail::EncodeOctahedral(direction.x, direction.y, direction.z, scale, u, v);
+	return Type(static_cast<Component>(u), static_cast<Component>(v));
+}
+
+inline void math::EncodeDirection(std::span<const Vector3f> directions, std::span<Vector2i8> results) noexcept
+{
+	detail::EncodeOctahedrals(directions, detail::s_DirectionScale8, &results.data()->x);
+}
+
+inline void math::EncodeDirection(std::span<const Vector3f> directions, std::span<Vector2i16> results) noexcept
+{
+	detail::EncodeOctahedrals(directions, detail::s_DirectionScale16, &results.data()->x);
+}
+
+inline Vector3f math::DecodeDirection(const Vector2i8& value) noexcept
+{
+	float x, y, z;
+	detail::DecodeOctahedral(static_cast<float>(value.x), static_cast<float>(value.y), detail::s_DirectionScale8, x, y, z);
+	return Vector3f(x, y, z);
+}
+
+inline Vector3f math::DecodeDirection(const Vector2i16& value) noexcept
+{
+	float x, y, z;
+	detail::DecodeOctahedral(static_cast<float>(value.x), static_cast<float>(value.y), detail::s_DirectionScale16, x, y, z);
+	return Vector3f(x, y, z);
+}
+
+inline void math::DecodeDirection(std::span<const Vector2i8> values, std::span<Vector3f> results) noexcept
+{
+	detail::DecodeOctahedrals(&values.data()->x, detail::s_DirectionScale8, results);
+}
+
+inline void math::DecodeDirection(std::span<const Vector2i16> values, std::span<Vector3f> results) noexcept
+{
+	detail::DecodeOctahedrals(&values.data()->x, detail::s_DirectionScale16, results);
+}
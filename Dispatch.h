@@ -0,0 +1,65 @@
+#pragma once
+
+#include <Core/Math.h>
+#include <Core/Vector.h>
+
+#include <span>
+
+/// \brief Selects the batch kernels for the instruction set of the cpu that the program is running on.
+///
+/// Everything else is compiled for the instruction set that the translation unit targets, so a binary
+/// that is built for SSE2 never uses AVX2. The dispatched kernels are compiled for each instruction set
+/// with function attributes instead, the cpu is detected once with CPUID and the kernels are cached.
+///
+/// The environment variable MATH_SIMD_ISA can be set to scalar, sse2, sse4, avx2, avx512 or neon to
+/// select a lower instruction set for benchmarking, it is ignored if the cpu doesn't support it.
+/// Selecting a lower instruction set than the translation unit is compiled for uses the scalar kernels.
+/// There are no 512 bit kernels so AVX512 uses the AVX2 kernels.
+namespace dispatch
+{
+	enum class Isa
+	{
+		Scalar,
+		SSE2,
+		SSE4,
+		AVX2,
+		AVX512,
+		NEON,
+	};
+
+	/// \brief The batch operations from VectorBatch.h compiled for one instruction set.
+	struct Kernels
+	{
+		void (*clamp)(std::span<const Vector2f> values, const Vector2f& min, const Vector2f& max, std::span<Vector2f> results) noexcept;
+		void (*lerp)(std::span<const Vector2f> a, std::span<const Vector2f> b, const float t, std::span<Vector2f> results) noexcept;
+		void (*limit)(std::span<const Vector2f> values, const float value, std::span<Vector2f> results) noexcept;
+		void (*normalize)(std::span<const Vector2f> values, std::span<Vector2f> results) noexcept;
+		void (*remap)(std::span<const Vector2f> values, const Vector2f& fromA, const Vector2f& fromB, const Vector2f& toA, const Vector2f& toB, std::span<Vector2f> results) noexcept;
+	};
+
+	/// \brief Returns the best instruction set that is supported by the cpu and the operating system.
+	inline Isa Detect() noexcept;
+
+	/// \brief Returns the instruction set that the kernels are selected for, which is the detected one
+	/// unless it has been lowered by MATH_SIMD_ISA. It is only evaluated the first time it is called.
+	inline Isa GetIsa() noexcept;
+
+	/// \brief Returns the kernels for the instruction set that was selected by GetIsa.
+	inline const Kernels& GetKernels() noexcept;
+	/// \brief Returns the kernels for an instruction set, it must be supported by the cpu.
+	inline const Kernels& GetKernels(const Isa isa) noexcept;
+
+	/// \brief Returns the lower case name of an instruction set that is also used by MATH_SIMD_ISA.
+	inline const char* ToString(const Isa isa) noexcept;
+
+	/// \brief Clamps each vector component-wise between min and max.
+	inline void Clamp(std::span<const Vector2f> values, const Vector2f& min, const Vector2f& max, std::span<Vector2f> results) noexcept;
+	/// \brief Linearly interpolates from each vector in a to the matching vector in b based on t.
+	inline void Lerp(std::span<const Vector2f> a, std::span<const Vector2f> b, const float t, std::span<Vector2f> results) noexcept;
+	/// \brief Reduces the length of each vector so that it doesn't exceed value.
+	inline void Limit(std::span<const Vector2f> values, const float value, std::span<Vector2f> results) noexcept;
+	/// \brief Normalizes each vector to have a length of 1 unit.
+	inline void Normalize(std::span<const Vector2f> values, std::span<Vector2f> results) noexcept;
+	/// \brief Converts each vector component-wise from one range to another range.
+	inline void Remap(std::span<const Vector2f> values, const Vector2f& fromA, const Vector2f& fromB, const Vector2f& toA, const Vector2f& toB, std::span<Vector2f> results) noexcept;
+}
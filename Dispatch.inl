@@ -0,0 +1,388 @@
+#pragma once
+
+#include <Core/Instrument.h>
+#include <Core/Math.h>
+#include <Core/Simd.h>
+#include <Core/VectorBatch.h>
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define MATH_DISPATCH_X86
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+#if defined(MATH_DISPATCH_X86) && defined(_MSC_VER) && !defined(__clang__)
+// msvc allows the intrinsics of any instruction set without enabling it for the whole function
+#define MATH_TARGET_AVX2
+#elif defined(MATH_DISPATCH_X86)
+#define MATH_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#endif
+
+namespace dispatch::detail
+{
+#if defined(MATH_DISPATCH_X86)
+	inline void CpuId(const uint32_t leaf, const uint32_t subleaf, uint32_t (&registers)[4]) noexcept
+	{
+#if defined(_MSC_VER)
+		int values[4];
+		__cpuidex(values, static_cast<int>(leaf), static_cast<int>(subleaf));
+		for (int32 i = 0; i < 4; ++i)
+			registers[i] = static_cast<uint32_t>(values[i]);
+#else
+		__cpuid_count(leaf, subleaf, registers[0], registers[1], registers[2], registers[3]);
+#endif
+	}
+
+	inline uint64_t GetXcr0() noexcept
+	{
+#if defined(_MSC_VER)
+		return _xgetbv(0);
+#else
+		uint32_t low, high;
+		__asm__("xgetbv" : "=a"(low), "=d"(high) : "c"(0));
+		return (static_cast<uint64_t>(high) << 32) | low;
+#endif
+	}
+#endif
+
+	/// \brief The instruction set that the translation unit is compiled for.
+#if defined(MATH_SIMD_AVX2)
+	constexpr Isa Native = Isa::AVX2;
+#elif defined(MATH_SIMD_SSE4)
+	constexpr Isa Native = Isa::SSE4;
+#elif defined(MATH_SIMD_SSE2)
+	constexpr Isa Native = Isa::SSE2;
+#elif defined(MATH_SIMD_NEON)
+	constexpr Isa Native = Isa::NEON;
+#else
+	constexpr Isa Native = Isa::Scalar;
+#endif
+
+	inline bool IsSupported(const Isa isa, const Isa detected) noexcept
+	{
+		if (isa == Isa::Scalar || isa == detected)
+			return true;
+		// the x86 instruction sets are ordered so that each one includes the ones before it
+		return (isa != Isa::NEON) && (detected != Isa::NEON) && (isa < detected);
+	}
+
+	namespace scalar
+	{
+		inline void Clamp(std::span<const Vector2f> values, const Vector2f& min, const Vector2f& max, std::span<Vector2f> results) noexcept
+		{
+			for (size_t i = 0; i < values.size(); ++i)
+				results[i] = math::Clamp(values[i], min, max);
+		}
+
+		inline void Lerp(std::span<const Vector2f> a, std::span<const Vector2f> b, const float t, std::span<Vector2f> results) noexcept
+		{
+			for (size_t i = 0; i < a.size(); ++i)
+				results[i] = math::Lerp(a[i], b[i], t);
+		}
+
+		inline void Limit(std::span<const Vector2f> values, const float value, std::span<Vector2f> results) noexcept
+		{
+			for (size_t i = 0; i < values.size(); ++i)
+				results[i] = values[i].Limited(value);
+		}
+
+		inline void Normalize(std::span<const Vector2f> values, std::span<Vector2f> results) noexcept
+		{
+			for (size_t i = 0; i < values.size(); ++i)
+				results[i] = values[i].Normalized();
+		}
+
+		inline void Remap(std::span<const Vector2f> values, const Vector2f& fromA, const Vector2f& fromB, const Vector2f& toA, const Vector2f& toB, std::span<Vector2f> results) noexcept
+		{
+			for (size_t i = 0; i < values.size(); ++i)
+			{
+				const Vector2f& value = values[i];
+				results[i] = Vector2f(
+					math::Remap(value.x, fromA.x, fromB.x, toA.x, toB.x),
+					math::Remap(value.y, fromA.y, fromB.y, toA.y, toB.y));
+			}
+		}
+	}
+
+#if defined(MATH_DISPATCH_X86)
+	/// \brief Kernels for 8 vectors at a time, the remainder goes through the scalar kernels.
+	namespace avx2
+	{
+		MATH_TARGET_AVX2 inline void Load(const Vector2f* values, __m256& x, __m256& y) noexcept
+		{
+			const __m256 a = _mm256_loadu_ps(&values->x);
+			const __m256 b = _mm256_loadu_ps(&values->x + 8);
+			const __m256 lo = _mm256_permute2f128_ps(a, b, 0x20);
+			const __m256 hi = _mm256_permute2f128_ps(a, b, 0x31);
+			x = _mm256_shuffle_ps(lo, hi, _MM_SHUFFLE(2, 0, 2, 0));
+			y = _mm256_shuffle_ps(lo, hi, _MM_SHUFFLE(3, 1, 3, 1));
+		}
+
+		MATH_TARGET_AVX2 inline void Store(Vector2f* values, const __m256 x, const __m256 y) noexcept
+		{
+			const __m256 lo = _mm256_unpacklo_ps(x, y);
+			const __m256 hi = _mm256_unpackhi_ps(x, y);
+			_mm256_storeu_ps(&values->x, _mm256_permute2f128_ps(lo, hi, 0x20));
+			_mm256_storeu_ps(&values->x + 8, _mm256_permute2f128_ps(lo, hi, 0x31));
+		}
+
+		MATH_TARGET_AVX2 inline void Clamp(std::span<const Vector2f> values, const Vector2f& min, const Vector2f& max, std::span<Vector2f> results) noexcept
+		{
+			const int32 count = static_cast<int32>(values.size());
+			const __m256 minX = _mm256_set1_ps(min.x), minY = _mm256_set1_ps(min.y);
+			const __m256 maxX = _mm256_set1_ps(max.x), maxY = _mm256_set1_ps(max.y);
+			int32 i = 0;
+			for (; i + 8 <= count; i += 8)
+			{
+				__m256 x, y;
+				Load(&values[i], x, y);
+				Store(&results[i], _mm256_min_ps(_mm256_max_ps(x, minX), maxX), _mm256_min_ps(_mm256_max_ps(y, minY), maxY));
+			}
+			scalar::Clamp(values.subspan(i), min, max, results.subspan(i));
+		}
+
+		MATH_TARGET_AVX2 inline void Lerp(std::span<const Vector2f> a, std::span<const Vector2f> b, const float t, std::span<Vector2f> results) noexcept
+		{
+			const int32 count = static_cast<int32>(a.size());
+			const __m256 weight = _mm256_set1_ps(t);
+			int32 i = 0;
+			for (; i + 8 <= count; i += 8)
+			{
+				__m256 ax, ay, bx, by;
+				Load(&a[i], ax, ay);
+				Load(&b[i], bx, by);
+				Store(&results[i], _mm256_fmadd_ps(_mm256_sub_ps(bx, ax), weight, ax), _mm256_fmadd_ps(_mm256_sub_ps(by, ay), weight, ay));
+			}
+			scalar::Lerp(a.subspan(i), b.subspan(i), t, results.subspan(i));
+		}
+
+		MATH_TARGET_AVX2 inline void Limit(std::span<const Vector2f> values, const float value, std::span<Vector2f> results) noexcept
+		{
+			const int32 count = static_cast<int32>(values.size());
+			const __m256 limit = _mm256_set1_ps(value);
+			int32 i = 0;
+			for (; i + 8 <= count; i += 8)
+			{
+				__m256 x, y;
+				Load(&values[i], x, y);
+				const __m256 length = _mm256_sqrt_ps(_mm256_fmadd_ps(x, x, _mm256_mul_ps(y, y)));
+				const __m256 scale = _mm256_blendv_ps(_mm256_set1_ps(1.f), _mm256_div_ps(limit, length), _mm256_cmp_ps(length, limit, _CMP_GT_OQ));
+				Store(&results[i], _mm256_mul_ps(x, scale), _mm256_mul_ps(y, scale));
+			}
+			scalar::Limit(values.subspan(i), value, results.subspan(i));
+		}
+
+		MATH_TARGET_AVX2 inline void Normalize(std::span<const Vector2f> values, std::span<Vector2f> results) noexcept
+		{
+			constexpr float epsilon = 0.0000001f;
+			const int32 count = static_cast<int32>(values.size());
+			int32 i = 0;
+			for (; i + 8 <= count; i += 8)
+			{
+				__m256 x, y;
+				Load(&values[i], x, y);
+				const __m256 length = _mm256_sqrt_ps(_mm256_fmadd_ps(x, x, _mm256_mul_ps(y, y)));
+				const __m256 scale = _mm256_and_ps(_mm256_div_ps(_mm256_set1_ps(1.f), length), _mm256_cmp_ps(length, _mm256_set1_ps(epsilon), _CMP_GT_OQ));
+				Store(&results[i], _mm256_mul_ps(x, scale), _mm256_mul_ps(y, scale));
+			}
+			scalar::Normalize(values.subspan(i), results.subspan(i));
+		}
+
+		MATH_TARGET_AVX2 inline void Remap(std::span<const Vector2f> values, const Vector2f& fromA, const Vector2f& fromB, const Vector2f& toA, const Vector2f& toB, std::span<Vector2f> results) noexcept
+		{
+			// fromA is subtracted before the scale like in VectorBatch.inl so that values close to it stay exact
+			const Vector2f scale = math::Divide(toB - toA, fromB - fromA);
+			const __m256 fromX = _mm256_set1_ps(fromA.x), fromY = _mm256_set1_ps(fromA.y);
+			const __m256 scaleX = _mm256_set1_ps(scale.x), scaleY = _mm256_set1_ps(scale.y);
+			const __m256 toX = _mm256_set1_ps(toA.x), toY = _mm256_set1_ps(toA.y);
+
+			const int32 count = static_cast<int32>(values.size());
+			int32 i = 0;
+			for (; i + 8 <= count; i += 8)
+			{
+				__m256 x, y;
+				Load(&values[i], x, y);
+				Store(&results[i], _mm256_fmadd_ps(_mm256_sub_ps(x, fromX), scaleX, toX), _mm256_fmadd_ps(_mm256_sub_ps(y, fromY), scaleY, toY));
+			}
+			for (; i < count; ++i)
+				results[i] = Vector2f((values[i].x - fromA.x) * scale.x + toA.x, (values[i].y - fromA.y) * scale.y + toA.y);
+		}
+	}
+#endif
+}
+
+inline dispatch::Isa dispatch::Detect() noexcept
+{
+#if defined(MATH_DISPATCH_X86)
+	uint32_t registers[4];
+	detail::CpuId(0, 0, registers);
+	const uint32_t maxLeaf = registers[0];
+
+	detail::CpuId(1, 0, registers);
+	const bool sse2 = (registers[3] & (1u << 26)) != 0;
+	const bool sse4 = (registers[2] & (1u << 19)) != 0;
+	const bool fma = (registers[2] & (1u << 12)) != 0;
+	const bool avx = (registers[2] & (1u << 28)) != 0;
+	const bool osxsave = (registers[2] & (1u << 27)) != 0;
+
+	// the operating system has to save the ymm and zmm registers on a context switch
+	const uint64_t xcr0 = osxsave ? detail::GetXcr0() : 0;
+	const bool ymm = (xcr0 & 0x6) == 0x6;
+	const bool zmm = (xcr0 & 0xE6) == 0xE6;
+
+	bool avx2 = false, avx512 = false;
+	if (maxLeaf >= 7)
+	{
+		detail::CpuId(7, 0, registers);
+		avx2 = (registers[1] & (1u << 5)) != 0;
+		avx512 = (registers[1] & (1u << 16)) != 0;
+	}
+
+	if (avx && avx2 && fma && ymm)
+		return (avx512 && zmm) ? Isa::AVX512 : Isa::AVX2;
+	if (sse4)
+		return Isa::SSE4;
+	if (sse2)
+		return Isa::SSE2;
+	return Isa::Scalar;
+#elif defined(MATH_SIMD_NEON)
+	// neon is mandatory on aarch64
+	return Isa::NEON;
+#else
+	return Isa::Scalar;
+#endif
+}
+
+inline dispatch::Isa dispatch::GetIsa() noexcept
+{
+	static const Isa isa = []()
+	{
+		const Isa detected = Detect();
+#if defined(_MSC_VER)
+#pragma warning(suppress : 4996)
+#endif
+		const char* value = std::getenv("MATH_SIMD_ISA");
+		if (!value)
+			return detected;
+
+		for (const Isa isa : { Isa::Scalar, Isa::SSE2, Isa::SSE4, Isa::AVX2, Isa::AVX512, Isa::NEON })
+		{
+			if (std::strcmp(value, ToString(isa)) == 0 && detail::IsSupported(isa, detected))
+				return isa;
+		}
+		return detected;
+	}();
+	return isa;
+}
+
+inline const dispatch::Kernels& dispatch::GetKernels() noexcept
+{
+	static const Kernels& kernels = GetKernels(GetIsa());
+	return kernels;
+}
+
+inline const dispatch::Kernels& dispatch::GetKernels(const Isa isa) noexcept
+{
+	static constexpr Kernels scalar =
+	{
+		&detail::scalar::Clamp,
+		&detail::scalar::Lerp,
+		&detail::scalar::Limit,
+		&detail::scalar::Normalize,
+		&detail::scalar::Remap,
+	};
+
+	// the kernels from VectorBatch.h which use the instruction set the translation unit is compiled for,
+	// without their instrumentation because the entry points below already instrument every call
+	static constexpr Kernels native =
+	{
+		&math::detail::Clamp,
+		&math::detail::Lerp,
+		&math::detail::Limit,
+		&math::detail::Normalize,
+		&math::detail::Remap,
+	};
+
+	if (isa == Isa::Scalar)
+		return scalar;
+
+#if defined(MATH_DISPATCH_X86)
+	static constexpr Kernels avx2 =
+	{
+		&detail::avx2::Clamp,
+		&detail::avx2::Lerp,
+		&detail::avx2::Limit,
+		&detail::avx2::Normalize,
+		&detail::avx2::Remap,
+	};
+
+	if ((isa == Isa::AVX2 || isa == Isa::AVX512) && detail::Native != Isa::AVX2)
+		return avx2;
+#endif
+
+	// the native kernels can only be lowered to scalar since they are fixed when compiling
+	if (detail::Native == Isa::Scalar || !detail::IsSupported(detail::Native, isa))
+		return scalar;
+	return native;
+}
+
+inline const char* dispatch::ToString(const Isa isa) noexcept
+{
+	switch (isa)
+	{
+	case Isa::Scalar: return "scalar";
+	case Isa::SSE2: return "sse2";
+	case Isa::SSE4: return "sse4";
+	case Isa::AVX2: return "avx2";
+	case Isa::AVX512: return "avx512";
+	case Isa::NEON: return "neon";
+	}
+	return "scalar";
+}
+
+inline void dispatch::Clamp(std::span<const Vector2f> values, const Vector2f& min, const Vector2f& max, std::span<Vector2f> results) noexcept
+{
+	MATH_TIMER(instrument::Timer::Clamp);
+	GetKernels().clamp(values, min, max, results);
+}
+
+inline void dispatch::Lerp(std::span<const Vector2f> a, std::span<const Vector2f> b, const float t, std::span<Vector2f> results) noexcept
+{
+	MATH_TIMER(instrument::Timer::Lerp);
+	GetKernels().lerp(a, b, t, results);
+}
+
+inline void dispatch::Limit(std::span<const Vector2f> values, const float value, std::span<Vector2f> results) noexcept
+{
+	{
+		MATH_TIMER(instrument::Timer::Limit);
+		GetKernels().limit(values, value, results);
+	}
+	MATH_COUNT(instrument::Counter::LimitVectors, values.size());
+	MATH_COUNT(instrument::Counter::LimitNaN, instrument::detail::CountNaN(results.first(values.size())));
+}
+
+inline void dispatch::Normalize(std::span<const Vector2f> values, std::span<Vector2f> results) noexcept
+{
+	{
+		MATH_TIMER(instrument::Timer::Normalize);
+		GetKernels().normalize(values, results);
+	}
+	MATH_COUNT(instrument::Counter::NormalizeVectors, values.size());
+	MATH_COUNT(instrument::Counter::NormalizeZeroLength, instrument::detail::CountZero(results.first(values.size())));
+	MATH_COUNT(instrument::Counter::NormalizeNaN, instrument::detail::CountNaN(results.first(values.size())));
+}
+
+inline void dispatch::Remap(std::span<const Vector2f> values, const Vector2f& fromA, const Vector2f& fromB, const Vector2f& toA, const Vector2f& toB, std::span<Vector2f> results) noexcept
+{
+	MATH_TIMER(instrument::Timer::Remap);
+	GetKernels().remap(values, fromA, fromB, toA, toB, results);
+}
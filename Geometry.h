@@ -0,0 +1,142 @@
+#pragma once
+
+#include <Core/Math.h>
+#include <Core/Vector.h>
+
+#include <cstdint>
+#include <span>
+
+/// \brief An axis aligned bounding box defined by its min and max corners, where min <= max.
+class AABB2f
+{
+public:
+	/// \brief Construct a new box with both corners at the origin.
+	constexpr AABB2f() noexcept : min(), max() {}
+	/// \brief Construct a new box with corners min and max.
+	constexpr explicit AABB2f(const Vector2f& min, const Vector2f& max) noexcept : min(min), max(max) {}
+
+	/// \brief Construct a new box from its center and the distance from the center to each side.
+	static constexpr AABB2f FromCenter(const Vector2f& center, const Vector2f& extents) noexcept { return AABB2f(center - extents, center + extents); }
+
+	/// \brief Returns true if both corners are identical.
+	constexpr bool operator==(const AABB2f& rhs) const noexcept { return (min == rhs.min) && (max == rhs.max); }
+	/// \brief Returns true if either corners aren't identical.
+	constexpr bool operator!=(const AABB2f& rhs) const noexcept { return (min != rhs.min) || (max != rhs.max); }
+
+	/// \brief Returns the point in the middle of the box.
+	constexpr Vector2f GetCenter() const noexcept { return (min + max) * 0.5f; }
+	/// \brief Returns the distance from the center to each side of the box.
+	constexpr Vector2f GetExtents() const noexcept { return (max - min) * 0.5f; }
+	/// \brief Returns the width and height of the box.
+	constexpr Vector2f GetSize() const noexcept { return max - min; }
+
+	/// \brief Returns true if the point is inside or on the edge of the box.
+	constexpr bool Contains(const Vector2f& point) const noexcept;
+
+public:
+	Vector2f min, max;
+};
+
+/// \brief A circle defined by its center and radius.
+class Circle2f
+{
+public:
+	/// \brief Construct a new circle at the origin with a radius of 0.
+	constexpr Circle2f() noexcept : center(), radius() {}
+	/// \brief Construct a new circle at center with radius.
+	constexpr explicit Circle2f(const Vector2f& center, const float radius) noexcept : center(center), radius(radius) {}
+
+	/// \brief Returns true if the centers and radii are identical.
+	constexpr bool operator==(const Circle2f& rhs) const noexcept { return (center == rhs.center) && (radius == rhs.radius); }
+	/// \brief Returns true if either the centers or radii aren't identical.
+	constexpr bool operator!=(const Circle2f& rhs) const noexcept { return (center != rhs.center) || (radius != rhs.radius); }
+
+	/// \brief Returns true if the point is inside or on the edge of the circle.
+	constexpr bool Contains(const Vector2f& point) const noexcept;
+
+public:
+	Vector2f center;
+	float radius;
+};
+
+/// \brief A half-line that starts at origin and extends along direction, which should be normalized
+/// so that the distances returned by the raycasts are in world units.
+class Ray2f
+{
+public:
+	/// \brief Construct a new ray at the origin with a zero direction.
+	constexpr Ray2f() noexcept : origin(), direction() {}
+	/// \brief Construct a new ray that starts at origin and extends along direction.
+	constexpr explicit Ray2f(const Vector2f& origin, const Vector2f& direction) noexcept : origin(origin), direction(direction) {}
+
+	/// \brief Returns the point that is distance along the ray.
+	constexpr Vector2f GetPoint(const float distance) const noexcept { return origin + direction * distance; }
+
+public:
+	Vector2f origin, direction;
+};
+
+/// \brief A line between the points a and b.
+class Segment2f
+{
+public:
+	/// \brief Construct a new segment with both points at the origin.
+	constexpr Segment2f() noexcept : a(), b() {}
+	/// \brief Construct a new segment from a to b.
+	constexpr explicit Segment2f(const Vector2f& a, const Vector2f& b) noexcept : a(a), b(b) {}
+
+	/// \brief Returns the point that is t of the way from a to b.
+	constexpr Vector2f GetPoint(const float t) const noexcept { return a + (b - a) * t; }
+	/// \brief Returns the length of the segment.
+	constexpr float Length() const noexcept { return (b - a).Length(); }
+
+public:
+	Vector2f a, b;
+};
+
+/// \brief Intersection tests between the geometry types.
+///
+/// The batch versions test one shape against many and write a hit mask where bit (i % 64) of word
+/// (i / 64) is set if element i is hit, hits must have (count + 63) / 64 words and it is overwritten.
+/// They process the elements in the widest registers and produce the same results as the single tests.
+namespace math
+{
+	/// \brief Returns the number of uint64_t words that are needed for the hit mask of count elements.
+	inline constexpr int32 GetHitMaskSize(const int32 count) noexcept { return (count + 63) / 64; }
+
+	/// \brief Returns the point on the segment that is closest to point.
+	inline constexpr Vector2f ClosestPoint(const Segment2f& segment, const Vector2f& point) noexcept;
+
+	/// \brief Returns true if the two boxes overlap or touch.
+	inline constexpr bool Intersects(const AABB2f& a, const AABB2f& b) noexcept;
+	/// \brief Returns true if the two circles overlap or touch.
+	inline constexpr bool Intersects(const Circle2f& a, const Circle2f& b) noexcept;
+	/// \brief Returns true if the circle and the box overlap or touch.
+	inline constexpr bool Intersects(const Circle2f& circle, const AABB2f& box) noexcept;
+	/// \brief Returns true if the segment touches the box, including when it is entirely inside of it.
+	inline constexpr bool Intersects(const Segment2f& segment, const AABB2f& box) noexcept;
+	/// \brief Returns true if the segment touches the circle, including when it is entirely inside of it.
+	inline constexpr bool Intersects(const Segment2f& segment, const Circle2f& circle) noexcept;
+
+	/// \brief Returns true if the ray hits the box within maxDistance and sets distance to where it enters
+	/// the box, which is 0 if the origin is inside of it.
+	inline constexpr bool Raycast(const Ray2f& ray, const AABB2f& box, const float maxDistance, float& distance) noexcept;
+	/// \brief Returns true if the ray hits the circle within maxDistance and sets distance to where it enters
+	/// the circle, which is 0 if the origin is inside of it. The direction of the ray must be normalized.
+	inline constexpr bool Raycast(const Ray2f& ray, const Circle2f& circle, const float maxDistance, float& distance) noexcept;
+
+	/// \brief Sets the bit of each circle that contains the point.
+	inline void Contains(std::span<const Circle2f> circles, const Vector2f& point, std::span<uint64_t> hits) noexcept;
+	/// \brief Sets the bit of each box that contains the point.
+	inline void Contains(std::span<const AABB2f> boxes, const Vector2f& point, std::span<uint64_t> hits) noexcept;
+
+	/// \brief Sets the bit of each box that overlaps box.
+	inline void Intersects(const AABB2f& box, std::span<const AABB2f> boxes, std::span<uint64_t> hits) noexcept;
+	/// \brief Sets the bit of each circle that overlaps circle.
+	inline void Intersects(const Circle2f& circle, std::span<const Circle2f> circles, std::span<uint64_t> hits) noexcept;
+	/// \brief Sets the bit of each box that the segment touches.
+	inline void Intersects(const Segment2f& segment, std::span<const AABB2f> boxes, std::span<uint64_t> hits) noexcept;
+
+	/// \brief Sets the bit of each box that the ray hits within maxDistance.
+	inline void Raycast(const Ray2f& ray, const float maxDistance, std::span<const AABB2f> boxes, std::span<uint64_t> hits) noexcept;
+}
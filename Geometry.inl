@@ -0,0 +1,233 @@
+#pragma once
+
+#include <Core/Math.h>
+#include <Core/Simd.h>
+
+#include <algorithm>
+#include <limits>
+
+namespace math::detail
+{
+	// a zero direction is replaced by the largest float rather than infinity so that the slab test
+	// never multiplies 0 by infinity when the origin is on the edge of a box, the products can still
+	// overflow to infinity which means that axis aligned directions can't be constant evaluated
+	inline constexpr float SafeReciprocal(const float value) noexcept
+	{
+		return (value != 0.f) ? 1.f / value : std::numeric_limits<float>::max();
+	}
+
+	// distances along the direction at which the line enters and exits each pair of sides
+	// where the entry is clamped to 0 and the exit to maxDistance
+	inline constexpr bool Slab(const AABB2f& box, const Vector2f& origin, const Vector2f& inverse, const float maxDistance, float& distance) noexcept
+	{
+		const float x1 = (box.min.x - origin.x) * inverse.x;
+		const float x2 = (box.max.x - origin.x) * inverse.x;
+		const float y1 = (box.min.y - origin.y) * inverse.y;
+		const float y2 = (box.max.y - origin.y) * inverse.y;
+		const float enter = math::Max(math::Max(math::Min(x1, x2), math::Min(y1, y2)), 0.f);
+		const float exit = math::Min(math::Min(math::Max(x1, x2), math::Max(y1, y2)), maxDistance);
+		distance = enter;
+		return enter <= exit;
+	}
+
+	template<typename Float>
+	inline void WriteHits(uint64_t* hits, const int32 i, const Float mask) noexcept
+	{
+		// registers never straddle two words because the width divides 64 and i is a multiple of it
+		hits[i >> 6] |= static_cast<uint64_t>(simd::BitMask(mask)) << (i & 63);
+	}
+
+	inline void Raycast(const Vector2f& origin, const Vector2f& direction, const float maxDistance, std::span<const AABB2f> boxes, std::span<uint64_t> hits) noexcept
+	{
+		const Vector2f inverse(SafeReciprocal(direction.x), SafeReciprocal(direction.y));
+		const int32 count = static_cast<int32>(boxes.size());
+
+		const float* input = &boxes.data()->min.x;
+		uint64_t* output = hits.data();
+		std::fill_n(output, GetHitMaskSize(count), uint64_t(0));
+		simd::ForEach(count, [&]<typename Float>(const int32 i)
+		{
+			Float minX, minY, maxX, maxY;
+			simd::Deinterleave4(input + i * 4, minX, minY, maxX, maxY);
+
+			const Float originX = simd::Splat<Float>(origin.x);
+			const Float originY = simd::Splat<Float>(origin.y);
+			const Float x1 = simd::Mul(simd::Sub(minX, originX), simd::Splat<Float>(inverse.x));
+			const Float x2 = simd::Mul(simd::Sub(maxX, originX), simd::Splat<Float>(inverse.x));
+			const Float y1 = simd::Mul(simd::Sub(minY, originY), simd::Splat<Float>(inverse.y));
+			const Float y2 = simd::Mul(simd::Sub(maxY, originY), simd::Splat<Float>(inverse.y));
+			const Float enter = simd::Max(simd::Max(simd::Min(x1, x2), simd::Min(y1, y2)), simd::Splat<Float>(0.f));
+			const Float exit = simd::Min(simd::Min(simd::Max(x1, x2), simd::Max(y1, y2)), simd::Splat<Float>(maxDistance));
+			WriteHits(output, i, simd::CmpLe(enter, exit));
+		});
+	}
+}
+
+inline constexpr bool AABB2f::Contains(const Vector2f& point) const noexcept
+{
+	return (point.x >= min.x) && (point.x <= max.x) && (point.y >= min.y) && (point.y <= max.y);
+}
+
+inline constexpr bool Circle2f::Contains(const Vector2f& point) const noexcept
+{
+	return math::DistanceSqr(center, point) <= radius * radius;
+}
+
+inline constexpr Vector2f math::ClosestPoint(const Segment2f& segment, const Vector2f& point) noexcept
+{
+	const Vector2f direction = segment.b - segment.a;
+	const float lengthSqr = direction.LengthSqr();
+	if (lengthSqr <= 0.f)
+		return segment.a;
+
+	const float t = math::Clamp(math::Dot(point - segment.a, direction) / lengthSqr, 0.f, 1.f);
+	return segment.a + direction * t;
+}
+
+inline constexpr bool math::Intersects(const AABB2f& a, const AABB2f& b) noexcept
+{
+	return (a.min.x <= b.max.x) && (b.min.x <= a.max.x) && (a.min.y <= b.max.y) && (b.min.y <= a.max.y);
+}
+
+inline constexpr bool math::Intersects(const Circle2f& a, const Circle2f& b) noexcept
+{
+	const float radius = a.radius + b.radius;
+	return math::DistanceSqr(a.center, b.center) <= radius * radius;
+}
+
+inline constexpr bool math::Intersects(const Circle2f& circle, const AABB2f& box) noexcept
+{
+	return circle.Contains(math::Clamp(circle.center, box.min, box.max));
+}
+
+inline constexpr bool math::Intersects(const Segment2f& segment, const AABB2f& box) noexcept
+{
+	const Vector2f direction = segment.b - segment.a;
+	const Vector2f inverse(detail::SafeReciprocal(direction.x), detail::SafeReciprocal(direction.y));
+	float distance = 0.f;
+	return detail::Slab(box, segment.a, inverse, 1.f, distance);
+}
+
+inline constexpr bool math::Intersects(const Segment2f& segment, const Circle2f& circle) noexcept
+{
+	return circle.Contains(math::ClosestPoint(segment, circle.center));
+}
+
+inline constexpr bool math::Raycast(const Ray2f& ray, const AABB2f& box, const float maxDistance, float& distance) noexcept
+{
+	const Vector2f inverse(detail::SafeReciprocal(ray.direction.x), detail::SafeReciprocal(ray.direction.y));
+	return detail::Slab(box, ray.origin, inverse, maxDistance, distance);
+}
+
+inline constexpr bool math::Raycast(const Ray2f& ray, const Circle2f& circle, const float maxDistance, float& distance) noexcept
+{
+	// solves |origin + direction * t - center| = radius for the smallest t
+	const Vector2f offset = ray.origin - circle.center;
+	const float c = offset.LengthSqr() - circle.radius * circle.radius;
+	if (c <= 0.f)
+	{
+		distance = 0.f;
+		return true;
+	}
+
+	const float b = math::Dot(offset, ray.direction);
+	const float discriminant = b * b - c;
+	if (b > 0.f || discriminant < 0.f)
+		return false;
+
+	const float t = -b - math::Sqrt(discriminant);
+	if (t > maxDistance)
+		return false;
+
+	distance = t;
+	return true;
+}
+
+inline void math::Contains(std::span<const Circle2f> circles, const Vector2f& point, std::span<uint64_t> hits) noexcept
+{
+	const int32 count = static_cast<int32>(circles.size());
+
+	const float* input = &circles.data()->center.x;
+	uint64_t* output = hits.data();
+	std::fill_n(output, GetHitMaskSize(count), uint64_t(0));
+	simd::ForEach(count, [&]<typename Float>(const int32 i)
+	{
+		Float x, y, radius;
+		simd::Deinterleave3(input + i * 3, x, y, radius);
+
+		const Float dx = simd::Sub(simd::Splat<Float>(point.x), x);
+		const Float dy = simd::Sub(simd::Splat<Float>(point.y), y);
+		const Float distanceSqr = simd::Add(simd::Mul(dx, dx), simd::Mul(dy, dy));
+		detail::WriteHits(output, i, simd::CmpLe(distanceSqr, simd::Mul(radius, radius)));
+	});
+}
+
+inline void math::Contains(std::span<const AABB2f> boxes, const Vector2f& point, std::span<uint64_t> hits) noexcept
+{
+	const int32 count = static_cast<int32>(boxes.size());
+
+	const float* input = &boxes.data()->min.x;
+	uint64_t* output = hits.data();
+	std::fill_n(output, GetHitMaskSize(count), uint64_t(0));
+	simd::ForEach(count, [&]<typename Float>(const int32 i)
+	{
+		Float minX, minY, maxX, maxY;
+		simd::Deinterleave4(input + i * 4, minX, minY, maxX, maxY);
+
+		const Float x = simd::Splat<Float>(point.x);
+		const Float y = simd::Splat<Float>(point.y);
+		const Float inside = simd::And(
+			simd::And(simd::CmpGe(x, minX), simd::CmpLe(x, maxX)),
+			simd::And(simd::CmpGe(y, minY), simd::CmpLe(y, maxY)));
+		detail::WriteHits(output, i, inside);
+	});
+}
+
+inline void math::Intersects(const AABB2f& box, std::span<const AABB2f> boxes, std::span<uint64_t> hits) noexcept
+{
+	const int32 count = static_cast<int32>(boxes.size());
+
+	const float* input = &boxes.data()->min.x;
+	uint64_t* output = hits.data();
+	std::fill_n(output, GetHitMaskSize(count), uint64_t(0));
+	simd::ForEach(count, [&]<typename Float>(const int32 i)
+	{
+		Float minX, minY, maxX, maxY;
+		simd::Deinterleave4(input + i * 4, minX, minY, maxX, maxY);
+
+		const Float overlaps = simd::And(
+			simd::And(simd::CmpLe(simd::Splat<Float>(box.min.x), maxX), simd::CmpLe(minX, simd::Splat<Float>(box.max.x))),
+			simd::And(simd::CmpLe(simd::Splat<Float>(box.min.y), maxY), simd::CmpLe(minY, simd::Splat<Float>(box.max.y))));
+		detail::WriteHits(output, i, overlaps);
+	});
+}
+
+inline void math::Intersects(const Circle2f& circle, std::span<const Circle2f> circles, std::span<uint64_t> hits) noexcept
+{
+	const int32 count = static_cast<int32>(circles.size());
+
+	const float* input = &circles.data()->center.x;
+	uint64_t* output = hits.data();
+	std::fill_n(output, GetHitMaskSize(count), uint64_t(0));
+	simd::ForEach(count, [&]<typename Float>(const int32 i)
+	{
+		Float x, y, radius;
+		simd::Deinterleave3(input + i * 3, x, y, radius);
+
+		const Float dx = simd::Sub(x, simd::Splat<Float>(circle.center.x));
+		const Float dy = simd::Sub(y, simd::Splat<Float>(circle.center.y));
+		const Float distanceSqr = simd::Add(simd::Mul(dx, dx), simd::Mul(dy, dy));
+		const Float sum = simd::Add(simd::Splat<Float>(circle.radius), radius);
+		detail::WriteHits(output, i, simd::CmpLe(distanceSqr, simd::Mul(sum, sum)));
+	});
+}
+
+inline void math::Intersects(const Segment2f& segment, std::span<const AABB2f> boxes, std::span<uint64_t> hits) noexcept
+{
+	detail::Raycast(segment.a, segment.b - segment.a, 1.f, boxes, hits);
+}
+
+inline void math::Raycast(const Ray2f& ray, const float maxDistance, std::span<const AABB2f> boxes, std::span<uint64_t> hits) noexcept
+{
+	detail::Raycast(ray.origin, ray.direction, maxDistance, boxes, hits);
+}
@@ -0,0 +1,45 @@
+#include <Core/Math.h>
+#include <Core/Vector.h>
+#include <Core/VectorDouble.h>
+#include <Core/VectorN.h>
+
+#include <Core/Math.inl>
+#include <Core/Vector.inl>
+#include <Core/VectorDouble.inl>
+#include <Core/VectorN.inl>
+
+// The definitions of the instantiations that the headers declare as extern when MATH_EXTERN_TEMPLATES is defined.
+// Min and Max of the vector classes are explicit specializations in their .inl so they aren't listed here.
+
+namespace math
+{
+	template float Ceiling<float>(const float) noexcept;
+	template float Ceiling<float>(const float, const float) noexcept;
+	template float Clamp<float>(const float&, const float&, const float&) noexcept;
+	template float Floor<float>(const float) noexcept;
+	template float Floor<float>(const float, const float) noexcept;
+	template float Lerp<float>(const float&, const float&, const float) noexcept;
+	template float Max<float>(const float&, const float&) noexcept;
+	template float Min<float>(const float&, const float&) noexcept;
+	template float Remap<float>(float, const float&, const float&, const float&, const float&) noexcept;
+	template float Round<float>(const float) noexcept;
+	template float Round<float>(const float, const float) noexcept;
+	template float Sqr<float>(const float) noexcept;
+
+	template int32 Ceiling<int32>(const float) noexcept;
+	template int32 Clamp<int32>(const int32&, const int32&, const int32&) noexcept;
+	template int32 Floor<int32>(const float) noexcept;
+	template int32 Max<int32>(const int32&, const int32&) noexcept;
+	template int32 Min<int32>(const int32&, const int32&) noexcept;
+	template int32 Remap<int32>(int32, const int32&, const int32&, const int32&, const int32&) noexcept;
+	template int32 Round<int32>(const float) noexcept;
+	template float Sqr<int32>(const int32) noexcept;
+
+	template Vector2f Lerp<Vector2f>(const Vector2f&, const Vector2f&, const float) noexcept;
+	template Vector3f Lerp<Vector3f>(const Vector3f&, const Vector3f&, const float) noexcept;
+	template Vector2d Lerp<Vector2d>(const Vector2d&, const Vector2d&, const float) noexcept;
+	template Vector3d Lerp<Vector3d>(const Vector3d&, const Vector3d&, const float) noexcept;
+}
+
+template class Vector<int32, 2>;
+template class Vector<int32, 3>;
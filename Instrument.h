@@ -0,0 +1,154 @@
+#pragma once
+
+#include <Core/Math.h>
+
+#include <cstdint>
+#include <iosfwd>
+
+#if defined(MATH_INSTRUMENTATION)
+#include <atomic>
+#include <chrono>
+#include <span>
+#endif
+
+/// \brief Counters and timers for the batch operations that are compiled in when MATH_INSTRUMENTATION is defined.
+///
+/// Only the entry points of VectorBatch.h and Dispatch.h are instrumented, once per call, so the functions of a
+/// single vector stay constexpr and untouched. Each thread adds to its own counters without any locks or atomic
+/// read-modify-writes, a snapshot then sums the counters of every thread that is running or has exited. When
+/// MATH_INSTRUMENTATION isn't defined the macros expand to nothing, the snapshot is then always zero.
+namespace instrument
+{
+	/// \brief The vectors that the batch Limit and Normalize have processed, how many of them had a length
+	/// of 0 and were normalized to 0, and how many of the results are NaN.
+	enum class Counter
+	{
+		LimitVectors,
+		LimitNaN,
+		NormalizeVectors,
+		NormalizeZeroLength,
+		NormalizeNaN,
+		Count,
+	};
+
+	/// \brief The batch operations from VectorBatch.h and Dispatch.h that are timed.
+	enum class Timer
+	{
+		Clamp,
+		Lerp,
+		Limit,
+		Normalize,
+		Remap,
+		Count,
+	};
+
+	/// \brief The totals of every counter and timer at the time that it was taken.
+	struct Snapshot
+	{
+		uint64_t counters[static_cast<int32>(Counter::Count)] = {};
+		uint64_t calls[static_cast<int32>(Timer::Count)] = {};
+		uint64_t nanoseconds[static_cast<int32>(Timer::Count)] = {};
+
+		uint64_t operator[](const Counter counter) const noexcept { return counters[static_cast<int32>(counter)]; }
+	};
+
+	/// \brief Returns true if the instrumentation is compiled in.
+	inline constexpr bool IsEnabled() noexcept;
+
+	/// \brief Returns the totals of all threads since the start of the program or the last call to Reset.
+	/// Counts that are added by other threads while it is taken are either included or left for the next one.
+	inline Snapshot GetSnapshot();
+	/// \brief Makes the following snapshots start from zero again.
+	inline void Reset();
+
+	/// \brief Writes each counter and timer on its own line as "name value" and "name calls nanoseconds".
+	inline void Export(const Snapshot& snapshot, std::ostream& stream);
+
+	/// \brief Returns the name of a counter that is also used by Export.
+	inline const char* ToString(const Counter counter) noexcept;
+	/// \brief Returns the name of a timer that is also used by Export.
+	inline const char* ToString(const Timer timer) noexcept;
+}
+
+#if defined(MATH_INSTRUMENTATION)
+
+namespace instrument::detail
+{
+	struct ThreadCounters
+	{
+		ThreadCounters();
+		~ThreadCounters();
+
+		// only the thread that owns them writes, so the atomics are only there to let the snapshot read them
+		std::atomic<uint64_t> counters[static_cast<int32>(Counter::Count)] = {};
+		std::atomic<uint64_t> calls[static_cast<int32>(Timer::Count)] = {};
+		std::atomic<uint64_t> nanoseconds[static_cast<int32>(Timer::Count)] = {};
+	};
+
+	inline ThreadCounters& GetThreadCounters() noexcept
+	{
+		thread_local ThreadCounters counters;
+		return counters;
+	}
+
+	inline void Add(std::atomic<uint64_t>& value, const uint64_t amount) noexcept
+	{
+		value.store(value.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+	}
+
+	inline void Add(const Counter counter, const uint64_t amount) noexcept
+	{
+		Add(GetThreadCounters().counters[static_cast<int32>(counter)], amount);
+	}
+
+	template<typename Vector>
+	inline uint64_t CountNaN(std::span<Vector> values) noexcept
+	{
+		uint64_t count = 0;
+		for (const Vector& value : values)
+			count += (value.x != value.x || value.y != value.y);
+		return count;
+	}
+
+	template<typename Vector>
+	inline uint64_t CountZero(std::span<Vector> values) noexcept
+	{
+		uint64_t count = 0;
+		for (const Vector& value : values)
+			count += (value.x == 0.f && value.y == 0.f);
+		return count;
+	}
+}
+
+namespace instrument
+{
+	/// \brief Adds the time from construction to destruction and a call to a timer.
+	class ScopedTimer
+	{
+	public:
+		explicit ScopedTimer(const Timer timer) noexcept : m_Timer(timer), m_Start(std::chrono::steady_clock::now()) {}
+		ScopedTimer(const ScopedTimer& rhs) = delete;
+		~ScopedTimer();
+
+		ScopedTimer& operator=(const ScopedTimer& rhs) = delete;
+
+	private:
+		Timer m_Timer;
+		std::chrono::steady_clock::time_point m_Start;
+	};
+}
+
+#define MATH_INSTRUMENT_CONCAT_IMPL(a, b) a##b
+#define MATH_INSTRUMENT_CONCAT(a, b) MATH_INSTRUMENT_CONCAT_IMPL(a, b)
+
+/// \brief Adds amount to a counter, the amount isn't evaluated when it is disabled.
+#define MATH_COUNT(counter, amount) ::instrument::detail::Add(counter, static_cast<uint64_t>(amount))
+/// \brief Times the rest of the scope.
+#define MATH_TIMER(timer) const ::instrument::ScopedTimer MATH_INSTRUMENT_CONCAT(instrumentTimer, __LINE__)(timer)
+
+#else
+
+#define MATH_COUNT(counter, amount) do { } while (false)
+#define MATH_TIMER(timer) do { } while (false)
+
+#endif
@@ -0,0 +1,144 @@
+#pragma once
+
+#include <Core/Math.h>
+
+#include <ostream>
+
+#if defined(MATH_INSTRUMENTATION)
+#include <algorithm>
+#include <mutex>
+#include <vector>
+
+namespace instrument::detail
+{
+	struct Registry
+	{
+		std::mutex mutex;
+		std::vector<ThreadCounters*> threads;
+		// the counters of the threads that have exited and the totals at the last reset
+		Snapshot exited;
+		Snapshot baseline;
+	};
+
+	inline Registry& GetRegistry()
+	{
+		static Registry registry;
+		return registry;
+	}
+
+	inline void Accumulate(const ThreadCounters& thread, Snapshot& snapshot) noexcept
+	{
+		for (int32 i = 0; i < static_cast<int32>(Counter::Count); ++i)
+			snapshot.counters[i] += thread.counters[i].load(std::memory_order_relaxed);
+		for (int32 i = 0; i < static_cast<int32>(Timer::Count); ++i)
+		{
+			snapshot.calls[i] += thread.calls[i].load(std::memory_order_relaxed);
+			snapshot.nanoseconds[i] += thread.nanoseconds[i].load(std::memory_order_relaxed);
+		}
+	}
+
+	inline Snapshot GetTotals(Registry& registry) noexcept
+	{
+		Snapshot totals = registry.exited;
+		for (const ThreadCounters* thread : registry.threads)
+			Accumulate(*thread, totals);
+		return totals;
+	}
+
+	inline ThreadCounters::ThreadCounters()
+	{
+		Registry& registry = GetRegistry();
+		const std::lock_guard lock(registry.mutex);
+		registry.threads.push_back(this);
+	}
+
+	inline ThreadCounters::~ThreadCounters()
+	{
+		Registry& registry = GetRegistry();
+		const std::lock_guard lock(registry.mutex);
+		Accumulate(*this, registry.exited);
+		registry.threads.erase(std::find(registry.threads.begin(), registry.threads.end(), this));
+	}
+}
+
+inline instrument::ScopedTimer::~ScopedTimer()
+{
+	const auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_Start);
+	detail::ThreadCounters& counters = detail::GetThreadCounters();
+	detail::Add(counters.calls[static_cast<int32>(m_Timer)], 1);
+	detail::Add(counters.nanoseconds[static_cast<int32>(m_Timer)], static_cast<uint64_t>(duration.count()));
+}
+#endif
+
+inline constexpr bool instrument::IsEnabled() noexcept
+{
+#if defined(MATH_INSTRUMENTATION)
+	return true;
+#else
+	return false;
+#endif
+}
+
+inline instrument::Snapshot instrument::GetSnapshot()
+{
+	Snapshot snapshot;
+#if defined(MATH_INSTRUMENTATION)
+	detail::Registry& registry = detail::GetRegistry();
+	const std::lock_guard lock(registry.mutex);
+	const Snapshot totals = detail::GetTotals(registry);
+	for (int32 i = 0; i < static_cast<int32>(Counter::Count); ++i)
+		snapshot.counters[i] = totals.counters[i] - registry.baseline.counters[i];
+	for (int32 i = 0; i < static_cast<int32>(Timer::Count); ++i)
+	{
+		snapshot.calls[i] = totals.calls[i] - registry.baseline.calls[i];
+		snapshot.nanoseconds[i] = totals.nanoseconds[i] - registry.baseline.nanoseconds[i];
+	}
+#endif
+	return snapshot;
+}
+
+inline void instrument::Reset()
+{
+#if defined(MATH_INSTRUMENTATION)
+	// the counters are only written by their own threads so the totals are remembered instead of cleared
+	detail::Registry& registry = detail::GetRegistry();
+	const std::lock_guard lock(registry.mutex);
+	registry.baseline = detail::GetTotals(registry);
+#endif
+}
+
+inline void instrument::Export(const Snapshot& snapshot, std::ostream& stream)
+{
+	for (int32 i = 0; i < static_cast<int32>(Counter::Count); ++i)
+		stream << ToString(static_cast<Counter>(i)) << ' ' << snapshot.counters[i] << '\n';
+	for (int32 i = 0; i < static_cast<int32>(Timer::Count); ++i)
+		stream << ToString(static_cast<Timer>(i)) << ' ' << snapshot.calls[i] << ' ' << snapshot.nanoseconds[i] << '\n';
+}
+
+inline const char* instrument::ToString(const Counter counter) noexcept
+{
+	switch (counter)
+	{
+	case Counter::LimitVectors: return "batch_limit_vectors";
+	case Counter::LimitNaN: return "batch_limit_nan";
+	case Counter::NormalizeVectors: return "batch_normalize_vectors";
+	case Counter::NormalizeZeroLength: return "batch_normalize_zero_length";
+	case Counter::NormalizeNaN: return "batch_normalize_nan";
+	case Counter::Count: break;
+	}
+	return "unknown";
+}
+
+inline const char* instrument::ToString(const Timer timer) noexcept
+{
+	switch (timer)
+	{
+	case Timer::Clamp: return "batch_clamp";
+	case Timer::Lerp: return "batch_lerp";
+	case Timer::Limit: return "batch_limit";
+	case Timer::Normalize: return "batch_normalize";
+	case Timer::Remap: return "batch_remap";
+	case Timer::Count: break;
+	}
+	return "unknown";
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <Core/Math.h>
+#include <Core/Vector.h>
+
+#include <span>
+#include <type_traits>
+
+namespace math
+{
+	/// \brief How the values between two keyframes are interpolated.
+	enum class Interpolation
+	{
+		/// \brief Straight line between the values with math::Lerp.
+		Linear,
+		/// \brief Eases in and out of each key with math::SmoothStep applied to the time between the keys.
+		SmoothStep,
+		/// \brief Cubic curve through the values that leaves and arrives at each key with its tangent.
+		Hermite,
+		/// \brief Cubic bezier curve between the values that is bent towards two control points per segment.
+		Bezier,
+	};
+
+	/// \brief A structure of arrays of keys where times must be in ascending order without duplicates
+	/// and values must have the same size, there has to be at least one key.
+	///
+	/// The tangents are only used by Hermite, where there is one per key in units per second, and by Bezier
+	/// where there are two per segment, the first control point after key i followed by the one before key i + 1.
+	template<typename Type>
+	struct Keyframes
+	{
+		std::span<const float> times = {};
+		std::span<const Type> values = {};
+		std::span<const Type> tangents = {};
+	};
+
+	/// \brief Eases t in the range [0, 1] in and out with 3t^2 - 2t^3 so that the slope is 0 at both ends.
+	inline constexpr float SmoothStep(const float t) noexcept;
+
+	/// \brief Evaluates the cubic hermite curve that starts at a with tangent tangentA and ends at b with
+	/// tangent tangentB, where t is in the range [0, 1] and the tangents are scaled to that range.
+	template<typename Type = float>
+	inline constexpr Type Hermite(const Type& a, const Type& tangentA, const Type& b, const Type& tangentB, const float t) noexcept;
+
+	/// \brief Evaluates the cubic bezier curve from a to b with the control points controlA and controlB,
+	/// where t is in the range [0, 1].
+	template<typename Type = float>
+	inline constexpr Type Bezier(const Type& a, const Type& controlA, const Type& controlB, const Type& b, const float t) noexcept;
+
+	/// \brief Evaluates the keys at time, which is clamped to the first and last key.
+	/// The hint is the segment to check first and it is updated to the segment that contains time, so that
+	/// times that only move forward a little between calls don't have to search the keys.
+	template<Interpolation Mode, typename Type>
+	inline Type Interpolate(const Keyframes<Type>& keys, const float time, int32& hint) noexcept;
+	/// \brief Evaluates the keys at time, which is clamped to the first and last key.
+	template<Interpolation Mode, typename Type>
+	inline Type Interpolate(const Keyframes<Type>& keys, const float time) noexcept;
+
+	/// \brief Evaluates the keys at each time with the blending done in the widest registers, Type is deduced
+	/// from the keys so that the results can be any container that converts to a span.
+	/// The hint is updated after each time so the keys are only searched when the times aren't ascending.
+	/// Both spans must have the same size and the results match Interpolate at each time up to rounding.
+	template<Interpolation Mode, typename Type>
+	inline void Interpolate(const Keyframes<Type>& keys, std::span<const float> times, std::span<std::type_identity_t<Type>> results, int32& hint) noexcept;
+	/// \brief Evaluates the keys at each time with the blending done in the widest registers.
+	template<Interpolation Mode, typename Type>
+	inline void Interpolate(const Keyframes<Type>& keys, std::span<const float> times, std::span<std::type_identity_t<Type>> results) noexcept;
+}
@@ -0,0 +1,203 @@
+#pragma once
+
+#include <Core/Math.h>
+#include <Core/Simd.h>
+
+#include <algorithm>
+#include <concepts>
+
+namespace math::detail
+{
+	// returns the segment i where times[i] <= time < times[i + 1], clamped to the first and last segment
+	inline int32 FindSegment(std::span<const float> times, const float time, int32 hint) noexcept
+	{
+		const int32 last = static_cast<int32>(times.size()) - 2;
+		hint = math::Clamp(hint, 0, last);
+
+		// ascending times usually stay in the same segment or move into the next one
+		if (time >= times[hint])
+		{
+			if (hint == last || time < times[hint + 1])
+				return hint;
+			if (hint + 1 == last || time < times[hint + 2])
+				return hint + 1;
+		}
+		else if (hint == 0)
+		{
+			return 0;
+		}
+
+		const auto it = std::upper_bound(times.begin() + 1, times.end() - 1, time);
+		return static_cast<int32>(it - times.begin()) - 1;
+	}
+
+	template<typename Type>
+	inline const float* ToFloats(const Type* values) noexcept
+	{
+		if constexpr (std::same_as<Type, Vector2f>)
+			return &values->x;
+		else
+			return values;
+	}
+
+	template<typename Type>
+	inline float* ToFloats(Type* values) noexcept
+	{
+		if constexpr (std::same_as<Type, Vector2f>)
+			return &values->x;
+		else
+			return values;
+	}
+
+	// u is the time between the keys in [0, 1], a and b are the tangents or the control points
+	template<Interpolation Mode, typename Float>
+	inline Float Blend(const Float u, const Float duration, const Float p0, const Float a, const Float b, const Float p1) noexcept
+	{
+		const Float one = simd::Splat<Float>(1.f);
+		if constexpr (Mode == Interpolation::Linear)
+		{
+			return simd::MulAdd(simd::Sub(p1, p0), u, p0);
+		}
+		else if constexpr (Mode == Interpolation::SmoothStep)
+		{
+			const Float smooth = simd::Mul(simd::Mul(u, u), simd::Sub(simd::Splat<Float>(3.f), simd::Add(u, u)));
+			return simd::MulAdd(simd::Sub(p1, p0), smooth, p0);
+		}
+		else if constexpr (Mode == Interpolation::Hermite)
+		{
+			// h00 = 2u^3 - 3u^2 + 1, h10 = u^3 - 2u^2 + u, h01 = 3u^2 - 2u^3, h11 = u^3 - u^2
+			const Float u2 = simd::Mul(u, u);
+			const Float u3 = simd::Mul(u2, u);
+			const Float h01 = simd::Sub(simd::Mul(simd::Splat<Float>(3.f), u2), simd::Add(u3, u3));
+			const Float h00 = simd::Sub(one, h01);
+			const Float h11 = simd::Sub(u3, u2);
+			const Float h10 = simd::Add(simd::Sub(h11, u2), u);
+			// the tangents are in units per second so they are scaled by the duration of the segment
+			const Float result = simd::MulAdd(h00, p0, simd::Mul(h01, p1));
+			return simd::MulAdd(duration, simd::MulAdd(h10, a, simd::Mul(h11, b)), result);
+		}
+		else
+		{
+			const Float v = simd::Sub(one, u);
+			const Float three = simd::Splat<Float>(3.f);
+			const Float b0 = simd::Mul(simd::Mul(v, v), v);
+			const Float b1 = simd::Mul(simd::Mul(three, simd::Mul(v, v)), u);
+			const Float b2 = simd::Mul(simd::Mul(three, v), simd::Mul(u, u));
+			const Float b3 = simd::Mul(simd::Mul(u, u), u);
+			return simd::MulAdd(b0, p0, simd::MulAdd(b1, a, simd::MulAdd(b2, b, simd::Mul(b3, p1))));
+		}
+	}
+
+	template<Interpolation Mode, typename Type>
+	inline void Interpolate(const Keyframes<Type>& keys, const float* input, float* output, const int32 count, int32& hint) noexcept
+	{
+		constexpr int32 components = sizeof(Type) / sizeof(float);
+		const float* keyTimes = keys.times.data();
+		const float* values = ToFloats(keys.values.data());
+		const float* tangents = ToFloats(keys.tangents.data());
+
+		if (keys.times.size() == 1)
+		{
+			for (int32 i = 0; i < count * components; ++i)
+				output[i] = values[i % components];
+			hint = 0;
+			return;
+		}
+
+		int32 segment = hint;
+		simd::ForEach(count, [&]<typename Float>(const int32 i)
+		{
+			// the keys of each lane are gathered one at a time and then blended together
+			constexpr int32 lanes = sizeof(Float) / sizeof(float);
+			float starts[lanes], ends[lanes];
+			float p0[components][lanes], a[components][lanes], b[components][lanes], p1[components][lanes];
+			for (int32 lane = 0; lane < lanes; ++lane)
+			{
+				segment = FindSegment(keys.times, input[i + lane], segment);
+				starts[lane] = keyTimes[segment];
+				ends[lane] = keyTimes[segment + 1];
+				for (int32 c = 0; c < components; ++c)
+				{
+					p0[c][lane] = values[segment * components + c];
+					p1[c][lane] = values[(segment + 1) * components + c];
+					if constexpr (Mode == Interpolation::Hermite)
+					{
+						a[c][lane] = tangents[segment * components + c];
+						b[c][lane] = tangents[(segment + 1) * components + c];
+					}
+					else if constexpr (Mode == Interpolation::Bezier)
+					{
+						a[c][lane] = tangents[(segment * 2 + 0) * components + c];
+						b[c][lane] = tangents[(segment * 2 + 1) * components + c];
+					}
+					else
+					{
+						a[c][lane] = b[c][lane] = 0.f;
+					}
+				}
+			}
+
+			const Float start = simd::Load<Float>(starts);
+			const Float duration = simd::Sub(simd::Load<Float>(ends), start);
+			const Float time = simd::Min(simd::Max(simd::Div(simd::Sub(simd::Load<Float>(input + i), start), duration), simd::Splat<Float>(0.f)), simd::Splat<Float>(1.f));
+
+			Float results[components];
+			for (int32 c = 0; c < components; ++c)
+				results[c] = Blend<Mode>(time, duration, simd::Load<Float>(p0[c]), simd::Load<Float>(a[c]), simd::Load<Float>(b[c]), simd::Load<Float>(p1[c]));
+
+			if constexpr (components == 1)
+				simd::Store(output + i, results[0]);
+			else
+				simd::Interleave(output + i * 2, results[0], results[1]);
+		});
+		hint = segment;
+	}
+}
+
+inline constexpr float math::SmoothStep(const float t) noexcept
+{
+	return t * t * (3.f - 2.f * t);
+}
+
+template<typename Type>
+inline constexpr Type math::Hermite(const Type& a, const Type& tangentA, const Type& b, const Type& tangentB, const float t) noexcept
+{
+	const float t2 = t * t;
+	const float t3 = t2 * t;
+	return a * (2.f * t3 - 3.f * t2 + 1.f) + tangentA * (t3 - 2.f * t2 + t) + b * (3.f * t2 - 2.f * t3) + tangentB * (t3 - t2);
+}
+
+template<typename Type>
+inline constexpr Type math::Bezier(const Type& a, const Type& controlA, const Type& controlB, const Type& b, const float t) noexcept
+{
+	const float u = 1.f - t;
+	return a * (u * u * u) + controlA * (3.f * u * u * t) + controlB * (3.f * u * t * t) + b * (t * t * t);
+}
+
+template<math::Interpolation Mode, typename Type>
+inline Type math::Interpolate(const Keyframes<Type>& keys, const float time, int32& hint) noexcept
+{
+	Type result;
+	detail::Interpolate<Mode>(keys, &time, detail::ToFloats(&result), 1, hint);
+	return result;
+}
+
+template<math::Interpolation Mode, typename Type>
+inline Type math::Interpolate(const Keyframes<Type>& keys, const float time) noexcept
+{
+	int32 hint = 0;
+	return Interpolate<Mode>(keys, time, hint);
+}
+
+template<math::Interpolation Mode, typename Type>
+inline void math::Interpolate(const Keyframes<Type>& keys, std::span<const float> times, std::span<std::type_identity_t<Type>> results, int32& hint) noexcept
+{
+	detail::Interpolate<Mode>(keys, times.data(), detail::ToFloats(results.data()), static_cast<int32>(times.size()), hint);
+}
+
+template<math::Interpolation Mode, typename Type>
+inline void math::Interpolate(const Keyframes<Type>& keys, std::span<const float> times, std::span<std::type_identity_t<Type>> results) noexcept
+{
+	int32 hint = 0;
+	Interpolate<Mode>(keys, times, results, hint);
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstddef>
+#include <span>
+
+/// \brief A file that has been memory-mapped as read only, it is unmapped when it is destroyed.
+///
+/// MappedFile.inl includes windows.h or the POSIX headers so it isn't part of Core.h, only the translation
+/// units that map files include it.
+class MappedFile
+{
+public:
+	/// \brief Construct a file that isn't mapped.
+	MappedFile() noexcept = default;
+	MappedFile(const MappedFile& rhs) = delete;
+	MappedFile(MappedFile&& rhs) noexcept;
+	~MappedFile();
+
+	MappedFile& operator=(const MappedFile& rhs) = delete;
+	MappedFile& operator=(MappedFile&& rhs) noexcept;
+
+	/// \brief Maps the whole file at path, it returns false if it can't be opened or mapped.
+	/// An empty file is opened successfully with no bytes.
+	bool Open(const char* path) noexcept;
+	/// \brief Unmaps the file, any view of its bytes is invalid afterwards.
+	void Close() noexcept;
+
+	/// \brief Returns the bytes of the file which are aligned to the page size.
+	std::span<const std::byte> GetBytes() const noexcept { return std::span(m_Data, m_Size); }
+	/// \brief Returns true if a file is mapped.
+	bool IsOpen() const noexcept { return m_IsOpen; }
+
+private:
+	const std::byte* m_Data = nullptr;
+	size_t m_Size = 0;
+	bool m_IsOpen = false;
+};
@@ -0,0 +1,123 @@
+#pragma once
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+inline MappedFile::MappedFile(MappedFile&& rhs) noexcept
+	: m_Data(rhs.m_Data)
+	, m_Size(rhs.m_Size)
+	, m_IsOpen(rhs.m_IsOpen)
+{
+	rhs.m_Data = nullptr;
+	rhs.m_Size = 0;
+	rhs.m_IsOpen = false;
+}
+
+inline MappedFile::~MappedFile()
+{
+	Close();
+}
+
+inline MappedFile& MappedFile::operator=(MappedFile&& rhs) noexcept
+{
+	if (this != &rhs)
+	{
+		Close();
+		m_Data = rhs.m_Data;
+		m_Size = rhs.m_Size;
+		m_IsOpen = rhs.m_IsOpen;
+		rhs.m_Data = nullptr;
+		rhs.m_Size = 0;
+		rhs.m_IsOpen = false;
+	}
+	return *this;
+}
+
+inline bool MappedFile::Open(const char* path) noexcept
+{
+	Close();
+
+	// the handles are closed straight away because the mapping keeps the file open by itself
+#if defined(_WIN32)
+	const HANDLE file = ::CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file == INVALID_HANDLE_VALUE)
+		return false;
+
+	LARGE_INTEGER size;
+	if (!::GetFileSizeEx(file, &size))
+	{
+		::CloseHandle(file);
+		return false;
+	}
+
+	if (size.QuadPart > 0)
+	{
+		const HANDLE mapping = ::CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		const void* data = mapping ? ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+		if (mapping)
+			::CloseHandle(mapping);
+		if (!data)
+		{
+			::CloseHandle(file);
+			return false;
+		}
+		m_Data = static_cast<const std::byte*>(data);
+		m_Size = static_cast<size_t>(size.QuadPart);
+	}
+	::CloseHandle(file);
+#else
+	const int file = ::open(path, O_RDONLY);
+	if (file < 0)
+		return false;
+
+	struct stat status;
+	if (::fstat(file, &status) != 0)
+	{
+		::close(file);
+		return false;
+	}
+
+	if (status.st_size > 0)
+	{
+		void* data = ::mmap(nullptr, static_cast<size_t>(status.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+		if (data == MAP_FAILED)
+		{
+			::close(file);
+			return false;
+		}
+		m_Data = static_cast<const std::byte*>(data);
+		m_Size = static_cast<size_t>(status.st_size);
+	}
+	::close(file);
+#endif
+
+	m_IsOpen = true;
+	return true;
+}
+
+inline void MappedFile::Close() noexcept
+{
+	if (m_Data)
+	{
+#if defined(_WIN32)
+		::UnmapViewOfFile(m_Data);
+#else
+		::munmap(const_cast<std::byte*>(m_Data), m_Size);
+#endif
+	}
+	m_Data = nullptr;
+	m_Size = 0;
+	m_IsOpen = false;
+}
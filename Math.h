@@ -1,6 +1,20 @@
 #pragma once
 
 #include <cmath>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <type_traits>
+
+// the scalar integer conversions and the reciprocal square root estimate use the single float instructions
+// directly so that they don't need the simd layer, MATH_SIMD_SCALAR forces the portable code like it does there
+#if !defined(MATH_SIMD_SCALAR) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define MATH_SCALAR_SSE2
+#include <xmmintrin.h>
+#elif !defined(MATH_SIMD_SCALAR) && (defined(__aarch64__) || defined(_M_ARM64))
+#define MATH_SCALAR_NEON
+#include <arm_neon.h>
+#endif
 
 using int32 = int32_t;
 
@@ -22,6 +36,137 @@ constexpr float DIAGONAL_3D = SQUARE_ROOT_THREE;
 
 namespace math
 {
+	/// \brief Portable implementations that are only used during constant evaluation, they compute
+	/// in double precision so that the result is rounded once when converted back to a float.
+	namespace detail
+	{
+		inline constexpr float Floor(const float value) noexcept
+		{
+			// every float with a magnitude of at least 2^23 is already a whole number
+			if (!(value < 8388608.f && value > -8388608.f))
+				return value;
+			const int64_t truncated = static_cast<int64_t>(value);
+			return static_cast<float>(static_cast<float>(truncated) > value ? truncated - 1 : truncated);
+		}
+
+		inline constexpr float Ceiling(const float value) noexcept
+		{
+			if (!(value < 8388608.f && value > -8388608.f))
+				return value;
+			const int64_t truncated = static_cast<int64_t>(value);
+			return static_cast<float>(static_cast<float>(truncated) < value ? truncated + 1 : truncated);
+		}
+
+		inline constexpr float Round(const float value) noexcept
+		{
+			if (!(value < 8388608.f && value > -8388608.f))
+				return value;
+			const double half = (value < 0.f) ? -0.5 : 0.5;
+			return static_cast<float>(static_cast<int64_t>(static_cast<double>(value) + half));
+		}
+
+		inline constexpr float RoundEven(const float value) noexcept
+		{
+			// Round moves ties away from zero, move them back towards zero when that made the result odd
+			const float rounded = Round(value);
+			const float difference = rounded - value;
+			if ((difference == 0.5f || difference == -0.5f) && static_cast<int64_t>(rounded) % 2 != 0)
+				return rounded - difference * 2.f;
+			return rounded;
+		}
+
+		inline constexpr double Sqrt(const double value) noexcept
+		{
+			if (value == 0.0 || value == std::numeric_limits<double>::infinity())
+				return value;
+			if (!(value > 0.0))
+				return std::numeric_limits<double>::quiet_NaN();
+
+			// newton-raphson converges monotonically when starting above the root
+			double result = (value > 1.0) ? value : 1.0;
+			while (true)
+			{
+				const double next = 0.5 * (result + value / result);
+				if (next >= result)
+					return result;
+				result = next;
+			}
+		}
+
+		inline constexpr double Sin(double value) noexcept
+		{
+			constexpr double pi = 3.14159265358979323846;
+			value -= static_cast<double>(static_cast<int64_t>(value / (2.0 * pi) + (value < 0.0 ? -0.5 : 0.5))) * (2.0 * pi);
+
+			// taylor series which converges to double precision within [-pi, pi]
+			double term = value, result = value;
+			for (int32 i = 1; i < 20; ++i)
+			{
+				term *= -value * value / ((2.0 * i) * (2.0 * i + 1.0));
+				result += term;
+			}
+			return result;
+		}
+
+		inline constexpr double Cos(const double value) noexcept
+		{
+			constexpr double pi = 3.14159265358979323846;
+			return Sin(value + pi * 0.5);
+		}
+
+		inline constexpr double Atan(double value) noexcept
+		{
+			constexpr double pi = 3.14159265358979323846;
+			if (value > 1.0)
+				return pi * 0.5 - Atan(1.0 / value);
+			if (value < -1.0)
+				return -pi * 0.5 - Atan(1.0 / value);
+
+			// shift the input towards 0 so that the taylor series converges quickly
+			double offset = 0.0;
+			if (value > 0.4142135623730950)
+			{
+				offset = pi * 0.25;
+				value = (value - 1.0) / (value + 1.0);
+			}
+			else if (value < -0.4142135623730950)
+			{
+				offset = -pi * 0.25;
+				value = (value + 1.0) / (1.0 - value);
+			}
+
+			double term = value, result = value;
+			for (int32 i = 1; i < 40; ++i)
+			{
+				term *= -value * value;
+				result += term / (2.0 * i + 1.0);
+			}
+			return result + offset;
+		}
+
+		inline constexpr double Atan2(const double y, const double x) noexcept
+		{
+			constexpr double pi = 3.14159265358979323846;
+			if (x > 0.0)
+				return Atan(y / x);
+			if (x < 0.0)
+				return (y < 0.0) ? Atan(y / x) - pi : Atan(y / x) + pi;
+			if (y > 0.0)
+				return pi * 0.5;
+			if (y < 0.0)
+				return -pi * 0.5;
+			return 0.0;
+		}
+	}
+
+	/// \brief Returns the angle in radians between the positive x axis and the point (x, y) in the range [-PI, PI].
+	inline constexpr float Atan2(const float y, const float x) noexcept
+	{
+		if (std::is_constant_evaluated())
+			return static_cast<float>(detail::Atan2(y, x));
+		return std::atan2(y, x);
+	}
+
 	/// \brief Clamps value between min and max so that it doesn't exceed either.
 	template<typename Type = float>
 	inline constexpr Type Clamp(const Type& value, const Type& min, const Type& max) noexcept
@@ -31,32 +176,92 @@ namespace math
 
 	/// \brief Rounds value to the nearest whole value towards +infinity.
 	template<typename Type = float>
-	inline Type Ceiling(const float value) noexcept
+	inline constexpr Type Ceiling(const float value) noexcept
 	{
-		return static_cast<Type>(std::ceilf(value));
+		if (std::is_constant_evaluated())
+			return static_cast<Type>(detail::Ceiling(value));
+		return static_cast<Type>(std::ceil(value));
 	}
 
 	/// \brief Rounds value to the nearest multiplier towards +infinity.
 	template<typename Type = float>
-	inline Type Ceiling(const float value, const float multiplier) noexcept
+	inline constexpr Type Ceiling(const float value, const float multiplier) noexcept
 	{
 		return Ceiling<Type>(value / multiplier) * multiplier;
 	}
 
+	/// \brief Rounds value to the nearest whole value towards +infinity and converts it to an integer.
+	/// The result must be within the range of an int32.
+	inline constexpr int32 CeilingToInt(const float value) noexcept
+	{
+		// the float of a truncated int32 is exact below 2^24 and every float above that is already whole
+		const int32 truncated = static_cast<int32>(value);
+		return static_cast<float>(truncated) < value ? truncated + 1 : truncated;
+	}
+
+	/// \brief Returns the number of multipliers that value rounds to towards +infinity, ie. the cell of a grid.
+	/// The reciprocal is 1 / multiplier so that the divide can be done once for many values.
+	inline constexpr int32 CeilingToInt(const float value, const float reciprocal) noexcept
+	{
+		return CeilingToInt(value * reciprocal);
+	}
+
+	/// \brief Writes each value rounded towards +infinity as an integer into results.
+	/// Both spans must have the same size.
+	inline void CeilingToInt(std::span<const float> values, std::span<int32> results) noexcept;
+
+	/// \brief Writes the number of multipliers that each value rounds to towards +infinity into results.
+	/// The reciprocal is 1 / multiplier and both spans must have the same size.
+	inline void CeilingToInt(std::span<const float> values, const float reciprocal, std::span<int32> results) noexcept;
+
+	/// \brief Returns the cosine of an angle in radians.
+	inline constexpr float Cos(const float radians) noexcept
+	{
+		if (std::is_constant_evaluated())
+			return static_cast<float>(detail::Cos(radians));
+		return std::cos(radians);
+	}
+
 	/// \brief Rounds value to the nearest whole value towards -infinity.
 	template<typename Type = float>
-	inline Type Floor(const float value) noexcept
+	inline constexpr Type Floor(const float value) noexcept
 	{
-		return static_cast<Type>(std::floorf(value));
+		if (std::is_constant_evaluated())
+			return static_cast<Type>(detail::Floor(value));
+		return static_cast<Type>(std::floor(value));
 	}
 
 	/// \brief Rounds value to the nearest multiplier towards -infinity.
 	template<typename Type = float>
-	inline Type Floor(const float value, const float multiplier) noexcept
+	inline constexpr Type Floor(const float value, const float multiplier) noexcept
 	{
 		return Floor<Type>(value / multiplier) * multiplier;
 	}
 
+	/// \brief Rounds value to the nearest whole value towards -infinity and converts it to an integer.
+	/// The result must be within the range of an int32.
+	inline constexpr int32 FloorToInt(const float value) noexcept
+	{
+		// the float of a truncated int32 is exact below 2^24 and every float above that is already whole
+		const int32 truncated = static_cast<int32>(value);
+		return static_cast<float>(truncated) > value ? truncated - 1 : truncated;
+	}
+
+	/// \brief Returns the number of multipliers that value rounds to towards -infinity, ie. the cell of a grid.
+	/// The reciprocal is 1 / multiplier so that the divide can be done once for many values.
+	inline constexpr int32 FloorToInt(const float value, const float reciprocal) noexcept
+	{
+		return FloorToInt(value * reciprocal);
+	}
+
+	/// \brief Writes each value rounded towards -infinity as an integer into results.
+	/// Both spans must have the same size.
+	inline void FloorToInt(std::span<const float> values, std::span<int32> results) noexcept;
+
+	/// \brief Writes the number of multipliers that each value rounds to towards -infinity into results.
+	/// The reciprocal is 1 / multiplier and both spans must have the same size.
+	inline void FloorToInt(std::span<const float> values, const float reciprocal, std::span<int32> results) noexcept;
+
 	/// \brief Linearly interpolations from a -> b based on t.
 	template<typename Type = float>
 	inline constexpr Type Lerp(const Type& a, const Type& b, const float t) noexcept
@@ -89,24 +294,85 @@ namespace math
 
 	/// \brief Rounds the value towards the nearest whole number away from zero.
 	template<typename Type = float>
-	inline Type Round(const float value) noexcept
+	inline constexpr Type Round(const float value) noexcept
 	{
-		return static_cast<Type>(std::roundf(value));
+		if (std::is_constant_evaluated())
+			return static_cast<Type>(detail::Round(value));
+		return static_cast<Type>(std::round(value));
 	}
 
 	/// \brief Rounds the value towards the nearest multiplier away from zero.
 	template<typename Type = float>
-	inline Type Round(const float value, const float multiplier) noexcept
+	inline constexpr Type Round(const float value, const float multiplier) noexcept
 	{
 		return Round<Type>(value / multiplier) * multiplier;
 	}
 
+	/// \brief Rounds the value towards the nearest whole number and converts it to an integer.
+	/// Unlike Round the ties go to the even number which is what the hardware conversion does.
+	/// The result must be within the range of an int32.
+	inline constexpr int32 RoundToInt(const float value) noexcept
+	{
+		if (std::is_constant_evaluated())
+			return static_cast<int32>(detail::RoundEven(value));
+#if defined(MATH_SCALAR_SSE2)
+		return _mm_cvtss_si32(_mm_set_ss(value));
+#elif defined(MATH_SCALAR_NEON)
+		return vcvtns_s32_f32(value);
+#else
+		return static_cast<int32>(std::nearbyint(value));
+#endif
+	}
+
+	/// \brief Returns the number of multipliers that value rounds to, ie. the nearest point of a grid.
+	/// The reciprocal is 1 / multiplier so that the divide can be done once for many values.
+	inline constexpr int32 RoundToInt(const float value, const float reciprocal) noexcept
+	{
+		return RoundToInt(value * reciprocal);
+	}
+
+	/// \brief Writes each value rounded towards the nearest whole number as an integer into results.
+	/// Both spans must have the same size.
+	inline void RoundToInt(std::span<const float> values, std::span<int32> results) noexcept;
+
+	/// \brief Writes the number of multipliers that each value rounds to into results.
+	/// The reciprocal is 1 / multiplier and both spans must have the same size.
+	inline void RoundToInt(std::span<const float> values, const float reciprocal, std::span<int32> results) noexcept;
+
+	/// \brief Returns an approximation of the reciprocal squared root of the value.
+	/// Uses the hardware estimate refined with Newton-Raphson which has a max relative error of 4e-7.
+	/// The value must be a positive normal number, 0 and denormals return NaN.
+	inline constexpr float RSqrtFast(const float value) noexcept
+	{
+		if (std::is_constant_evaluated())
+			return static_cast<float>(1.0 / detail::Sqrt(value));
+#if defined(MATH_SCALAR_SSE2)
+		const float estimate = _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(value)));
+		return 0.5f * estimate * (3.f - value * estimate * estimate);
+#elif defined(MATH_SCALAR_NEON)
+		// the neon estimate is only accurate to 8 bits so it needs an extra step
+		float estimate = vrsqrtes_f32(value);
+		estimate *= vrsqrtss_f32(value * estimate, estimate);
+		return estimate * vrsqrtss_f32(value * estimate, estimate);
+#else
+		return 1.f / std::sqrt(value);
+#endif
+	}
+
 	/// \brief Returns -1 for a negative number and +1 for a positive number.
 	inline constexpr float Sign(float value) noexcept
 	{
 		return (value < 0.0f) ? -1.0f : 1.0f;
 	}
 
+	/// \brief Returns the sine of an angle in radians.
+	inline constexpr float Sin(const float radians) noexcept
+	{
+		if (std::is_constant_evaluated())
+			return static_cast<float>(detail::Sin(radians));
+		return std::sin(radians);
+	}
+
 	/// \brief Returns the squared value of the value.
 	template<typename Type = float>
 	inline constexpr float Sqr(const Type value) noexcept
@@ -115,8 +381,10 @@ namespace math
 	}
 
 	/// \brief Returns the squared root of the value.
-	inline float Sqrt(const float value) noexcept
+	inline constexpr float Sqrt(const float value) noexcept
 	{
+		if (std::is_constant_evaluated())
+			return static_cast<float>(detail::Sqrt(value));
 		return sqrtf(value);
 	}
 
@@ -132,3 +400,33 @@ namespace math
 		return degrees * 0.0174533f;
 	}
 }
+
+// The common instantiations of the templates are compiled once in Instantiations.cpp by the math library,
+// which defines MATH_EXTERN_TEMPLATES for every target that links it. They are still inlined and evaluated
+// at compile time, the declarations only stop each translation unit from instantiating its own copy.
+#if defined(MATH_EXTERN_TEMPLATES)
+namespace math
+{
+	extern template float Ceiling<float>(const float) noexcept;
+	extern template float Ceiling<float>(const float, const float) noexcept;
+	extern template float Clamp<float>(const float&, const float&, const float&) noexcept;
+	extern template float Floor<float>(const float) noexcept;
+	extern template float Floor<float>(const float, const float) noexcept;
+	extern template float Lerp<float>(const float&, const float&, const float) noexcept;
+	extern template float Max<float>(const float&, const float&) noexcept;
+	extern template float Min<float>(const float&, const float&) noexcept;
+	extern template float Remap<float>(float, const float&, const float&, const float&, const float&) noexcept;
+	extern template float Round<float>(const float) noexcept;
+	extern template float Round<float>(const float, const float) noexcept;
+	extern template float Sqr<float>(const float) noexcept;
+
+	extern template int32 Ceiling<int32>(const float) noexcept;
+	extern template int32 Clamp<int32>(const int32&, const int32&, const int32&) noexcept;
+	extern template int32 Floor<int32>(const float) noexcept;
+	extern template int32 Max<int32>(const int32&, const int32&) noexcept;
+	extern template int32 Min<int32>(const int32&, const int32&) noexcept;
+	extern template int32 Remap<int32>(int32, const int32&, const int32&, const int32&, const int32&) noexcept;
+	extern template int32 Round<int32>(const float) noexcept;
+	extern template float Sqr<int32>(const int32) noexcept;
+}
+#endif
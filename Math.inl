@@ -0,0 +1,64 @@
+#pragma once
+
+#include <Core/Math.h>
+#include <Core/Simd.h>
+
+inline void math::CeilingToInt(std::span<const float> values, std::span<int32> results) noexcept
+{
+	const float* input = values.data();
+	int32* output = results.data();
+	simd::ForEach(static_cast<int32>(values.size()), [&]<typename Float>(const int32 i)
+	{
+		simd::StoreInt(output + i, simd::Ceiling(simd::Load<Float>(input + i)));
+	});
+}
+
+inline void math::CeilingToInt(std::span<const float> values, const float reciprocal, std::span<int32> results) noexcept
+{
+	const float* input = values.data();
+	int32* output = results.data();
+	simd::ForEach(static_cast<int32>(values.size()), [&]<typename Float>(const int32 i)
+	{
+		simd::StoreInt(output + i, simd::Ceiling(simd::Mul(simd::Load<Float>(input + i), simd::Splat<Float>(reciprocal))));
+	});
+}
+
+inline void math::FloorToInt(std::span<const float> values, std::span<int32> results) noexcept
+{
+	const float* input = values.data();
+	int32* output = results.data();
+	simd::ForEach(static_cast<int32>(values.size()), [&]<typename Float>(const int32 i)
+	{
+		simd::StoreInt(output + i, simd::Floor(simd::Load<Float>(input + i)));
+	});
+}
+
+inline void math::FloorToInt(std::span<const float> values, const float reciprocal, std::span<int32> results) noexcept
+{
+	const float* input = values.data();
+	int32* output = results.data();
+	simd::ForEach(static_cast<int32>(values.size()), [&]<typename Float>(const int32 i)
+	{
+		simd::StoreInt(output + i, simd::Floor(simd::Mul(simd::Load<Float>(input + i), simd::Splat<Float>(reciprocal))));
+	});
+}
+
+inline void math::RoundToInt(std::span<const float> values, std::span<int32> results) noexcept
+{
+	const float* input = values.data();
+	int32* output = results.data();
+	simd::ForEach(static_cast<int32>(values.size()), [&]<typename Float>(const int32 i)
+	{
+		simd::StoreInt(output + i, simd::Round(simd::Load<Float>(input + i)));
+	});
+}
+
+inline void math::RoundToInt(std::span<const float> values, const float reciprocal, std::span<int32> results) noexcept
+{
+	const float* input = values.data();
+	int32* output = results.data();
+	simd::ForEach(static_cast<int32>(values.size()), [&]<typename Float>(const int32 i)
+	{
+		simd::StoreInt(output + i, simd::Round(simd::Mul(simd::Load<Float>(input + i), simd::Splat<Float>(reciprocal))));
+	});
+}
@@ -0,0 +1,157 @@
+#pragma once
+
+#include <Core/Quaternion.h>
+#include <Core/Vector.h>
+#include <Core/VectorAligned.h>
+#include <Core/VectorStream.h>
+
+#include <span>
+
+/// \brief A 3x3 row-major matrix that transforms row vectors, ie. result = vector * matrix.
+/// It can be used as an affine transform in 2d with the translation in the last row or as a rotation and scale in 3d.
+/// Multiplying a * b produces the transform that applies a first and then b.
+class Matrix3x3f
+{
+public:
+	/// \brief Construct a new matrix with all members initialized to 0.
+	constexpr Matrix3x3f() noexcept : m() {}
+	/// \brief Construct a new matrix with members initialized to the values in row-major order.
+	constexpr explicit Matrix3x3f(
+		const float m00, const float m01, const float m02,
+		const float m10, const float m11, const float m12,
+		const float m20, const float m21, const float m22) noexcept
+		: m{ { m00, m01, m02 }, { m10, m11, m12 }, { m20, m21, m22 } } {}
+
+	/// \brief Returns true if all members are identical.
+	constexpr bool operator==(const Matrix3x3f& rhs) const noexcept;
+	/// \brief Returns true if any members aren't identical.
+	constexpr bool operator!=(const Matrix3x3f& rhs) const noexcept { return !(*this == rhs); }
+
+	/// \brief Multiplies the two matrices and returns the result in a new matrix.
+	constexpr Matrix3x3f operator*(const Matrix3x3f& rhs) const noexcept;
+	/// \brief Multiplies the two matrices, stores the result in this matrix and returns a reference.
+	constexpr Matrix3x3f& operator*=(const Matrix3x3f& rhs) noexcept { return *this = *this * rhs; }
+
+	/// \brief Returns the determinant of this matrix.
+	constexpr float Determinant() const noexcept;
+
+	/// \brief Returns the inverse of this matrix.
+	/// If the determinant of the matrix is 0 then it returns a NaN matrix.
+	[[nodiscard]] constexpr Matrix3x3f Inversed() const noexcept;
+	/// \brief Returns the matrix with its rows and columns swapped.
+	[[nodiscard]] constexpr Matrix3x3f Transposed() const noexcept;
+
+	/// \brief Transforms a position in 2d which includes the translation.
+	constexpr Vector2f TransformPoint(const Vector2f& point) const noexcept;
+	/// \brief Transforms a direction in 2d which excludes the translation.
+	constexpr Vector2f TransformVector(const Vector2f& vector) const noexcept;
+	/// \brief Transforms a vector in 3d.
+	constexpr Vector3f TransformVector(const Vector3f& vector) const noexcept;
+
+	/// \brief Returns a 2d transform that rotates by radians (counter-clockwise).
+	static Matrix3x3f FromRotation(const float radians) noexcept;
+	/// \brief Returns a 2d transform that scales each axis.
+	static constexpr Matrix3x3f FromScale(const Vector2f& scale) noexcept;
+	/// \brief Returns a 2d transform that translates.
+	static constexpr Matrix3x3f FromTranslation(const Vector2f& translation) noexcept;
+	/// \brief Returns a 2d transform that scales, then rotates by radians (counter-clockwise) and then translates.
+	static Matrix3x3f FromTransform(const Vector2f& translation, const float radians, const Vector2f& scale) noexcept;
+
+	/// \brief Shorthand for the matrix that doesn't transform.
+	static const Matrix3x3f Identity;
+
+public:
+	float m[3][3];
+};
+
+/// \brief A 4x4 row-major matrix that transforms row vectors, ie. result = vector * matrix.
+/// It is used as an affine transform in 3d with the translation in the last row.
+/// Multiplying a * b produces the transform that applies a first and then b.
+class alignas(16) Matrix4x4f
+{
+public:
+	/// \brief Construct a new matrix with all members initialized to 0.
+	constexpr Matrix4x4f() noexcept : m() {}
+	/// \brief Construct a new matrix with members initialized to the values in row-major order.
+	constexpr explicit Matrix4x4f(
+		const float m00, const float m01, const float m02, const float m03,
+		const float m10, const float m11, const float m12, const float m13,
+		const float m20, const float m21, const float m22, const float m23,
+		const float m30, const float m31, const float m32, const float m33) noexcept
+		: m{ { m00, m01, m02, m03 }, { m10, m11, m12, m13 }, { m20, m21, m22, m23 }, { m30, m31, m32, m33 } } {}
+
+	/// \brief Returns true if all members are identical.
+	constexpr bool operator==(const Matrix4x4f& rhs) const noexcept;
+	/// \brief Returns true if any members aren't identical.
+	constexpr bool operator!=(const Matrix4x4f& rhs) const noexcept { return !(*this == rhs); }
+
+	/// \brief Multiplies the two matrices and returns the result in a new matrix.
+	Matrix4x4f operator*(const Matrix4x4f& rhs) const noexcept;
+	/// \brief Multiplies the two matrices, stores the result in this matrix and returns a reference.
+	Matrix4x4f& operator*=(const Matrix4x4f& rhs) noexcept { return *this = *this * rhs; }
+
+	/// \brief Returns the determinant of this matrix.
+	constexpr float Determinant() const noexcept;
+
+	/// \brief Returns the inverse of this matrix.
+	/// If the determinant of the matrix is 0 then it returns a NaN matrix.
+	[[nodiscard]] constexpr Matrix4x4f Inversed() const noexcept;
+	/// \brief Returns the matrix with its rows and columns swapped.
+	[[nodiscard]] constexpr Matrix4x4f Transposed() const noexcept;
+
+	/// \brief Transforms a position which includes the translation.
+	constexpr Vector3f TransformPoint(const Vector3f& point) const noexcept;
+	/// \brief Transforms a position which includes the translation.
+	Vector3fA TransformPoint(const Vector3fA& point) const noexcept;
+	/// \brief Transforms a direction which excludes the translation.
+	constexpr Vector3f TransformVector(const Vector3f& vector) const noexcept;
+	/// \brief Transforms a direction which excludes the translation.
+	Vector3fA TransformVector(const Vector3fA& vector) const noexcept;
+
+	/// \brief Returns a transform that rotates.
+	static Matrix4x4f FromRotation(const Quaternion& rotation) noexcept;
+	/// \brief Returns a transform that scales each axis.
+	static constexpr Matrix4x4f FromScale(const Vector3f& scale) noexcept;
+	/// \brief Returns a transform that translates.
+	static constexpr Matrix4x4f FromTranslation(const Vector3f& translation) noexcept;
+	/// \brief Returns a transform that scales, then rotates and then translates.
+	static Matrix4x4f FromTransform(const Vector3f& translation, const Quaternion& rotation, const Vector3f& scale) noexcept;
+
+	/// \brief Shorthand for the matrix that doesn't transform.
+	static const Matrix4x4f Identity;
+
+public:
+	float m[4][4];
+};
+
+inline constexpr Matrix3x3f Matrix3x3f::Identity(
+	1.f, 0.f, 0.f,
+	0.f, 1.f, 0.f,
+	0.f, 0.f, 1.f);
+
+inline constexpr Matrix4x4f Matrix4x4f::Identity(
+	1.f, 0.f, 0.f, 0.f,
+	0.f, 1.f, 0.f, 0.f,
+	0.f, 0.f, 1.f, 0.f,
+	0.f, 0.f, 0.f, 1.f);
+
+/// \brief The batch transforms stream through the input several vectors at a time without a call per vector.
+/// The input and output spans must have the same size and they are allowed to be the same span.
+namespace math
+{
+	/// \brief Transforms each position in 2d, including the translation.
+	inline void TransformPoints(const Matrix3x3f& matrix, std::span<const Vector2f> values, std::span<Vector2f> results) noexcept;
+	/// \brief Transforms each position in 2d in place, including the translation.
+	inline void TransformPoints(const Matrix3x3f& matrix, Vector2fStream& values) noexcept;
+	/// \brief Transforms each position in 3d, including the translation.
+	inline void TransformPoints(const Matrix4x4f& matrix, std::span<const Vector3f> values, std::span<Vector3f> results) noexcept;
+	/// \brief Transforms each position in 3d, including the translation.
+	inline void TransformPoints(const Matrix4x4f& matrix, std::span<const Vector3fA> values, std::span<Vector3fA> results) noexcept;
+
+	/// \brief Transforms each direction in 2d, excluding the translation.
+	inline void TransformVectors(const Matrix3x3f& matrix, std::span<const Vector2f> values, std::span<Vector2f> results) noexcept;
+	/// \brief Transforms each direction in 3d.
+	inline void TransformVectors(const Matrix3x3f& matrix, std::span<const Vector3f> values, std::span<Vector3f> results) noexcept;
+	/// \brief Transforms each direction in 3d, excluding the translation.
+	inline void TransformVectors(const Matrix4x4f& matrix, std::span<const Vector3f> values, std::span<Vector3f> results) noexcept;
+}
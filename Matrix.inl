@@ -0,0 +1,388 @@
+#pragma once
+
+#include <Core/Math.h>
+#include <Core/Simd.h>
+
+#include <cmath>
+
+inline constexpr bool Matrix3x3f::operator==(const Matrix3x3f& rhs) const noexcept
+{
+	for (int32 i = 0; i < 3; ++i)
+		for (int32 j = 0; j < 3; ++j)
+			if (m[i][j] != rhs.m[i][j])
+				return false;
+	return true;
+}
+
+inline constexpr Matrix3x3f Matrix3x3f::operator*(const Matrix3x3f& rhs) const noexcept
+{
+	Matrix3x3f result;
+	for (int32 i = 0; i < 3; ++i)
+	{
+		for (int32 j = 0; j < 3; ++j)
+			result.m[i][j] = m[i][0] * rhs.m[0][j] + m[i][1] * rhs.m[1][j] + m[i][2] * rhs.m[2][j];
+	}
+	return result;
+}
+
+inline constexpr float Matrix3x3f::Determinant() const noexcept
+{
+	return
+		m[0][0] * (m[1][1] * m[2][2] - m[1][2] * m[2][1]) -
+		m[0][1] * (m[1][0] * m[2][2] - m[1][2] * m[2][0]) +
+		m[0][2] * (m[1][0] * m[2][1] - m[1][1] * m[2][0]);
+}
+
+inline constexpr Matrix3x3f Matrix3x3f::Inversed() const noexcept
+{
+	const float inverse = 1.f / Determinant();
+	return Matrix3x3f(
+		(m[1][1] * m[2][2] - m[1][2] * m[2][1]) * inverse,
+		(m[0][2] * m[2][1] - m[0][1] * m[2][2]) * inverse,
+		(m[0][1] * m[1][2] - m[0][2] * m[1][1]) * inverse,
+		(m[1][2] * m[2][0] - m[1][0] * m[2][2]) * inverse,
+		(m[0][0] * m[2][2] - m[0][2] * m[2][0]) * inverse,
+		(m[0][2] * m[1][0] - m[0][0] * m[1][2]) * inverse,
+		(m[1][0] * m[2][1] - m[1][1] * m[2][0]) * inverse,
+		(m[0][1] * m[2][0] - m[0][0] * m[2][1]) * inverse,
+		(m[0][0] * m[1][1] - m[0][1] * m[1][0]) * inverse);
+}
+
+inline constexpr Matrix3x3f Matrix3x3f::Transposed() const noexcept
+{
+	return Matrix3x3f(
+		m[0][0], m[1][0], m[2][0],
+		m[0][1], m[1][1], m[2][1],
+		m[0][2], m[1][2], m[2][2]);
+}
+
+inline constexpr Vector2f Matrix3x3f::TransformPoint(const Vector2f& point) const noexcept
+{
+	return Vector2f(
+		point.x * m[0][0] + point.y * m[1][0] + m[2][0],
+		point.x * m[0][1] + point.y * m[1][1] + m[2][1]);
+}
+
+inline constexpr Vector2f Matrix3x3f::TransformVector(const Vector2f& vector) const noexcept
+{
+	return Vector2f(
+		vector.x * m[0][0] + vector.y * m[1][0],
+		vector.x * m[0][1] + vector.y * m[1][1]);
+}
+
+inline constexpr Vector3f Matrix3x3f::TransformVector(const Vector3f& vector) const noexcept
+{
+	return Vector3f(
+		vector.x * m[0][0] + vector.y * m[1][0] + vector.z * m[2][0],
+		vector.x * m[0][1] + vector.y * m[1][1] + vector.z * m[2][1],
+		vector.x * m[0][2] + vector.y * m[1][2] + vector.z * m[2][2]);
+}
+
+inline Matrix3x3f Matrix3x3f::FromRotation(const float radians) noexcept
+{
+	const float sin = std::sin(radians);
+	const float cos = std::cos(radians);
+	return Matrix3x3f(
+		cos, sin, 0.f,
+		-sin, cos, 0.f,
+		0.f, 0.f, 1.f);
+}
+
+inline constexpr Matrix3x3f Matrix3x3f::FromScale(const Vector2f& scale) noexcept
+{
+	return Matrix3x3f(
+		scale.x, 0.f, 0.f,
+		0.f, scale.y, 0.f,
+		0.f, 0.f, 1.f);
+}
+
+inline constexpr Matrix3x3f Matrix3x3f::FromTranslation(const Vector2f& translation) noexcept
+{
+	return Matrix3x3f(
+		1.f, 0.f, 0.f,
+		0.f, 1.f, 0.f,
+		translation.x, translation.y, 1.f);
+}
+
+inline Matrix3x3f Matrix3x3f::FromTransform(const Vector2f& translation, const float radians, const Vector2f& scale) noexcept
+{
+	const float sin = std::sin(radians);
+	const float cos = std::cos(radians);
+	return Matrix3x3f(
+		cos * scale.x, sin * scale.x, 0.f,
+		-sin * scale.y, cos * scale.y, 0.f,
+		translation.x, translation.y, 1.f);
+}
+
+inline constexpr bool Matrix4x4f::operator==(const Matrix4x4f& rhs) const noexcept
+{
+	for (int32 i = 0; i < 4; ++i)
+		for (int32 j = 0; j < 4; ++j)
+			if (m[i][j] != rhs.m[i][j])
+				return false;
+	return true;
+}
+
+inline Matrix4x4f Matrix4x4f::operator*(const Matrix4x4f& rhs) const noexcept
+{
+	const simd::float4 row0 = simd::LoadAligned<simd::float4>(rhs.m[0]);
+	const simd::float4 row1 = simd::LoadAligned<simd::float4>(rhs.m[1]);
+	const simd::float4 row2 = simd::LoadAligned<simd::float4>(rhs.m[2]);
+	const simd::float4 row3 = simd::LoadAligned<simd::float4>(rhs.m[3]);
+
+	Matrix4x4f result;
+	for (int32 i = 0; i < 4; ++i)
+	{
+		const simd::float4 row = simd::LoadAligned<simd::float4>(m[i]);
+		simd::float4 value = simd::Mul(simd::Shuffle<0, 0, 0, 0>(row), row0);
+		value = simd::MulAdd(simd::Shuffle<1, 1, 1, 1>(row), row1, value);
+		value = simd::MulAdd(simd::Shuffle<2, 2, 2, 2>(row), row2, value);
+		value = simd::MulAdd(simd::Shuffle<3, 3, 3, 3>(row), row3, value);
+		simd::StoreAligned(result.m[i], value);
+	}
+	return result;
+}
+
+inline constexpr float Matrix4x4f::Determinant() const noexcept
+{
+	const float s0 = m[0][0] * m[1][1] - m[1][0] * m[0][1];
+	const float s1 = m[0][0] * m[1][2] - m[1][0] * m[0][2];
+	const float s2 = m[0][0] * m[1][3] - m[1][0] * m[0][3];
+	const float s3 = m[0][1] * m[1][2] - m[1][1] * m[0][2];
+	const float s4 = m[0][1] * m[1][3] - m[1][1] * m[0][3];
+	const float s5 = m[0][2] * m[1][3] - m[1][2] * m[0][3];
+
+	const float c0 = m[2][0] * m[3][1] - m[3][0] * m[2][1];
+	const float c1 = m[2][0] * m[3][2] - m[3][0] * m[2][2];
+	const float c2 = m[2][0] * m[3][3] - m[3][0] * m[2][3];
+	const float c3 = m[2][1] * m[3][2] - m[3][1] * m[2][2];
+	const float c4 = m[2][1] * m[3][3] - m[3][1] * m[2][3];
+	const float c5 = m[2][2] * m[3][3] - m[3][2] * m[2][3];
+
+	return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+}
+
+inline constexpr Matrix4x4f Matrix4x4f::Inversed() const noexcept
+{
+	// expands the determinant using the 2x2 minors of the top and bottom halves
+	const float s0 = m[0][0] * m[1][1] - m[1][0] * m[0][1];
+	const float s1 = m[0][0] * m[1][2] - m[1][0] * m[0][2];
+	const float s2 = m[0][0] * m[1][3] - m[1][0] * m[0][3];
+	const float s3 = m[0][1] * m[1][2] - m[1][1] * m[0][2];
+	const float s4 = m[0][1] * m[1][3] - m[1][1] * m[0][3];
+	const float s5 = m[0][2] * m[1][3] - m[1][2] * m[0][3];
+
+	const float c0 = m[2][0] * m[3][1] - m[3][0] * m[2][1];
+	const float c1 = m[2][0] * m[3][2] - m[3][0] * m[2][2];
+	const float c2 = m[2][0] * m[3][3] - m[3][0] * m[2][3];
+	const float c3 = m[2][1] * m[3][2] - m[3][1] * m[2][2];
+	const float c4 = m[2][1] * m[3][3] - m[3][1] * m[2][3];
+	const float c5 = m[2][2] * m[3][3] - m[3][2] * m[2][3];
+
+	const float inverse = 1.f / (s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0);
+	return Matrix4x4f(
+		( m[1][1] * c5 - m[1][2] * c4 + m[1][3] * c3) * inverse,
+		(-m[0][1] * c5 + m[0][2] * c4 - m[0][3] * c3) * inverse,
+		( m[3][1] * s5 - m[3][2] * s4 + m[3][3] * s3) * inverse,
+		(-m[2][1] * s5 + m[2][2] * s4 - m[2][3] * s3) * inverse,
+
+		(-m[1][0] * c5 + m[1][2] * c2 - m[1][3] * c1) * inverse,
+		( m[0][0] * c5 - m[0][2] * c2 + m[0][3] * c1) * inverse,
+		(-m[3][0] * s5 + m[3][2] * s2 - m[3][3] * s1) * inverse,
+		( m[2][0] * s5 - m[2][2] * s2 + m[2][3] * s1) * inverse,
+
+		( m[1][0] * c4 - m[1][1] * c2 + m[1][3] * c0) * inverse,
+		(-m[0][0] * c4 + m[0][1] * c2 - m[0][3] * c0) * inverse,
+		( m[3][0] * s4 - m[3][1] * s2 + m[3][3] * s0) * inverse,
+		(-m[2][0] * s4 + m[2][1] * s2 - m[2][3] * s0) * inverse,
+
+		(-m[1][0] * c3 + m[1][1] * c1 - m[1][2] * c0) * inverse,
+		( m[0][0] * c3 - m[0][1] * c1 + m[0][2] * c0) * inverse,
+		(-m[3][0] * s3 + m[3][1] * s1 - m[3][2] * s0) * inverse,
+		( m[2][0] * s3 - m[2][1] * s1 + m[2][2] * s0) * inverse);
+}
+
+inline constexpr Matrix4x4f Matrix4x4f::Transposed() const noexcept
+{
+	return Matrix4x4f(
+		m[0][0], m[1][0], m[2][0], m[3][0],
+		m[0][1], m[1][1], m[2][1], m[3][1],
+		m[0][2], m[1][2], m[2][2], m[3][2],
+		m[0][3], m[1][3], m[2][3], m[3][3]);
+}
+
+inline constexpr Vector3f Matrix4x4f::TransformPoint(const Vector3f& point) const noexcept
+{
+	return Vector3f(
+		point.x * m[0][0] + point.y * m[1][0] + point.z * m[2][0] + m[3][0],
+		point.x * m[0][1] + point.y * m[1][1] + point.z * m[2][1] + m[3][1],
+		point.x * m[0][2] + point.y * m[1][2] + point.z * m[2][2] + m[3][2]);
+}
+
+inline Vector3fA Matrix4x4f::TransformPoint(const Vector3fA& point) const noexcept
+{
+	simd::float4 value = simd::LoadAligned<simd::float4>(m[3]);
+	value = simd::MulAdd(simd::Shuffle<0, 0, 0, 0>(point.value), simd::LoadAligned<simd::float4>(m[0]), value);
+	value = simd::MulAdd(simd::Shuffle<1, 1, 1, 1>(point.value), simd::LoadAligned<simd::float4>(m[1]), value);
+	value = simd::MulAdd(simd::Shuffle<2, 2, 2, 2>(point.value), simd::LoadAligned<simd::float4>(m[2]), value);
+	return Vector3fA(value);
+}
+
+inline constexpr Vector3f Matrix4x4f::TransformVector(const Vector3f& vector) const noexcept
+{
+	return Vector3f(
+		vector.x * m[0][0] + vector.y * m[1][0] + vector.z * m[2][0],
+		vector.x * m[0][1] + vector.y * m[1][1] + vector.z * m[2][1],
+		vector.x * m[0][2] + vector.y * m[1][2] + vector.z * m[2][2]);
+}
+
+inline Vector3fA Matrix4x4f::TransformVector(const Vector3fA& vector) const noexcept
+{
+	simd::float4 value = simd::Mul(simd::Shuffle<0, 0, 0, 0>(vector.value), simd::LoadAligned<simd::float4>(m[0]));
+	value = simd::MulAdd(simd::Shuffle<1, 1, 1, 1>(vector.value), simd::LoadAligned<simd::float4>(m[1]), value);
+	value = simd::MulAdd(simd::Shuffle<2, 2, 2, 2>(vector.value), simd::LoadAligned<simd::float4>(m[2]), value);
+	return Vector3fA(value);
+}
+
+inline Matrix4x4f Matrix4x4f::FromRotation(const Quaternion& rotation) noexcept
+{
+	return rotation.ToMatrix4x4();
+}
+
+inline constexpr Matrix4x4f Matrix4x4f::FromScale(const Vector3f& scale) noexcept
+{
+	return Matrix4x4f(
+		scale.x, 0.f, 0.f, 0.f,
+		0.f, scale.y, 0.f, 0.f,
+		0.f, 0.f, scale.z, 0.f,
+		0.f, 0.f, 0.f, 1.f);
+}
+
+inline constexpr Matrix4x4f Matrix4x4f::FromTranslation(const Vector3f& translation) noexcept
+{
+	return Matrix4x4f(
+		1.f, 0.f, 0.f, 0.f,
+		0.f, 1.f, 0.f, 0.f,
+		0.f, 0.f, 1.f, 0.f,
+		translation.x, translation.y, translation.z, 1.f);
+}
+
+inline Matrix4x4f Matrix4x4f::FromTransform(const Vector3f& translation, const Quaternion& rotation, const Vector3f& scale) noexcept
+{
+	Matrix4x4f result = rotation.ToMatrix4x4();
+	for (int32 j = 0; j < 3; ++j)
+	{
+		result.m[0][j] *= scale.x;
+		result.m[1][j] *= scale.y;
+		result.m[2][j] *= scale.z;
+	}
+	result.m[3][0] = translation.x;
+	result.m[3][1] = translation.y;
+	result.m[3][2] = translation.z;
+	return result;
+}
+
+inline void math::TransformPoints(const Matrix3x3f& matrix, std::span<const Vector2f> values, std::span<Vector2f> results) noexcept
+{
+	const float* input = &values.data()->x;
+	float* output = &results.data()->x;
+	simd::ForEach(static_cast<int32>(values.size()), [&]<typename Float>(const int32 i)
+	{
+		Float x, y;
+		simd::Deinterleave(input + i * 2, x, y);
+		const Float rx = simd::MulAdd(x, simd::Splat<Float>(matrix.m[0][0]), simd::MulAdd(y, simd::Splat<Float>(matrix.m[1][0]), simd::Splat<Float>(matrix.m[2][0])));
+		const Float ry = simd::MulAdd(x, simd::Splat<Float>(matrix.m[0][1]), simd::MulAdd(y, simd::Splat<Float>(matrix.m[1][1]), simd::Splat<Float>(matrix.m[2][1])));
+		simd::Interleave(output + i * 2, rx, ry);
+	});
+}
+
+inline void math::TransformPoints(const Matrix3x3f& matrix, Vector2fStream& values) noexcept
+{
+	float* vx = values.GetX();
+	float* vy = values.GetY();
+	simd::ForEach(values.GetCount(), [&]<typename Float>(const int32 i)
+	{
+		const Float x = simd::Load<Float>(vx + i);
+		const Float y = simd::Load<Float>(vy + i);
+		simd::Store(vx + i, simd::MulAdd(x, simd::Splat<Float>(matrix.m[0][0]), simd::MulAdd(y, simd::Splat<Float>(matrix.m[1][0]), simd::Splat<Float>(matrix.m[2][0]))));
+		simd::Store(vy + i, simd::MulAdd(x, simd::Splat<Float>(matrix.m[0][1]), simd::MulAdd(y, simd::Splat<Float>(matrix.m[1][1]), simd::Splat<Float>(matrix.m[2][1]))));
+	});
+}
+
+inline void math::TransformPoints(const Matrix4x4f& matrix, std::span<const Vector3f> values, std::span<Vector3f> results) noexcept
+{
+	const float* input = &values.data()->x;
+	float* output = &results.data()->x;
+	simd::ForEach(static_cast<int32>(values.size()), [&]<typename Float>(const int32 i)
+	{
+		Float x, y, z;
+		simd::Deinterleave3(input + i * 3, x, y, z);
+		Float result[3];
+		for (int32 j = 0; j < 3; ++j)
+		{
+			result[j] = simd::MulAdd(x, simd::Splat<Float>(matrix.m[0][j]),
+				simd::MulAdd(y, simd::Splat<Float>(matrix.m[1][j]),
+				simd::MulAdd(z, simd::Splat<Float>(matrix.m[2][j]), simd::Splat<Float>(matrix.m[3][j]))));
+		}
+		simd::Interleave3(output + i * 3, result[0], result[1], result[2]);
+	});
+}
+
+inline void math::TransformPoints(const Matrix4x4f& matrix, std::span<const Vector3fA> values, std::span<Vector3fA> results) noexcept
+{
+	const int32 count = static_cast<int32>(values.size());
+	for (int32 i = 0; i < count; ++i)
+		results[i] = matrix.TransformPoint(values[i]);
+}
+
+inline void math::TransformVectors(const Matrix3x3f& matrix, std::span<const Vector2f> values, std::span<Vector2f> results) noexcept
+{
+	const float* input = &values.data()->x;
+	float* output = &results.data()->x;
+	simd::ForEach(static_cast<int32>(values.size()), [&]<typename Float>(const int32 i)
+	{
+		Float x, y;
+		simd::Deinterleave(input + i * 2, x, y);
+		const Float rx = simd::MulAdd(x, simd::Splat<Float>(matrix.m[0][0]), simd::Mul(y, simd::Splat<Float>(matrix.m[1][0])));
+		const Float ry = simd::MulAdd(x, simd::Splat<Float>(matrix.m[0][1]), simd::Mul(y, simd::Splat<Float>(matrix.m[1][1])));
+		simd::Interleave(output + i * 2, rx, ry);
+	});
+}
+
+inline void math::TransformVectors(const Matrix3x3f& matrix, std::span<const Vector3f> values, std::span<Vector3f> results) noexcept
+{
+	const float* input = &values.data()->x;
+	float* output = &results.data()->x;
+	simd::ForEach(static_cast<int32>(values.size()), [&]<typename Float>(const int32 i)
+	{
+		Float x, y, z;
+		simd::Deinterleave3(input + i * 3, x, y, z);
+		Float result[3];
+		for (int32 j = 0; j < 3; ++j)
+		{
+			result[j] = simd::MulAdd(x, simd::Splat<Float>(matrix.m[0][j]),
+				simd::MulAdd(y, simd::Splat<Float>(matrix.m[1][j]),
+				simd::Mul(z, simd::Splat<Float>(matrix.m[2][j]))));
+		}
+		simd::Interleave3(output + i * 3, result[0], result[1], result[2]);
+	});
+}
+
+inline void math::TransformVectors(const Matrix4x4f& matrix, std::span<const Vector3f> values, std::span<Vector3f> results) noexcept
+{
+	const float* input = &values.data()->x;
+	float* output = &results.data()->x;
+	simd::ForEach(static_cast<int32>(values.size()), [&]<typename Float>(const int32 i)
+	{
+		Float x, y, z;
+		simd::Deinterleave3(input + i * 3, x, y, z);
+		Float result[3];
+		for (int32 j = 0; j < 3; ++j)
+		{
+			result[j] = simd::MulAdd(x, simd::Splat<Float>(matrix.m[0][j]),
+				simd::MulAdd(y, simd::Splat<Float>(matrix.m[1][j]),
+				simd::Mul(z, simd::Splat<Float>(matrix.m[2][j]))));
+		}
+		simd::Interleave3(output + i * 3, result[0], result[1], result[2]);
+	});
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <Core/Math.h>
+#include <Core/Vector.h>
+#include <Core/VectorBatch.h>
+
+#include <span>
+
+#if defined(MATH_PARALLEL_STD) && __has_include(<execution>)
+#include <execution>
+#endif
+
+/// \brief Splits batch operations into chunks that are processed across threads.
+///
+/// When MATH_PARALLEL_STD is defined the chunks are scheduled with std::execution::par_unseq on the thread
+/// pool of the standard library where it supports the parallel algorithms, otherwise they are processed one
+/// after another on the calling thread. Each chunk runs the single threaded batch operation so it is still
+/// vectorized. It is opt-in because with libstdc++ the parallel algorithms are implemented with TBB, which
+/// then has to be linked by every target that includes this header.
+namespace parallel
+{
+	/// \brief Selects the parallel overload of a batch operation and configures how it is split.
+	struct Policy
+	{
+		/// \brief The number of elements that are processed by each task. It is rounded up to a multiple
+		/// of 16 so that tasks don't write to the same cache line when the data is aligned to simd::Alignment.
+		int32 grainSize = 16384;
+	};
+
+	/// \brief Calls function(begin, end) for chunks of [0, count) which can run concurrently.
+	template<typename Function>
+	inline void For(const int32 count, const Policy& policy, Function&& function);
+
+	/// \brief Calls function(index) for each index in [0, count) which can run concurrently.
+	/// Each index is its own task, so it is meant for a small number of tasks that each do a lot of work.
+	template<typename Function>
+	inline void ForEach(const int32 count, Function&& function);
+}
+
+namespace math
+{
+	/// \brief Clamps each vector component-wise between min and max across threads.
+	inline void Clamp(const parallel::Policy& policy, std::span<const Vector2f> values, const Vector2f& min, const Vector2f& max, std::span<Vector2f> results);
+
+	/// \brief Linearly interpolates from each vector in a to the matching vector in b based on t across threads.
+	inline void Lerp(const parallel::Policy& policy, std::span<const Vector2f> a, std::span<const Vector2f> b, const float t, std::span<Vector2f> results);
+
+	/// \brief Reduces the length of each vector so that it doesn't exceed value across threads.
+	inline void Limit(const parallel::Policy& policy, std::span<const Vector2f> values, const float value, std::span<Vector2f> results);
+
+	/// \brief Normalizes each vector to have a length of 1 unit across threads.
+	inline void Normalize(const parallel::Policy& policy, std::span<const Vector2f> values, std::span<Vector2f> results);
+
+	/// \brief Converts each vector component-wise from one range to another range across threads.
+	inline void Remap(const parallel::Policy& policy, std::span<const Vector2f> values, const Vector2f& fromA, const Vector2f& fromB, const Vector2f& toA, const Vector2f& toB, std::span<Vector2f> results);
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <Core/Math.h>
+#include <Core/VectorBatch.h>
+
+#include <numeric>
+#include <vector>
+
+template<typename Function>
+inline void parallel::For(const int32 count, const Policy& policy, Function&& function)
+{
+	const int32 grainSize = math::Max((policy.grainSize + 15) & ~15, 16);
+	const int32 chunks = (count + grainSize - 1) / grainSize;
+	const auto process = [&](const int32 chunk)
+	{
+		const int32 begin = chunk * grainSize;
+		function(begin, math::Min(begin + grainSize, count));
+	};
+
+	if (chunks <= 1)
+	{
+		if (count > 0)
+			function(0, count);
+		return;
+	}
+
+#if defined(MATH_PARALLEL_STD) && defined(__cpp_lib_parallel_algorithm)
+	// the parallel algorithms need forward iterators so the chunk indices are materialized
+	std::vector<int32> indices(chunks);
+	std::iota(indices.begin(), indices.end(), 0);
+	std::for_each(std::execution::par_unseq, indices.begin(), indices.end(), process);
+#else
+	for (int32 chunk = 0; chunk < chunks; ++chunk)
+		process(chunk);
+#endif
+}
+
+template<typename Function>
+inline void parallel::ForEach(const int32 count, Function&& function)
+{
+#if defined(MATH_PARALLEL_STD) && defined(__cpp_lib_parallel_algorithm)
+	std::vector<int32> indices(count);
+	std::iota(indices.begin(), indices.end(), 0);
+	std::for_each(std::execution::par, indices.begin(), indices.end(), [&](const int32 index) { function(index); });
+#else
+	for (int32 index = 0; index < count; ++index)
+		function(index);
+#endif
+}
+
+inline void math::Clamp(const parallel::Policy& policy, std::span<const Vector2f> values, const Vector2f& min, const Vector2f& max, std::span<Vector2f> results)
+{
+	parallel::For(static_cast<int32>(values.size()), policy, [&](const int32 begin, const int32 end)
+	{
+		math::Clamp(values.subspan(begin, end - begin), min, max, results.subspan(begin, end - begin));
+	});
+}
+
+inline void math::Lerp(const parallel::Policy& policy, std::span<const Vector2f> a, std::span<const Vector2f> b, const float t, std::span<Vector2f> results)
+{
+	parallel::For(static_cast<int32>(a.size()), policy, [&](const int32 begin, const int32 end)
+	{
+		math::Lerp(a.subspan(begin, end - begin), b.subspan(begin, end - begin), t, results.subspan(begin, end - begin));
+	});
+}
+
+inline void math::Limit(const parallel::Policy& policy, std::span<const Vector2f> values, const float value, std::span<Vector2f> results)
+{
+	parallel::For(static_cast<int32>(values.size()), policy, [&](const int32 begin, const int32 end)
+	{
+		math::Limit(values.subspan(begin, end - begin), value, results.subspan(begin, end - begin));
+	});
+}
+
+inline void math::Normalize(const parallel::Policy& policy, std::span<const Vector2f> values, std::span<Vector2f> results)
+{
+	parallel::For(static_cast<int32>(values.size()), policy, [&](const int32 begin, const int32 end)
+	{
+		math::Normalize(values.subspan(begin, end - begin), results.subspan(begin, end - begin));
+	});
+}
+
+inline void math::Remap(const parallel::Policy& policy, std::span<const Vector2f> values, const Vector2f& fromA, const Vector2f& fromB, const Vector2f& toA, const Vector2f& toB, std::span<Vector2f> results)
+{
+	parallel::For(static_cast<int32>(values.size()), policy, [&](const int32 begin, const int32 end)
+	{
+		math::Remap(values.subspan(begin, end - begin), fromA, fromB, toA, toB, results.subspan(begin, end - begin));
+	});
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <Core/Math.h>
+#include <Core/Vector.h>
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+/// \brief Operations on simple polygons that are stored as a span of their vertices in order, where the last
+/// vertex connects back to the first one. Counter-clockwise polygons have a positive area.
+///
+/// Point-in-polygon uses the even-odd rule, so a point on an edge can be either inside or outside but the
+/// result is consistent between the polygons that share the edge. The batch version tests many points
+/// against one polygon in the widest registers, writes the same hit mask as the batch tests from
+/// Geometry.h and produces the same results as the single test.
+namespace math
+{
+	/// \brief Returns the area of the polygon which is positive if the vertices are counter-clockwise.
+	inline float SignedArea(std::span<const Vector2f> polygon) noexcept;
+
+	/// \brief Returns the center of mass of the polygon.
+	/// If the area of the polygon is 0 then it returns the average of the vertices.
+	inline Vector2f Centroid(std::span<const Vector2f> polygon) noexcept;
+
+	/// \brief Returns true if the point is inside of the polygon.
+	inline bool Contains(std::span<const Vector2f> polygon, const Vector2f& point) noexcept;
+	/// \brief Sets the bit of each point that is inside of the polygon.
+	inline void Contains(std::span<const Vector2f> polygon, std::span<const Vector2f> points, std::span<uint64_t> hits) noexcept;
+
+	/// \brief Replaces hull with the convex hull of the points in counter-clockwise order, starting from the
+	/// point with the lowest x and then y. Points on the edges of the hull aren't included.
+	inline void ConvexHull(std::span<const Vector2f> points, std::vector<Vector2f>& hull);
+}
@@ -0,0 +1,171 @@
+#pragma once
+
+#include <Core/Geometry.h>
+#include <Core/Math.h>
+#include <Core/Simd.h>
+
+#include <algorithm>
+
+namespace math::detail
+{
+	inline constexpr float Cross(const Vector2f& a, const Vector2f& b) noexcept
+	{
+		return a.x * b.y - a.y * b.x;
+	}
+
+	template<typename Float>
+	inline Float Crosses(const Vector2f& a, const Vector2f& b, const Float x, const Float y) noexcept
+	{
+		// the edge crosses the horizontal line through the point when exactly one vertex is above it, and the
+		// crossing is to the right of the point when the point is on the left side of the upward edge
+		const Float straddles = simd::Xor(simd::CmpGt(simd::Splat<Float>(a.y), y), simd::CmpGt(simd::Splat<Float>(b.y), y));
+		const Float side = simd::Sub(
+			simd::Mul(simd::Splat<Float>(b.x - a.x), simd::Sub(y, simd::Splat<Float>(a.y))),
+			simd::Mul(simd::Sub(x, simd::Splat<Float>(a.x)), simd::Splat<Float>(b.y - a.y)));
+		const Float right = (b.y > a.y)
+			? simd::CmpGt(side, simd::Splat<Float>(0.f))
+			: simd::CmpLt(side, simd::Splat<Float>(0.f));
+		return simd::And(straddles, right);
+	}
+}
+
+inline float math::SignedArea(std::span<const Vector2f> polygon) noexcept
+{
+	// the vertices are made relative to the first one which reduces the cancellation between the products
+	const int32 count = static_cast<int32>(polygon.size());
+	float area = 0.f;
+	for (int32 i = 2; i < count; ++i)
+		area += detail::Cross(polygon[i - 1] - polygon[0], polygon[i] - polygon[0]);
+	return area * 0.5f;
+}
+
+inline Vector2f math::Centroid(std::span<const Vector2f> polygon) noexcept
+{
+	const int32 count = static_cast<int32>(polygon.size());
+	if (count == 0)
+		return Vector2f::Zero;
+
+	// the polygon is split into a fan of triangles from the first vertex which are weighted by their area
+	float area = 0.f;
+	Vector2f center = Vector2f::Zero;
+	for (int32 i = 2; i < count; ++i)
+	{
+		const Vector2f a = polygon[i - 1] - polygon[0];
+		const Vector2f b = polygon[i] - polygon[0];
+		const float cross = detail::Cross(a, b);
+		center += (a + b) * cross;
+		area += cross;
+	}
+
+	if (area == 0.f)
+	{
+		Vector2f sum = Vector2f::Zero;
+		for (const Vector2f& vertex : polygon)
+			sum += vertex;
+		return sum / static_cast<float>(count);
+	}
+	return polygon[0] + center / (area * 3.f);
+}
+
+inline bool math::Contains(std::span<const Vector2f> polygon, const Vector2f& point) noexcept
+{
+	// the bounds are tested the same as in the batch version so that both give the same results
+	const int32 count = static_cast<int32>(polygon.size());
+	if (count == 0)
+		return false;
+
+	Vector2f min = polygon[0];
+	Vector2f max = polygon[0];
+	float inside = 0.f;
+	for (int32 i = 0, j = count - 1; i < count; j = i++)
+	{
+		min = math::Min<Vector2f>(min, polygon[i]);
+		max = math::Max<Vector2f>(max, polygon[i]);
+		inside = simd::Xor(inside, detail::Crosses(polygon[j], polygon[i], point.x, point.y));
+	}
+	return simd::BitMask(inside) != 0
+		&& (point.x >= min.x) && (point.x <= max.x) && (point.y >= min.y) && (point.y <= max.y);
+}
+
+inline void math::Contains(std::span<const Vector2f> polygon, std::span<const Vector2f> points, std::span<uint64_t> hits) noexcept
+{
+	const int32 size = static_cast<int32>(polygon.size());
+	const int32 count = static_cast<int32>(points.size());
+
+	const float* input = &points.data()->x;
+	uint64_t* output = hits.data();
+	std::fill_n(output, GetHitMaskSize(count), uint64_t(0));
+	if (size == 0)
+		return;
+
+	// the points are tested against the bounds first so that the edges are skipped if none of them is inside
+	Vector2f min = polygon[0];
+	Vector2f max = polygon[0];
+	for (const Vector2f& vertex : polygon)
+	{
+		min = math::Min<Vector2f>(min, vertex);
+		max = math::Max<Vector2f>(max, vertex);
+	}
+
+	const Vector2f* vertices = polygon.data();
+	simd::ForEach(count, [&]<typename Float>(const int32 i)
+	{
+		Float x, y;
+		simd::Deinterleave(input + i * 2, x, y);
+		const Float bounds = simd::And(
+			simd::And(simd::CmpGe(x, simd::Splat<Float>(min.x)), simd::CmpLe(x, simd::Splat<Float>(max.x))),
+			simd::And(simd::CmpGe(y, simd::Splat<Float>(min.y)), simd::CmpLe(y, simd::Splat<Float>(max.y))));
+		if (simd::BitMask(bounds) == 0)
+			return;
+
+		Float inside = simd::Splat<Float>(0.f);
+		for (int32 e = 0, j = size - 1; e < size; j = e++)
+			inside = simd::Xor(inside, detail::Crosses(vertices[j], vertices[e], x, y));
+		detail::WriteHits(output, i, simd::And(inside, bounds));
+	});
+}
+
+inline void math::ConvexHull(std::span<const Vector2f> points, std::vector<Vector2f>& hull)
+{
+	// Andrew's monotone chain builds the lower hull from left to right and then the upper hull back again,
+	// a vertex is removed while it doesn't make a counter-clockwise turn with the next point
+	std::vector<Vector2f> sorted(points.begin(), points.end());
+	std::sort(sorted.begin(), sorted.end(), [](const Vector2f& a, const Vector2f& b)
+	{
+		return (a.x < b.x) || (a.x == b.x && a.y < b.y);
+	});
+	sorted.erase(std::unique(sorted.begin(), sorted.end()), sorted.end());
+
+	const int32 count = static_cast<int32>(sorted.size());
+	hull.clear();
+	if (count < 3)
+	{
+		hull.assign(sorted.begin(), sorted.end());
+		return;
+	}
+
+	hull.resize(count * 2);
+	int32 size = 0;
+	const auto turns = [&](const Vector2f& point)
+	{
+		return detail::Cross(hull[size - 1] - hull[size - 2], point - hull[size - 2]) > 0.f;
+	};
+
+	for (int32 i = 0; i < count; ++i)
+	{
+		while (size >= 2 && !turns(sorted[i]))
+			size--;
+		hull[size++] = sorted[i];
+	}
+
+	const int32 lower = size + 1;
+	for (int32 i = count - 2; i >= 0; --i)
+	{
+		while (size >= lower && !turns(sorted[i]))
+			size--;
+		hull[size++] = sorted[i];
+	}
+
+	// the last point is the first one again
+	hull.resize(size - 1);
+}
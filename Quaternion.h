@@ -0,0 +1,78 @@
+#pragma once
+
+#include <Core/Vector.h>
+
+#include <span>
+
+class Matrix3x3f;
+class Matrix4x4f;
+
+/// \brief A rotation in 3d that is stored as the imaginary parts x, y, z and the real part w.
+/// Multiplying a * b produces the rotation that applies b first and then a.
+class Quaternion
+{
+public:
+	/// \brief Construct a new quaternion with all members initialized to 0.
+	constexpr Quaternion() noexcept : x(), y(), z(), w() {}
+	/// \brief Construct a new quaternion with members initialized to values x, y, z and w.
+	constexpr explicit Quaternion(const float x, const float y, const float z, const float w) noexcept : x(x), y(y), z(z), w(w) {}
+
+	/// \brief Returns true if all members are identical.
+	constexpr bool operator==(const Quaternion& rhs) const noexcept { return (x == rhs.x) && (y == rhs.y) && (z == rhs.z) && (w == rhs.w); }
+	/// \brief Returns true if any members aren't identical.
+	constexpr bool operator!=(const Quaternion& rhs) const noexcept { return (x != rhs.x) || (y != rhs.y) || (z != rhs.z) || (w != rhs.w); }
+
+	/// \brief Combines the two rotations so that rhs is applied first and returns the result in a new quaternion.
+	Quaternion operator*(const Quaternion& rhs) const noexcept;
+	/// \brief Combines the two rotations so that rhs is applied first, stores the result in this quaternion and returns a reference.
+	Quaternion& operator*=(const Quaternion& rhs) noexcept { return *this = *this * rhs; }
+
+	/// \brief Returns the length of this quaternion.
+	float Length() const noexcept;
+	/// \brief Returns the squared length of this quaternion.
+	constexpr float LengthSqr() const noexcept;
+
+	/// \brief Normalize this quaternion to have a length of 1 unit.
+	/// If the length of the quaternion is 0 then it makes it the identity.
+	void Normalize() noexcept;
+
+	/// \brief Returns the quaternion with negated imaginary parts, for a unit quaternion this is the inverse rotation.
+	[[nodiscard]] constexpr Quaternion Conjugate() const noexcept;
+	/// \brief Returns the inverse rotation for a quaternion of any length.
+	[[nodiscard]] constexpr Quaternion Inversed() const noexcept;
+	/// \brief Returns a normalized quaternion with a length of 1 unit.
+	/// If the length of the quaternion is 0 then it returns the identity.
+	[[nodiscard]] Quaternion Normalized() const noexcept;
+
+	/// \brief Rotates the vector by this quaternion which must be normalized.
+	constexpr Vector3f Rotate(const Vector3f& vector) const noexcept;
+
+	/// \brief Converts this quaternion to a rotation matrix, it must be normalized.
+	Matrix3x3f ToMatrix3x3() const noexcept;
+	/// \brief Converts this quaternion to a rotation matrix without translation, it must be normalized.
+	Matrix4x4f ToMatrix4x4() const noexcept;
+
+	/// \brief Returns the rotation of radians (counter-clockwise) around axis which must be normalized.
+	static Quaternion FromAxisAngle(const Vector3f& axis, const float radians) noexcept;
+
+	/// \brief Shorthand for writing Quaternion(0.f, 0.f, 0.f, 1.f).
+	static const Quaternion Identity;
+
+public:
+	float x, y, z, w;
+};
+
+inline constexpr Quaternion Quaternion::Identity(0.f, 0.f, 0.f, 1.f);
+
+namespace math
+{
+	/// \brief Returns the dot product of two quaternions.
+	inline constexpr float Dot(const Quaternion& a, const Quaternion& b) noexcept;
+
+	/// \brief Rotates each vector in values by a normalized quaternion and writes them into results.
+	/// Both spans must have the same size, they are allowed to be the same span.
+	inline void RotateVectors(const Quaternion& rotation, std::span<const Vector3f> values, std::span<Vector3f> results) noexcept;
+
+	/// \brief Spherically interpolates from a -> b based on t along the shortest path, both must be normalized.
+	inline Quaternion Slerp(const Quaternion& a, const Quaternion& b, const float t) noexcept;
+}
@@ -0,0 +1,141 @@
+#pragma once
+
+#include <Core/Math.h>
+#include <Core/Matrix.h>
+#include <Core/Simd.h>
+
+#include <cmath>
+
+inline Quaternion Quaternion::operator*(const Quaternion& rhs) const noexcept
+{
+	// a * b = aw * b + ax * (bw, -bz, by, -bx) + ay * (bz, bw, -bx, -by) + az * (-by, bx, bw, -bz)
+	const simd::float4 b = simd::Load<simd::float4>(&rhs.x);
+	const simd::float4 bx = simd::Mul(simd::Shuffle<3, 2, 1, 0>(b), simd::Set(1.f, -1.f, 1.f, -1.f));
+	const simd::float4 by = simd::Mul(simd::Shuffle<2, 3, 0, 1>(b), simd::Set(1.f, 1.f, -1.f, -1.f));
+	const simd::float4 bz = simd::Mul(simd::Shuffle<1, 0, 3, 2>(b), simd::Set(-1.f, 1.f, 1.f, -1.f));
+
+	simd::float4 value = simd::Mul(simd::Splat<simd::float4>(w), b);
+	value = simd::MulAdd(simd::Splat<simd::float4>(x), bx, value);
+	value = simd::MulAdd(simd::Splat<simd::float4>(y), by, value);
+	value = simd::MulAdd(simd::Splat<simd::float4>(z), bz, value);
+
+	Quaternion result;
+	simd::Store(&result.x, value);
+	return result;
+}
+
+inline float Quaternion::Length() const noexcept
+{
+	return math::Sqrt(LengthSqr());
+}
+
+inline constexpr float Quaternion::LengthSqr() const noexcept
+{
+	return x * x + y * y + z * z + w * w;
+}
+
+inline void Quaternion::Normalize() noexcept
+{
+	constexpr float epsilon = 0.0000001f;
+	const float length = Length();
+	if (length > epsilon)
+	{
+		const float inverse = 1.f / length;
+		x *= inverse; y *= inverse; z *= inverse; w *= inverse;
+	}
+	else
+	{
+		*this = Identity;
+	}
+}
+
+inline constexpr Quaternion Quaternion::Conjugate() const noexcept
+{
+	return Quaternion(-x, -y, -z, w);
+}
+
+inline constexpr Quaternion Quaternion::Inversed() const noexcept
+{
+	const float inverse = 1.f / LengthSqr();
+	return Quaternion(-x * inverse, -y * inverse, -z * inverse, w * inverse);
+}
+
+inline Quaternion Quaternion::Normalized() const noexcept
+{
+	Quaternion result(*this);
+	result.Normalize();
+	return result;
+}
+
+inline constexpr Vector3f Quaternion::Rotate(const Vector3f& vector) const noexcept
+{
+	// v + w * t + q x t where t = 2 * (q x v)
+	const Vector3f imaginary(x, y, z);
+	const Vector3f t = math::Cross(imaginary, vector) * 2.f;
+	return vector + t * w + math::Cross(imaginary, t);
+}
+
+inline Matrix3x3f Quaternion::ToMatrix3x3() const noexcept
+{
+	const float xx = x * x, yy = y * y, zz = z * z;
+	const float xy = x * y, xz = x * z, yz = y * z;
+	const float wx = w * x, wy = w * y, wz = w * z;
+	return Matrix3x3f(
+		1.f - 2.f * (yy + zz), 2.f * (xy + wz), 2.f * (xz - wy),
+		2.f * (xy - wz), 1.f - 2.f * (xx + zz), 2.f * (yz + wx),
+		2.f * (xz + wy), 2.f * (yz - wx), 1.f - 2.f * (xx + yy));
+}
+
+inline Matrix4x4f Quaternion::ToMatrix4x4() const noexcept
+{
+	const Matrix3x3f rotation = ToMatrix3x3();
+	return Matrix4x4f(
+		rotation.m[0][0], rotation.m[0][1], rotation.m[0][2], 0.f,
+		rotation.m[1][0], rotation.m[1][1], rotation.m[1][2], 0.f,
+		rotation.m[2][0], rotation.m[2][1], rotation.m[2][2], 0.f,
+		0.f, 0.f, 0.f, 1.f);
+}
+
+inline Quaternion Quaternion::FromAxisAngle(const Vector3f& axis, const float radians) noexcept
+{
+	const float sin = std::sin(radians * 0.5f);
+	const float cos = std::cos(radians * 0.5f);
+	return Quaternion(axis.x * sin, axis.y * sin, axis.z * sin, cos);
+}
+
+inline constexpr float math::Dot(const Quaternion& a, const Quaternion& b) noexcept
+{
+	return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
+}
+
+inline void math::RotateVectors(const Quaternion& rotation, std::span<const Vector3f> values, std::span<Vector3f> results) noexcept
+{
+	// converting once to a matrix is cheaper than the two cross products per vector
+	math::TransformVectors(rotation.ToMatrix3x3(), values, results);
+}
+
+inline Quaternion math::Slerp(const Quaternion& a, const Quaternion& b, const float t) noexcept
+{
+	float dot = math::Dot(a, b);
+	const float sign = (dot < 0.f) ? -1.f : 1.f;
+	dot *= sign;
+
+	float weightA = 1.f - t;
+	float weightB = t * sign;
+	// fall back to a linear interpolation when the rotations are too close to divide by the sine
+	if (dot < 0.9995f)
+	{
+		const float angle = std::acos(dot);
+		const float inverse = 1.f / std::sin(angle);
+		weightA = std::sin((1.f - t) * angle) * inverse;
+		weightB = std::sin(t * angle) * inverse * sign;
+	}
+
+	Quaternion result(
+		a.x * weightA + b.x * weightB,
+		a.y * weightA + b.y * weightB,
+		a.z * weightA + b.z * weightB,
+		a.w * weightA + b.w * weightB);
+	result.Normalize();
+	return result;
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <Core/Math.h>
+#include <Core/Vector.h>
+
+#include <array>
+#include <cstdint>
+#include <span>
+
+/// \brief Counter-based random number generator that implements Philox4x32-10.
+///
+/// Each block of 4 words is a pure function of the seed, the stream and the index of the block, so any
+/// position of a stream can be jumped to in constant time and every thread can use its own stream of the
+/// same seed without sharing state. The words are identical on every platform, and so are the floats and
+/// the vectors of the helpers below because they avoid fused multiply-adds, so a seed replays the same.
+class Random
+{
+public:
+	/// \brief Construct a new generator at the start of a stream of a seed.
+	constexpr explicit Random(const uint64_t seed, const uint64_t stream = 0) noexcept;
+
+	/// \brief Returns the 4 words of a block that is identified by the seed, the stream and the counter.
+	static constexpr std::array<uint32_t, 4> Generate(const uint64_t seed, const uint64_t stream, const uint64_t counter) noexcept;
+
+	/// \brief Returns the number of words that have been generated since the start of the stream.
+	constexpr uint64_t GetPosition() const noexcept { return m_Counter * 4 - (4 - m_Index); }
+	/// \brief Jumps to the word at position of the stream.
+	constexpr void SetPosition(const uint64_t position) noexcept;
+
+	/// \brief Returns the next word.
+	constexpr uint32_t NextUInt() noexcept;
+	/// \brief Returns the next word as a float in the range [0, 1) with 24 bits of precision.
+	constexpr float NextFloat() noexcept;
+
+	/// \brief Fills values with the next words.
+	void Fill(std::span<uint32_t> values) noexcept;
+	/// \brief Fills values with the next words as floats in the range [0, 1), the same as calling NextFloat for each.
+	void Fill(std::span<float> values) noexcept;
+
+private:
+	template<typename Function>
+	void Generate(const int32 count, Function&& function) noexcept;
+
+private:
+	uint64_t m_Seed = 0;
+	uint64_t m_Stream = 0;
+	uint64_t m_Counter = 0;
+	std::array<uint32_t, 4> m_Block = {};
+	int32 m_Index = 4;
+};
+
+/// \brief Random vectors that are generated in bulk with the trigonometry and the arithmetic done in the
+/// widest registers. The batch versions consume the words in the same order as the single versions so they
+/// produce exactly the same vectors as calling them once per element, on every instruction set.
+namespace math
+{
+	/// \brief Returns a direction with a length of 1 unit that is uniformly distributed around the circle.
+	inline Vector2f RandomUnitVector2f(Random& random) noexcept;
+	/// \brief Fills results with directions with a length of 1 unit.
+	inline void RandomUnitVector2f(Random& random, std::span<Vector2f> results) noexcept;
+
+	/// \brief Returns a point that is uniformly distributed over the area of the circle at center with radius.
+	inline Vector2f RandomInDisc(Random& random, const Vector2f& center, const float radius) noexcept;
+	/// \brief Fills results with points that are uniformly distributed over the area of the circle at center with radius.
+	inline void RandomInDisc(Random& random, const Vector2f& center, const float radius, std::span<Vector2f> results) noexcept;
+
+	/// \brief Returns a number between min and max.
+	inline float RandomInRange(Random& random, const float min, const float max) noexcept;
+	/// \brief Fills results with numbers between min and max.
+	inline void RandomInRange(Random& random, const float min, const float max, std::span<float> results) noexcept;
+
+	/// \brief Returns a vector with each component between the matching components of min and max.
+	inline Vector2f RandomInRange(Random& random, const Vector2f& min, const Vector2f& max) noexcept;
+	/// \brief Fills results with vectors with each component between the matching components of min and max.
+	inline void RandomInRange(Random& random, const Vector2f& min, const Vector2f& max, std::span<Vector2f> results) noexcept;
+}
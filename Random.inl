@@ -0,0 +1,225 @@
+#pragma once
+
+#include <Core/Math.h>
+#include <Core/Simd.h>
+#include <Core/Trigonometry.h>
+
+namespace math::detail
+{
+	// the number of random floats that the batch functions generate at a time on the stack
+	constexpr int32 s_RandomChunk = 256;
+
+	// the helpers only use operations that are rounded the same on every instruction set so that the
+	// vectors of a seed can be replayed on other machines, which is why none of them fuse multiply-adds
+	template<typename Float>
+	inline Float ToAngle(const Float value) noexcept
+	{
+		return simd::MulAddUnfused(value, simd::Splat<Float>(PI_TWO), simd::Splat<Float>(-PI_ONE));
+	}
+
+	inline Vector2f ToDirection(const float value) noexcept
+	{
+		float sin, cos;
+		math::SinCosUnfused(ToAngle(value), sin, cos);
+		return Vector2f(cos, sin);
+	}
+
+	inline constexpr float ToFloat(const uint32_t word) noexcept
+	{
+		// the top 24 bits fit exactly in the mantissa
+		return static_cast<float>(word >> 8) * (1.f / 16777216.f);
+	}
+}
+
+inline constexpr Random::Random(const uint64_t seed, const uint64_t stream) noexcept
+	: m_Seed(seed)
+	, m_Stream(stream)
+{
+}
+
+inline constexpr std::array<uint32_t, 4> Random::Generate(const uint64_t seed, const uint64_t stream, const uint64_t counter) noexcept
+{
+	constexpr uint32_t multiplier0 = 0xD2511F53;
+	constexpr uint32_t multiplier1 = 0xCD9E8D57;
+	constexpr uint32_t weyl0 = 0x9E3779B9;
+	constexpr uint32_t weyl1 = 0xBB67AE85;
+
+	uint32_t key0 = static_cast<uint32_t>(seed);
+	uint32_t key1 = static_cast<uint32_t>(seed >> 32);
+	std::array<uint32_t, 4> block = {
+		static_cast<uint32_t>(counter),
+		static_cast<uint32_t>(counter >> 32),
+		static_cast<uint32_t>(stream),
+		static_cast<uint32_t>(stream >> 32) };
+
+	for (int32 round = 0; round < 10; ++round)
+	{
+		const uint64_t product0 = static_cast<uint64_t>(multiplier0) * block[0];
+		const uint64_t product1 = static_cast<uint64_t>(multiplier1) * block[2];
+		block = {
+			static_cast<uint32_t>(product1 >> 32) ^ block[1] ^ key0,
+			static_cast<uint32_t>(product1),
+			static_cast<uint32_t>(product0 >> 32) ^ block[3] ^ key1,
+			static_cast<uint32_t>(product0) };
+		key0 += weyl0;
+		key1 += weyl1;
+	}
+	return block;
+}
+
+inline constexpr void Random::SetPosition(const uint64_t position) noexcept
+{
+	m_Counter = position / 4;
+	m_Index = 4;
+	if (position % 4 != 0)
+	{
+		m_Block = Generate(m_Seed, m_Stream, m_Counter++);
+		m_Index = static_cast<int32>(position % 4);
+	}
+}
+
+inline constexpr uint32_t Random::NextUInt() noexcept
+{
+	if (m_Index == 4)
+	{
+		m_Block = Generate(m_Seed, m_Stream, m_Counter++);
+		m_Index = 0;
+	}
+	return m_Block[m_Index++];
+}
+
+inline constexpr float Random::NextFloat() noexcept
+{
+	return math::detail::ToFloat(NextUInt());
+}
+
+inline void Random::Fill(std::span<uint32_t> values) noexcept
+{
+	uint32_t* output = values.data();
+	Generate(static_cast<int32>(values.size()), [&](const int32 i, const uint32_t word) { output[i] = word; });
+}
+
+inline void Random::Fill(std::span<float> values) noexcept
+{
+	float* output = values.data();
+	Generate(static_cast<int32>(values.size()), [&](const int32 i, const uint32_t word) { output[i] = math::detail::ToFloat(word); });
+}
+
+template<typename Function>
+inline void Random::Generate(const int32 count, Function&& function) noexcept
+{
+	// the rest of the current block is used first, then whole blocks and the last one is kept for later
+	int32 i = 0;
+	for (; i < count && m_Index < 4; ++i)
+		function(i, m_Block[m_Index++]);
+
+	for (; i + 4 <= count; i += 4)
+	{
+		const std::array<uint32_t, 4> block = Generate(m_Seed, m_Stream, m_Counter++);
+		function(i + 0, block[0]);
+		function(i + 1, block[1]);
+		function(i + 2, block[2]);
+		function(i + 3, block[3]);
+	}
+
+	for (; i < count; ++i)
+		function(i, NextUInt());
+}
+
+inline Vector2f math::RandomUnitVector2f(Random& random) noexcept
+{
+	return detail::ToDirection(random.NextFloat());
+}
+
+inline void math::RandomUnitVector2f(Random& random, std::span<Vector2f> results) noexcept
+{
+	float values[detail::s_RandomChunk];
+	const int32 size = static_cast<int32>(results.size());
+	for (int32 begin = 0; begin < size; begin += detail::s_RandomChunk)
+	{
+		const int32 count = math::Min(size - begin, detail::s_RandomChunk);
+		random.Fill(std::span(values, count));
+
+		float* output = &results[begin].x;
+		simd::ForEach(count, [&]<typename Float>(const int32 i)
+		{
+			Float sin, cos;
+			math::SinCosUnfused(detail::ToAngle(simd::Load<Float>(values + i)), sin, cos);
+			simd::Interleave(output + i * 2, cos, sin);
+		});
+	}
+}
+
+inline Vector2f math::RandomInDisc(Random& random, const Vector2f& center, const float radius) noexcept
+{
+	// the square root of the distance makes the points uniform over the area instead of the radius
+	const Vector2f direction = detail::ToDirection(random.NextFloat());
+	const float distance = simd::Mul(simd::Sqrt(random.NextFloat()), radius);
+	return Vector2f(
+		simd::MulAddUnfused(direction.x, distance, center.x),
+		simd::MulAddUnfused(direction.y, distance, center.y));
+}
+
+inline void math::RandomInDisc(Random& random, const Vector2f& center, const float radius, std::span<Vector2f> results) noexcept
+{
+	float values[detail::s_RandomChunk * 2];
+	const int32 size = static_cast<int32>(results.size());
+	for (int32 begin = 0; begin < size; begin += detail::s_RandomChunk)
+	{
+		const int32 count = math::Min(size - begin, detail::s_RandomChunk);
+		random.Fill(std::span(values, count * 2));
+
+		float* output = &results[begin].x;
+		simd::ForEach(count, [&]<typename Float>(const int32 i)
+		{
+			Float angle, distance, sin, cos;
+			simd::Deinterleave(values + i * 2, angle, distance);
+			math::SinCosUnfused(detail::ToAngle(angle), sin, cos);
+			distance = simd::Mul(simd::Sqrt(distance), simd::Splat<Float>(radius));
+
+			const Float x = simd::MulAddUnfused(cos, distance, simd::Splat<Float>(center.x));
+			const Float y = simd::MulAddUnfused(sin, distance, simd::Splat<Float>(center.y));
+			simd::Interleave(output + i * 2, x, y);
+		});
+	}
+}
+
+inline float math::RandomInRange(Random& random, const float min, const float max) noexcept
+{
+	return simd::MulAddUnfused(random.NextFloat(), max - min, min);
+}
+
+inline void math::RandomInRange(Random& random, const float min, const float max, std::span<float> results) noexcept
+{
+	random.Fill(results);
+
+	float* output = results.data();
+	simd::ForEach(static_cast<int32>(results.size()), [&]<typename Float>(const int32 i)
+	{
+		simd::Store(output + i, simd::MulAddUnfused(simd::Load<Float>(output + i), simd::Splat<Float>(max - min), simd::Splat<Float>(min)));
+	});
+}
+
+inline Vector2f math::RandomInRange(Random& random, const Vector2f& min, const Vector2f& max) noexcept
+{
+	const float x = RandomInRange(random, min.x, max.x);
+	const float y = RandomInRange(random, min.y, max.y);
+	return Vector2f(x, y);
+}
+
+inline void math::RandomInRange(Random& random, const Vector2f& min, const Vector2f& max, std::span<Vector2f> results) noexcept
+{
+	// the components are generated in the same order as the single version, x then y of each vector
+	float* output = &results.data()->x;
+	random.Fill(std::span(output, results.size() * 2));
+
+	const Vector2f range = max - min;
+	simd::ForEach(static_cast<int32>(results.size()), [&]<typename Float>(const int32 i)
+	{
+		Float x, y;
+		simd::Deinterleave(output + i * 2, x, y);
+		x = simd::MulAddUnfused(x, simd::Splat<Float>(range.x), simd::Splat<Float>(min.x));
+		y = simd::MulAddUnfused(y, simd::Splat<Float>(range.y), simd::Splat<Float>(min.y));
+		simd::Interleave(output + i * 2, x, y);
+	});
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <Core/Math.h>
+#include <Core/Vector.h>
+#include <Core/VectorDouble.h>
+
+#include <span>
+
+/// \brief Conversions between double precision world positions and float positions relative to a tile
+/// origin, so that the positions in the hot arrays can stay as Vector2f on maps that are too big for floats.
+///
+/// A float has a spacing of 0.0078 at 100000 units from its origin, relative to the origin of a tile that is
+/// 1000 units wide the spacing is at most 0.00012. The subtraction from the origin is done in double
+/// precision so the only error is the rounding of the result to a float. The batch versions process the
+/// positions in the widest registers, the input and output spans must have the same size and the results
+/// are identical to the single versions.
+namespace math
+{
+	/// \brief Returns the origin of the square tile of size tileSize that contains the position, where the tiles
+	/// are laid out from the world origin.
+	inline Vector2d GetTileOrigin(const Vector2d& position, const double tileSize) noexcept;
+
+	/// \brief Returns the position relative to the origin.
+	inline Vector2f Rebase(const Vector2d& position, const Vector2d& origin) noexcept;
+	/// \brief Writes each position relative to the origin into results.
+	inline void Rebase(std::span<const Vector2d> positions, const Vector2d& origin, std::span<Vector2f> results) noexcept;
+	/// \brief Moves each position that is relative to the origin from so that it is relative to the origin to.
+	/// The offset between the origins is rounded to a float once, and then added to each position.
+	inline void Rebase(std::span<Vector2f> positions, const Vector2d& from, const Vector2d& to) noexcept;
+
+	/// \brief Returns the world position of a position that is relative to the origin.
+	inline Vector2d ToWorld(const Vector2f& position, const Vector2d& origin) noexcept;
+	/// \brief Writes the world position of each position that is relative to the origin into results.
+	inline void ToWorld(std::span<const Vector2f> positions, const Vector2d& origin, std::span<Vector2d> results) noexcept;
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <Core/Math.h>
+#include <Core/Simd.h>
+
+#include <cmath>
+
+inline Vector2d math::GetTileOrigin(const Vector2d& position, const double tileSize) noexcept
+{
+	return Vector2d(std::floor(position.x / tileSize) * tileSize, std::floor(position.y / tileSize) * tileSize);
+}
+
+inline Vector2f math::Rebase(const Vector2d& position, const Vector2d& origin) noexcept
+{
+	return Vector2f(static_cast<float>(position.x - origin.x), static_cast<float>(position.y - origin.y));
+}
+
+inline void math::Rebase(std::span<const Vector2d> positions, const Vector2d& origin, std::span<Vector2f> results) noexcept
+{
+	// the x and y of each position stay interleaved so a register of doubles converts straight into the
+	// matching floats, each vector is two doubles so the second register is offset by a whole register of floats
+	const double* input = &positions.data()->x;
+	float* output = &results.data()->x;
+	simd::ForEach(static_cast<int32>(positions.size()), [&]<typename Float>(const int32 i)
+	{
+		constexpr int32 width = sizeof(Float) / sizeof(float);
+		simd::Store(output + i * 2, simd::LoadDouble<Float>(input + i * 2, origin.x, origin.y));
+		if constexpr (width == 1)
+			simd::Store(output + i * 2 + 1, simd::LoadDouble<Float>(input + i * 2 + 1, origin.y, origin.x));
+		else
+			simd::Store(output + i * 2 + width, simd::LoadDouble<Float>(input + i * 2 + width, origin.x, origin.y));
+	});
+}
+
+inline void math::Rebase(std::span<Vector2f> positions, const Vector2d& from, const Vector2d& to) noexcept
+{
+	const Vector2f offset = Rebase(from, to);
+	float* values = &positions.data()->x;
+	simd::ForEach(static_cast<int32>(positions.size()), [&]<typename Float>(const int32 i)
+	{
+		Float x, y;
+		simd::Deinterleave(values + i * 2, x, y);
+		simd::Interleave(values + i * 2, simd::Add(x, simd::Splat<Float>(offset.x)), simd::Add(y, simd::Splat<Float>(offset.y)));
+	});
+}
+
+inline Vector2d math::ToWorld(const Vector2f& position, const Vector2d& origin) noexcept
+{
+	return Vector2d(static_cast<double>(position.x) + origin.x, static_cast<double>(position.y) + origin.y);
+}
+
+inline void math::ToWorld(std::span<const Vector2f> positions, const Vector2d& origin, std::span<Vector2d> results) noexcept
+{
+	const float* input = &positions.data()->x;
+	double* output = &results.data()->x;
+	simd::ForEach(static_cast<int32>(positions.size()), [&]<typename Float>(const int32 i)
+	{
+		constexpr int32 width = sizeof(Float) / sizeof(float);
+		simd::StoreDouble(output + i * 2, simd::Load<Float>(input + i * 2), origin.x, origin.y);
+		if constexpr (width == 1)
+			simd::StoreDouble(output + i * 2 + 1, simd::Load<Float>(input + i * 2 + 1), origin.y, origin.x);
+		else
+			simd::StoreDouble(output + i * 2 + width, simd::Load<Float>(input + i * 2 + width), origin.x, origin.y);
+	});
+}
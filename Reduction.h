@@ -0,0 +1,49 @@
+#pragma once
+
+#include <Core/Geometry.h>
+#include <Core/Math.h>
+#include <Core/Parallel.h>
+#include <Core/Vector.h>
+
+#include <span>
+
+/// \brief Reductions of a whole array of Vector2f to a single result in the widest registers.
+///
+/// Each lane of a register accumulates its own part of the array and the lanes are combined at the end,
+/// so the sums can differ from a serial loop by a rounding error. The parallel versions reduce chunks of
+/// the array across threads and then combine the chunks in order, so they give the same result every time
+/// for the same policy but the sums can differ from the single threaded versions by a rounding error.
+namespace math
+{
+	/// \brief Returns the smallest box that contains every point.
+	/// If there are no points then it returns a box with min at the biggest float and max at the smallest.
+	inline AABB2f Bounds(std::span<const Vector2f> points) noexcept;
+	/// \brief Returns the smallest box that contains every point across threads.
+	inline AABB2f Bounds(const parallel::Policy& policy, std::span<const Vector2f> points);
+
+	/// \brief Returns the sum of the vectors.
+	inline Vector2f Sum(std::span<const Vector2f> values) noexcept;
+	/// \brief Returns the sum of the vectors across threads.
+	inline Vector2f Sum(const parallel::Policy& policy, std::span<const Vector2f> values);
+
+	/// \brief Returns the average of the vectors, which is a zero vector if there aren't any.
+	inline Vector2f Mean(std::span<const Vector2f> values) noexcept;
+	/// \brief Returns the average of the vectors across threads, which is a zero vector if there aren't any.
+	inline Vector2f Mean(const parallel::Policy& policy, std::span<const Vector2f> values);
+
+	/// \brief Returns the sum of each vector multiplied by the matching weight.
+	/// Both spans must have the same size.
+	inline Vector2f WeightedSum(std::span<const Vector2f> values, std::span<const float> weights) noexcept;
+	/// \brief Returns the sum of each vector multiplied by the matching weight across threads.
+	/// Both spans must have the same size.
+	inline Vector2f WeightedSum(const parallel::Policy& policy, std::span<const Vector2f> values, std::span<const float> weights);
+
+	/// \brief Returns the index of the point with the smallest math::DistanceSqr to target.
+	/// If several points are equally close then it returns the first one, and -1 if there are no points.
+	/// A point whose distance overflows to infinity can still be the nearest, a distance that is nan is never
+	/// closer than one that isn't and if every distance is nan it returns 0.
+	inline int32 Nearest(std::span<const Vector2f> points, const Vector2f& target) noexcept;
+	/// \brief Returns the index of the point with the smallest math::DistanceSqr to target across threads.
+	/// It returns the same index as the single threaded version.
+	inline int32 Nearest(const parallel::Policy& policy, std::span<const Vector2f> points, const Vector2f& target);
+}
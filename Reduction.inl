@@ -0,0 +1,255 @@
+#pragma once
+
+#include <Core/Math.h>
+#include <Core/Parallel.h>
+#include <Core/Simd.h>
+
+#include <concepts>
+#include <limits>
+#include <vector>
+
+namespace math::detail
+{
+	template<typename Float, typename Function>
+	inline float ReduceLanes(const Float value, Function&& function) noexcept
+	{
+		constexpr int32 width = sizeof(Float) / sizeof(float);
+		alignas(simd::Alignment) float lanes[width];
+		simd::Store(lanes, value);
+		float result = lanes[0];
+		for (int32 i = 1; i < width; ++i)
+			result = function(result, lanes[i]);
+		return result;
+	}
+
+	// each chunk is reduced by function(begin, end) on its own thread and the results are returned in
+	// the order of the chunks, which are split the same as parallel::For
+	template<typename Result, typename Function>
+	inline std::vector<Result> ReduceChunks(const int32 count, const parallel::Policy& policy, Function&& function)
+	{
+		const int32 grainSize = math::Max((policy.grainSize + 15) & ~15, 16);
+		const int32 chunks = math::Max((count + grainSize - 1) / grainSize, 1);
+		std::vector<Result> results(chunks);
+		if (chunks == 1)
+		{
+			results[0] = function(0, count);
+			return results;
+		}
+
+		parallel::ForEach(chunks, [&](const int32 chunk)
+		{
+			const int32 begin = chunk * grainSize;
+			results[chunk] = function(begin, math::Min(begin + grainSize, count));
+		});
+		return results;
+	}
+
+	struct NearestPoint
+	{
+		float distanceSqr = std::numeric_limits<float>::infinity();
+		int32 index = -1;
+	};
+
+	inline bool IsCloser(const float distanceSqr, const NearestPoint& nearest) noexcept
+	{
+		// the first point is always taken so that a distance that overflows to infinity still has an index,
+		// after that a nan distance only loses and is replaced by the first distance that isn't nan
+		if (nearest.index < 0 || distanceSqr < nearest.distanceSqr)
+			return true;
+		return std::isnan(nearest.distanceSqr) && !std::isnan(distanceSqr);
+	}
+
+	inline NearestPoint FindNearest(std::span<const Vector2f> points, const Vector2f& target, const int32 offset) noexcept
+	{
+		// the lanes are only searched when one of them is closer, which becomes rare once a close point is found
+		NearestPoint nearest;
+		const float* input = &points.data()->x;
+		simd::ForEach(static_cast<int32>(points.size()), [&]<typename Float>(const int32 i)
+		{
+			Float x, y;
+			simd::Deinterleave(input + i * 2, x, y);
+			const Float dx = simd::Sub(simd::Splat<Float>(target.x), x);
+			const Float dy = simd::Sub(simd::Splat<Float>(target.y), y);
+			const Float distanceSqr = simd::Add(simd::Mul(dx, dx), simd::Mul(dy, dy));
+			const bool isSeeded = nearest.index >= 0 && !std::isnan(nearest.distanceSqr);
+			if (isSeeded && !simd::Any(simd::CmpLt(distanceSqr, simd::Splat<Float>(nearest.distanceSqr))))
+				return;
+
+			constexpr int32 width = sizeof(Float) / sizeof(float);
+			alignas(simd::Alignment) float lanes[width];
+			simd::Store(lanes, distanceSqr);
+			for (int32 lane = 0; lane < width; ++lane)
+			{
+				if (IsCloser(lanes[lane], nearest))
+				{
+					nearest.distanceSqr = lanes[lane];
+					nearest.index = offset + i + lane;
+				}
+			}
+		});
+		return nearest;
+	}
+}
+
+inline AABB2f math::Bounds(std::span<const Vector2f> points) noexcept
+{
+	constexpr float limit = std::numeric_limits<float>::max();
+	simd::floatn minX = simd::Splat<simd::floatn>(limit), minY = minX;
+	simd::floatn maxX = simd::Splat<simd::floatn>(-limit), maxY = maxX;
+	Vector2f min = Vector2f(limit), max = Vector2f(-limit);
+
+	const float* input = &points.data()->x;
+	simd::ForEach(static_cast<int32>(points.size()), [&]<typename Float>(const int32 i)
+	{
+		Float x, y;
+		simd::Deinterleave(input + i * 2, x, y);
+		if constexpr (std::same_as<Float, float>)
+		{
+			min = math::Min<Vector2f>(min, Vector2f(x, y));
+			max = math::Max<Vector2f>(max, Vector2f(x, y));
+		}
+		else
+		{
+			minX = simd::Min(minX, x);
+			minY = simd::Min(minY, y);
+			maxX = simd::Max(maxX, x);
+			maxY = simd::Max(maxY, y);
+		}
+	});
+
+	const auto lower = [](const float a, const float b) { return math::Min(a, b); };
+	const auto upper = [](const float a, const float b) { return math::Max(a, b); };
+	return AABB2f(
+		Vector2f(lower(min.x, detail::ReduceLanes(minX, lower)), lower(min.y, detail::ReduceLanes(minY, lower))),
+		Vector2f(upper(max.x, detail::ReduceLanes(maxX, upper)), upper(max.y, detail::ReduceLanes(maxY, upper))));
+}
+
+inline AABB2f math::Bounds(const parallel::Policy& policy, std::span<const Vector2f> points)
+{
+	const std::vector<AABB2f> boxes = detail::ReduceChunks<AABB2f>(static_cast<int32>(points.size()), policy, [&](const int32 begin, const int32 end)
+	{
+		return math::Bounds(points.subspan(begin, end - begin));
+	});
+
+	AABB2f result = boxes[0];
+	for (const AABB2f& box : boxes)
+	{
+		result.min = math::Min<Vector2f>(result.min, box.min);
+		result.max = math::Max<Vector2f>(result.max, box.max);
+	}
+	return result;
+}
+
+inline Vector2f math::Sum(std::span<const Vector2f> values) noexcept
+{
+	simd::floatn sumX = simd::Splat<simd::floatn>(0.f), sumY = sumX;
+	Vector2f sum = Vector2f::Zero;
+
+	const float* input = &values.data()->x;
+	simd::ForEach(static_cast<int32>(values.size()), [&]<typename Float>(const int32 i)
+	{
+		Float x, y;
+		simd::Deinterleave(input + i * 2, x, y);
+		if constexpr (std::same_as<Float, float>)
+		{
+			sum += Vector2f(x, y);
+		}
+		else
+		{
+			sumX = simd::Add(sumX, x);
+			sumY = simd::Add(sumY, y);
+		}
+	});
+
+	const auto add = [](const float a, const float b) { return a + b; };
+	return Vector2f(detail::ReduceLanes(sumX, add), detail::ReduceLanes(sumY, add)) + sum;
+}
+
+inline Vector2f math::Sum(const parallel::Policy& policy, std::span<const Vector2f> values)
+{
+	const std::vector<Vector2f> sums = detail::ReduceChunks<Vector2f>(static_cast<int32>(values.size()), policy, [&](const int32 begin, const int32 end)
+	{
+		return math::Sum(values.subspan(begin, end - begin));
+	});
+
+	Vector2f result = Vector2f::Zero;
+	for (const Vector2f& sum : sums)
+		result += sum;
+	return result;
+}
+
+inline Vector2f math::Mean(std::span<const Vector2f> values) noexcept
+{
+	if (values.empty())
+		return Vector2f::Zero;
+	return Sum(values) / static_cast<float>(values.size());
+}
+
+inline Vector2f math::Mean(const parallel::Policy& policy, std::span<const Vector2f> values)
+{
+	if (values.empty())
+		return Vector2f::Zero;
+	return Sum(policy, values) / static_cast<float>(values.size());
+}
+
+inline Vector2f math::WeightedSum(std::span<const Vector2f> values, std::span<const float> weights) noexcept
+{
+	simd::floatn sumX = simd::Splat<simd::floatn>(0.f), sumY = sumX;
+	Vector2f sum = Vector2f::Zero;
+
+	const float* input = &values.data()->x;
+	const float* inputWeights = weights.data();
+	simd::ForEach(static_cast<int32>(values.size()), [&]<typename Float>(const int32 i)
+	{
+		Float x, y;
+		simd::Deinterleave(input + i * 2, x, y);
+		const Float weight = simd::Load<Float>(inputWeights + i);
+		if constexpr (std::same_as<Float, float>)
+		{
+			sum += Vector2f(x, y) * weight;
+		}
+		else
+		{
+			sumX = simd::MulAdd(x, weight, sumX);
+			sumY = simd::MulAdd(y, weight, sumY);
+		}
+	});
+
+	const auto add = [](const float a, const float b) { return a + b; };
+	return Vector2f(detail::ReduceLanes(sumX, add), detail::ReduceLanes(sumY, add)) + sum;
+}
+
+inline Vector2f math::WeightedSum(const parallel::Policy& policy, std::span<const Vector2f> values, std::span<const float> weights)
+{
+	const std::vector<Vector2f> sums = detail::ReduceChunks<Vector2f>(static_cast<int32>(values.size()), policy, [&](const int32 begin, const int32 end)
+	{
+		return math::WeightedSum(values.subspan(begin, end - begin), weights.subspan(begin, end - begin));
+	});
+
+	Vector2f result = Vector2f::Zero;
+	for (const Vector2f& sum : sums)
+		result += sum;
+	return result;
+}
+
+inline int32 math::Nearest(std::span<const Vector2f> points, const Vector2f& target) noexcept
+{
+	return detail::FindNearest(points, target, 0).index;
+}
+
+inline int32 math::Nearest(const parallel::Policy& policy, std::span<const Vector2f> points, const Vector2f& target)
+{
+	const std::vector<detail::NearestPoint> nearests = detail::ReduceChunks<detail::NearestPoint>(static_cast<int32>(points.size()), policy, [&](const int32 begin, const int32 end)
+	{
+		return detail::FindNearest(points.subspan(begin, end - begin), target, begin);
+	});
+
+	// the chunks are in order so a strictly closer point is needed to replace an earlier one
+	detail::NearestPoint result;
+	for (const detail::NearestPoint& nearest : nearests)
+	{
+		if (IsCloser(nearest.distanceSqr, result))
+			result = nearest;
+	}
+	return result.index;
+}
@@ -0,0 +1,800 @@
+#pragma once
+
+#include <bit>
+#include <cmath>
+#include <cstdint>
+
+// Instruction sets are picked at compile time from the compiler flags.
+// Define MATH_SIMD_SCALAR to force the portable fallback regardless of the target.
+#if !defined(MATH_SIMD_SCALAR)
+#if defined(__AVX2__)
+#define MATH_SIMD_AVX2
+#endif
+#if defined(__AVX__)
+#define MATH_SIMD_AVX
+#endif
+#if defined(__SSE4_1__) || defined(__AVX__)
+#define MATH_SIMD_SSE4
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MATH_SIMD_SSE2
+#endif
+#if defined(__F16C__) || (defined(_MSC_VER) && defined(__AVX2__))
+#define MATH_SIMD_F16C
+#endif
+#if defined(__aarch64__) || defined(_M_ARM64)
+#define MATH_SIMD_NEON
+#endif
+#endif
+
+#if defined(MATH_SIMD_SSE2)
+#include <immintrin.h>
+#elif defined(MATH_SIMD_NEON)
+#include <arm_neon.h>
+#endif
+
+/// \brief Thin wrappers around the native vector registers so that kernels can be written once
+/// and compiled for SSE, AVX, NEON or plain scalar code.
+///
+/// RSqrtFast uses the hardware reciprocal square root estimate refined with Newton-Raphson, it has a
+/// max relative error of 4e-7 for positive normal inputs while 0 and denormals return NaN.
+///
+/// Round rounds to the nearest whole number with ties going to even, unlike math::Round which
+/// rounds ties away from zero, because that is what the hardware rounding instructions do.
+/// StoreInt converts each lane to an int32 by truncating towards zero, so it is exact for the
+/// results of Round, Floor and Ceiling that are within the range of an int32.
+///
+/// LoadHalf and StoreHalf convert between floats and the bits of half precision floats, rounding to
+/// nearest even, with the F16C instructions where they are available. LoadInt16 and StoreInt16 convert
+/// between floats and int16, StoreInt16 truncates like StoreInt and the lanes must fit in an int16.
+/// LoadDouble subtracts an offset from each double and StoreDouble adds it back before they are converted,
+/// so that the subtraction doesn't lose the precision of the doubles. The even lanes use the even offset and
+/// the odd lanes the odd offset so that interleaved x and y can be made relative to a 2d origin, a single
+/// float is lane 0 and only uses the even offset.
+///
+/// MulAdd uses a fused multiply-add where the target has one, which rounds once, and the compiler may also
+/// fuse a Mul that is followed by an Add. MulAddUnfused always rounds the product before the addition so
+/// that its result is the same on every instruction set, for code that must be reproducible across machines.
+///
+/// Every operation is also overloaded for a single float so that the same kernel body can be
+/// used to process the tail of an array. Comparisons return a mask of the same type as their
+/// inputs with all bits set in each lane where the comparison holds, BitMask packs the top bit of
+/// each lane of a mask into an integer with lane 0 in the lowest bit.
+namespace simd
+{
+#if defined(MATH_SIMD_SSE2)
+	using float4 = __m128;
+#elif defined(MATH_SIMD_NEON)
+	using float4 = float32x4_t;
+#else
+	struct float4 { float v[4]; };
+#endif
+
+#if defined(MATH_SIMD_AVX)
+	using float8 = __m256;
+#else
+	struct float8 { float4 lo, hi; };
+#endif
+
+	/// \brief Widest register type that is natively supported by the target.
+#if defined(MATH_SIMD_AVX)
+	using floatn = float8;
+#else
+	using floatn = float4;
+#endif
+
+	/// \brief Maps a number of floats to the register type that holds them.
+	template<int32_t Width> struct Register;
+	template<> struct Register<1> { using Type = float; };
+	template<> struct Register<4> { using Type = float4; };
+	template<> struct Register<8> { using Type = float8; };
+
+	/// \brief Number of floats that are stored in the widest register type.
+	constexpr int32_t Width = sizeof(floatn) / sizeof(float);
+
+	/// \brief Alignment in bytes that the batch containers use for their lanes.
+	constexpr int32_t Alignment = 64;
+
+	/// \brief Returns value unchanged but hides where it came from, so that the compiler can't contract the
+	/// multiplication that produced it with the addition that uses it.
+	template<typename Type>
+	inline Type Opaque(Type value) noexcept
+	{
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && defined(MATH_SIMD_SSE2)
+		asm("" : "+x"(value));
+#elif defined(__GNUC__) && defined(MATH_SIMD_NEON)
+		asm("" : "+w"(value));
+#elif defined(__GNUC__)
+		asm("" : "+m"(value));
+#endif
+		return value;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// float
+
+	inline float Add(const float a, const float b) noexcept { return a + b; }
+	inline float Sub(const float a, const float b) noexcept { return a - b; }
+	inline float Mul(const float a, const float b) noexcept { return a * b; }
+	inline float Div(const float a, const float b) noexcept { return a / b; }
+	inline float MulAdd(const float a, const float b, const float c) noexcept { return a * b + c; }
+	inline float MulAddUnfused(const float a, const float b, const float c) noexcept { return Opaque(a * b) + c; }
+	inline float Min(const float a, const float b) noexcept { return (a < b) ? a : b; }
+	inline float Max(const float a, const float b) noexcept { return (a > b) ? a : b; }
+	inline float Neg(const float a) noexcept { return -a; }
+	inline float Sqrt(const float a) noexcept { return std::sqrt(a); }
+	inline float RSqrt(const float a) noexcept { return 1.f / std::sqrt(a); }
+#if defined(MATH_SIMD_SSE2)
+	inline float RSqrtFast(const float a) noexcept
+	{
+		const float estimate = _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(a)));
+		return 0.5f * estimate * (3.f - a * estimate * estimate);
+	}
+#elif defined(MATH_SIMD_NEON)
+	inline float RSqrtFast(const float a) noexcept
+	{
+		// the neon estimate is only accurate to 8 bits so it needs an extra step
+		float estimate = vrsqrtes_f32(a);
+		estimate *= vrsqrtss_f32(a * estimate, estimate);
+		return estimate * vrsqrtss_f32(a * estimate, estimate);
+	}
+#else
+	inline float RSqrtFast(const float a) noexcept { return 1.f / std::sqrt(a); }
+#endif
+#if defined(MATH_SIMD_SSE4)
+	inline float Round(const float a) noexcept { const __m128 b = _mm_set_ss(a); return _mm_cvtss_f32(_mm_round_ss(b, b, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC)); }
+	inline float Floor(const float a) noexcept { const __m128 b = _mm_set_ss(a); return _mm_cvtss_f32(_mm_round_ss(b, b, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC)); }
+	inline float Ceiling(const float a) noexcept { const __m128 b = _mm_set_ss(a); return _mm_cvtss_f32(_mm_round_ss(b, b, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC)); }
+#elif defined(MATH_SIMD_SSE2)
+	inline float Round(const float a) noexcept
+	{
+		// the integer conversion overflows above 2^31, but every float with a magnitude of at least 2^23 is already whole
+		return (std::fabs(a) < 8388608.f) ? static_cast<float>(_mm_cvtss_si32(_mm_set_ss(a))) : a;
+	}
+	inline float Floor(const float a) noexcept { const float rounded = Round(a); return (rounded > a) ? rounded - 1.f : rounded; }
+	inline float Ceiling(const float a) noexcept { const float rounded = Round(a); return (rounded < a) ? rounded + 1.f : rounded; }
+#else
+	inline float Round(const float a) noexcept { return std::nearbyint(a); }
+	inline float Floor(const float a) noexcept { return std::floor(a); }
+	inline float Ceiling(const float a) noexcept { return std::ceil(a); }
+#endif
+
+	inline float ToMask(const bool value) noexcept { return std::bit_cast<float>(value ? 0xFFFFFFFFu : 0u); }
+	inline float CmpEq(const float a, const float b) noexcept { return ToMask(a == b); }
+	inline float CmpGt(const float a, const float b) noexcept { return ToMask(a > b); }
+	inline float CmpGe(const float a, const float b) noexcept { return ToMask(a >= b); }
+	inline float CmpLt(const float a, const float b) noexcept { return ToMask(a < b); }
+	inline float CmpLe(const float a, const float b) noexcept { return ToMask(a <= b); }
+	inline float Select(const float mask, const float a, const float b) noexcept { return std::bit_cast<uint32_t>(mask) ? a : b; }
+	inline bool Any(const float mask) noexcept { return std::bit_cast<uint32_t>(mask) != 0; }
+	inline uint32_t BitMask(const float mask) noexcept { return std::bit_cast<uint32_t>(mask) >> 31; }
+	inline float And(const float a, const float b) noexcept { return std::bit_cast<float>(std::bit_cast<uint32_t>(a) & std::bit_cast<uint32_t>(b)); }
+	inline float Or(const float a, const float b) noexcept { return std::bit_cast<float>(std::bit_cast<uint32_t>(a) | std::bit_cast<uint32_t>(b)); }
+	inline float Xor(const float a, const float b) noexcept { return std::bit_cast<float>(std::bit_cast<uint32_t>(a) ^ std::bit_cast<uint32_t>(b)); }
+
+	template<typename Float> Float Splat(const float value) noexcept;
+	template<typename Float> Float Load(const float* values) noexcept;
+	template<typename Float> Float LoadAligned(const float* values) noexcept;
+	template<typename Float> Float LoadHalf(const uint16_t* values) noexcept;
+	template<typename Float> Float LoadInt16(const int16_t* values) noexcept;
+	template<typename Float> Float LoadDouble(const double* values, const double even, const double odd) noexcept;
+
+	template<> inline float Splat<float>(const float value) noexcept { return value; }
+	template<> inline float Load<float>(const float* values) noexcept { return *values; }
+	template<> inline float LoadAligned<float>(const float* values) noexcept { return *values; }
+	inline void Store(float* values, const float a) noexcept { *values = a; }
+	inline void StoreInt(int32_t* values, const float a) noexcept { *values = static_cast<int32_t>(a); }
+
+#if defined(MATH_SIMD_F16C)
+	inline uint16_t ToHalf(const float a) noexcept { return static_cast<uint16_t>(_cvtss_sh(a, _MM_FROUND_TO_NEAREST_INT)); }
+	inline float FromHalf(const uint16_t a) noexcept { return _cvtsh_ss(a); }
+#else
+	inline uint16_t ToHalf(const float a) noexcept
+	{
+		const uint32_t bits = std::bit_cast<uint32_t>(a);
+		const uint32_t sign = (bits >> 16) & 0x8000u;
+		const uint32_t magnitude = bits & 0x7FFFFFFFu;
+		// infinity and NaN, which stays a quiet NaN
+		if (magnitude >= 0x7F800000u)
+			return static_cast<uint16_t>(sign | 0x7C00u | ((magnitude > 0x7F800000u) ? 0x200u : 0u));
+		// values that round to 65520 or more overflow to infinity
+		if (magnitude >= 0x477FF000u)
+			return static_cast<uint16_t>(sign | 0x7C00u);
+
+		// normal halves re-bias the exponent, smaller values shift the mantissa with its implicit bit into a subnormal
+		uint32_t value, shift;
+		if (magnitude >= 0x38800000u)
+		{
+			value = magnitude - 0x38000000u;
+			shift = 13;
+		}
+		else
+		{
+			shift = 126 - (magnitude >> 23);
+			if (shift > 24)
+				return static_cast<uint16_t>(sign);
+			value = (magnitude & 0x7FFFFFu) | 0x800000u;
+		}
+
+		// round to nearest even, a carry out of the mantissa correctly increments the exponent
+		const uint32_t half = 1u << (shift - 1);
+		const uint32_t remainder = value & ((1u << shift) - 1);
+		uint32_t result = value >> shift;
+		if (remainder > half || (remainder == half && (result & 1)))
+			result++;
+		return static_cast<uint16_t>(sign | result);
+	}
+	inline float FromHalf(const uint16_t a) noexcept
+	{
+		const uint32_t sign = static_cast<uint32_t>(a & 0x8000u) << 16;
+		const uint32_t exponent = (a >> 10) & 0x1Fu;
+		const uint32_t mantissa = a & 0x3FFu;
+		if (exponent == 0x1F)
+			return std::bit_cast<float>(sign | 0x7F800000u | (mantissa << 13));
+		if (exponent == 0)
+			return std::bit_cast<float>(sign | std::bit_cast<uint32_t>(static_cast<float>(mantissa) * 5.9604644775390625e-8f));
+		return std::bit_cast<float>(sign | ((exponent + 112) << 23) | (mantissa << 13));
+	}
+#endif
+	template<> inline float LoadHalf<float>(const uint16_t* values) noexcept { return FromHalf(*values); }
+	template<> inline float LoadInt16<float>(const int16_t* values) noexcept { return static_cast<float>(*values); }
+	inline void StoreHalf(uint16_t* values, const float a) noexcept { *values = ToHalf(a); }
+	inline void StoreInt16(int16_t* values, const float a) noexcept { *values = static_cast<int16_t>(a); }
+	template<> inline float LoadDouble<float>(const double* values, const double even, const double) noexcept { return static_cast<float>(*values - even); }
+	inline void StoreDouble(double* values, const float a, const double even, const double) noexcept { *values = static_cast<double>(a) + even; }
+	inline void StoreAligned(float* values, const float a) noexcept { *values = a; }
+	inline void Deinterleave(const float* values, float& x, float& y) noexcept { x = values[0]; y = values[1]; }
+	inline void Interleave(float* values, const float x, const float y) noexcept { values[0] = x; values[1] = y; }
+	inline void Deinterleave3(const float* values, float& x, float& y, float& z) noexcept { x = values[0]; y = values[1]; z = values[2]; }
+	inline void Interleave3(float* values, const float x, const float y, const float z) noexcept { values[0] = x; values[1] = y; values[2] = z; }
+	inline void Deinterleave4(const float* values, float& x, float& y, float& z, float& w) noexcept { x = values[0]; y = values[1]; z = values[2]; w = values[3]; }
+
+	//////////////////////////////////////////////////////////////////////////
+	// float4
+
+#if defined(MATH_SIMD_SSE2)
+	inline float4 Add(const float4 a, const float4 b) noexcept { return _mm_add_ps(a, b); }
+	inline float4 Sub(const float4 a, const float4 b) noexcept { return _mm_sub_ps(a, b); }
+	inline float4 Mul(const float4 a, const float4 b) noexcept { return _mm_mul_ps(a, b); }
+	inline float4 Div(const float4 a, const float4 b) noexcept { return _mm_div_ps(a, b); }
+#if defined(__FMA__)
+	inline float4 MulAdd(const float4 a, const float4 b, const float4 c) noexcept { return _mm_fmadd_ps(a, b, c); }
+#else
+	inline float4 MulAdd(const float4 a, const float4 b, const float4 c) noexcept { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+#endif
+	inline float4 MulAddUnfused(const float4 a, const float4 b, const float4 c) noexcept { return _mm_add_ps(Opaque(_mm_mul_ps(a, b)), c); }
+	inline float4 Min(const float4 a, const float4 b) noexcept { return _mm_min_ps(a, b); }
+	inline float4 Max(const float4 a, const float4 b) noexcept { return _mm_max_ps(a, b); }
+	inline float4 Neg(const float4 a) noexcept { return _mm_xor_ps(a, _mm_set1_ps(-0.f)); }
+	inline float4 Sqrt(const float4 a) noexcept { return _mm_sqrt_ps(a); }
+	inline float4 RSqrt(const float4 a) noexcept { return _mm_div_ps(_mm_set1_ps(1.f), _mm_sqrt_ps(a)); }
+	inline float4 RSqrtFast(const float4 a) noexcept
+	{
+		const __m128 estimate = _mm_rsqrt_ps(a);
+		const __m128 step = _mm_sub_ps(_mm_set1_ps(3.f), _mm_mul_ps(_mm_mul_ps(a, estimate), estimate));
+		return _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(0.5f), estimate), step);
+	}
+#if defined(MATH_SIMD_SSE4)
+	inline float4 Round(const float4 a) noexcept { return _mm_round_ps(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+	inline float4 Floor(const float4 a) noexcept { return _mm_round_ps(a, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC); }
+	inline float4 Ceiling(const float4 a) noexcept { return _mm_round_ps(a, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC); }
+#else
+	inline float4 Round(const float4 a) noexcept
+	{
+		// the integer conversion overflows above 2^31, but every float with a magnitude of at least 2^23 is already whole
+		const __m128 rounded = _mm_cvtepi32_ps(_mm_cvtps_epi32(a));
+		const __m128 whole = _mm_cmpge_ps(_mm_andnot_ps(_mm_set1_ps(-0.f), a), _mm_set1_ps(8388608.f));
+		return _mm_or_ps(_mm_and_ps(whole, a), _mm_andnot_ps(whole, rounded));
+	}
+	inline float4 Floor(const float4 a) noexcept
+	{
+		const __m128 rounded = Round(a);
+		return _mm_sub_ps(rounded, _mm_and_ps(_mm_cmpgt_ps(rounded, a), _mm_set1_ps(1.f)));
+	}
+	inline float4 Ceiling(const float4 a) noexcept
+	{
+		const __m128 rounded = Round(a);
+		return _mm_add_ps(rounded, _mm_and_ps(_mm_cmplt_ps(rounded, a), _mm_set1_ps(1.f)));
+	}
+#endif
+
+	inline float4 CmpEq(const float4 a, const float4 b) noexcept { return _mm_cmpeq_ps(a, b); }
+	inline float4 CmpGt(const float4 a, const float4 b) noexcept { return _mm_cmpgt_ps(a, b); }
+	inline float4 CmpGe(const float4 a, const float4 b) noexcept { return _mm_cmpge_ps(a, b); }
+	inline float4 CmpLt(const float4 a, const float4 b) noexcept { return _mm_cmplt_ps(a, b); }
+	inline float4 CmpLe(const float4 a, const float4 b) noexcept { return _mm_cmple_ps(a, b); }
+#if defined(MATH_SIMD_SSE4)
+	inline float4 Select(const float4 mask, const float4 a, const float4 b) noexcept { return _mm_blendv_ps(b, a, mask); }
+#else
+	inline float4 Select(const float4 mask, const float4 a, const float4 b) noexcept { return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b)); }
+#endif
+	inline bool Any(const float4 mask) noexcept { return _mm_movemask_ps(mask) != 0; }
+	inline uint32_t BitMask(const float4 mask) noexcept { return static_cast<uint32_t>(_mm_movemask_ps(mask)); }
+	inline float4 And(const float4 a, const float4 b) noexcept { return _mm_and_ps(a, b); }
+	inline float4 Or(const float4 a, const float4 b) noexcept { return _mm_or_ps(a, b); }
+	inline float4 Xor(const float4 a, const float4 b) noexcept { return _mm_xor_ps(a, b); }
+
+	template<> inline float4 Splat<float4>(const float value) noexcept { return _mm_set1_ps(value); }
+	template<> inline float4 Load<float4>(const float* values) noexcept { return _mm_loadu_ps(values); }
+	template<> inline float4 LoadAligned<float4>(const float* values) noexcept { return _mm_load_ps(values); }
+	inline void Store(float* values, const float4 a) noexcept { _mm_storeu_ps(values, a); }
+	inline void StoreInt(int32_t* values, const float4 a) noexcept { _mm_storeu_si128(reinterpret_cast<__m128i*>(values), _mm_cvttps_epi32(a)); }
+#if defined(MATH_SIMD_F16C)
+	template<> inline float4 LoadHalf<float4>(const uint16_t* values) noexcept { return _mm_cvtph_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(values))); }
+	inline void StoreHalf(uint16_t* values, const float4 a) noexcept { _mm_storel_epi64(reinterpret_cast<__m128i*>(values), _mm_cvtps_ph(a, _MM_FROUND_TO_NEAREST_INT)); }
+#else
+	template<> inline float4 LoadHalf<float4>(const uint16_t* values) noexcept { return _mm_setr_ps(FromHalf(values[0]), FromHalf(values[1]), FromHalf(values[2]), FromHalf(values[3])); }
+	inline void StoreHalf(uint16_t* values, const float4 a) noexcept
+	{
+		alignas(16) float lanes[4];
+		_mm_store_ps(lanes, a);
+		for (int32_t i = 0; i < 4; ++i)
+			values[i] = ToHalf(lanes[i]);
+	}
+#endif
+	template<> inline float4 LoadInt16<float4>(const int16_t* values) noexcept
+	{
+		// each value is moved into the upper half of a 32 bit lane and shifted back down to sign extend it
+		const __m128i packed = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(values));
+		return _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(packed, packed), 16));
+	}
+	inline void StoreInt16(int16_t* values, const float4 a) noexcept
+	{
+		const __m128i integers = _mm_cvttps_epi32(a);
+		_mm_storel_epi64(reinterpret_cast<__m128i*>(values), _mm_packs_epi32(integers, integers));
+	}
+	template<> inline float4 LoadDouble<float4>(const double* values, const double even, const double odd) noexcept
+	{
+		const __m128d offset = _mm_setr_pd(even, odd);
+		const __m128 lo = _mm_cvtpd_ps(_mm_sub_pd(_mm_loadu_pd(values), offset));
+		const __m128 hi = _mm_cvtpd_ps(_mm_sub_pd(_mm_loadu_pd(values + 2), offset));
+		return _mm_movelh_ps(lo, hi);
+	}
+	inline void StoreDouble(double* values, const float4 a, const double even, const double odd) noexcept
+	{
+		const __m128d offset = _mm_setr_pd(even, odd);
+		_mm_storeu_pd(values, _mm_add_pd(_mm_cvtps_pd(a), offset));
+		_mm_storeu_pd(values + 2, _mm_add_pd(_mm_cvtps_pd(_mm_movehl_ps(a, a)), offset));
+	}
+	inline void StoreAligned(float* values, const float4 a) noexcept { _mm_store_ps(values, a); }
+	inline void Deinterleave(const float* values, float4& x, float4& y) noexcept
+	{
+		const __m128 a = _mm_loadu_ps(values);
+		const __m128 b = _mm_loadu_ps(values + 4);
+		x = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+		y = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+	}
+	inline void Interleave(float* values, const float4 x, const float4 y) noexcept
+	{
+		_mm_storeu_ps(values, _mm_unpacklo_ps(x, y));
+		_mm_storeu_ps(values + 4, _mm_unpackhi_ps(x, y));
+	}
+
+	inline void Deinterleave3(const float* values, float4& x, float4& y, float4& z) noexcept
+	{
+		// a = x0 y0 z0 x1, b = y1 z1 x2 y2, c = z2 x3 y3 z3
+		const __m128 a = _mm_loadu_ps(values);
+		const __m128 b = _mm_loadu_ps(values + 4);
+		const __m128 c = _mm_loadu_ps(values + 8);
+		x = _mm_shuffle_ps(a, _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 3, 0));
+		y = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)), _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+		z = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)), c, _MM_SHUFFLE(3, 0, 2, 0));
+	}
+	inline void Interleave3(float* values, const float4 x, const float4 y, const float4 z) noexcept
+	{
+		const __m128 a = _mm_shuffle_ps(_mm_shuffle_ps(x, y, _MM_SHUFFLE(0, 0, 0, 0)), _mm_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+		const __m128 b = _mm_shuffle_ps(_mm_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1)), _mm_shuffle_ps(x, y, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0));
+		const __m128 c = _mm_shuffle_ps(_mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2)), _mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+		_mm_storeu_ps(values, a);
+		_mm_storeu_ps(values + 4, b);
+		_mm_storeu_ps(values + 8, c);
+	}
+
+	inline void Deinterleave4(const float* values, float4& x, float4& y, float4& z, float4& w) noexcept
+	{
+		// transposes the 4x4 matrix where each row is one element
+		const __m128 a = _mm_unpacklo_ps(_mm_loadu_ps(values), _mm_loadu_ps(values + 4));
+		const __m128 b = _mm_unpackhi_ps(_mm_loadu_ps(values), _mm_loadu_ps(values + 4));
+		const __m128 c = _mm_unpacklo_ps(_mm_loadu_ps(values + 8), _mm_loadu_ps(values + 12));
+		const __m128 d = _mm_unpackhi_ps(_mm_loadu_ps(values + 8), _mm_loadu_ps(values + 12));
+		x = _mm_movelh_ps(a, c);
+		y = _mm_movehl_ps(c, a);
+		z = _mm_movelh_ps(b, d);
+		w = _mm_movehl_ps(d, b);
+	}
+
+	inline float4 Set(const float x, const float y, const float z, const float w) noexcept { return _mm_set_ps(w, z, y, x); }
+	template<int32_t X, int32_t Y, int32_t Z, int32_t W> inline float4 Shuffle(const float4 a) noexcept { return _mm_shuffle_ps(a, a, _MM_SHUFFLE(W, Z, Y, X)); }
+	template<int32_t Lane> inline float GetLane(const float4 a) noexcept { return _mm_cvtss_f32(_mm_shuffle_ps(a, a, _MM_SHUFFLE(Lane, Lane, Lane, Lane))); }
+#if defined(MATH_SIMD_SSE4)
+	inline float4 Dot3(const float4 a, const float4 b) noexcept { return _mm_dp_ps(a, b, 0x7F); }
+#else
+	inline float4 Dot3(const float4 a, const float4 b) noexcept
+	{
+		const __m128 m = _mm_mul_ps(a, b);
+		const __m128 sum = _mm_add_ss(_mm_add_ss(m, _mm_shuffle_ps(m, m, _MM_SHUFFLE(1, 1, 1, 1))), _mm_shuffle_ps(m, m, _MM_SHUFFLE(2, 2, 2, 2)));
+		return _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(0, 0, 0, 0));
+	}
+#endif
+	inline float4 Cross3(const float4 a, const float4 b) noexcept
+	{
+		const __m128 ayzx = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 byzx = _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m128 c = _mm_sub_ps(_mm_mul_ps(a, byzx), _mm_mul_ps(ayzx, b));
+		return _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 0, 2, 1));
+	}
+#elif defined(MATH_SIMD_NEON)
+	inline float4 Add(const float4 a, const float4 b) noexcept { return vaddq_f32(a, b); }
+	inline float4 Sub(const float4 a, const float4 b) noexcept { return vsubq_f32(a, b); }
+	inline float4 Mul(const float4 a, const float4 b) noexcept { return vmulq_f32(a, b); }
+	inline float4 Div(const float4 a, const float4 b) noexcept { return vdivq_f32(a, b); }
+	inline float4 MulAdd(const float4 a, const float4 b, const float4 c) noexcept { return vfmaq_f32(c, a, b); }
+	inline float4 MulAddUnfused(const float4 a, const float4 b, const float4 c) noexcept { return vaddq_f32(Opaque(vmulq_f32(a, b)), c); }
+	inline float4 Min(const float4 a, const float4 b) noexcept { return vminq_f32(a, b); }
+	inline float4 Max(const float4 a, const float4 b) noexcept { return vmaxq_f32(a, b); }
+	inline float4 Neg(const float4 a) noexcept { return vnegq_f32(a); }
+	inline float4 Sqrt(const float4 a) noexcept { return vsqrtq_f32(a); }
+	inline float4 RSqrt(const float4 a) noexcept { return vdivq_f32(vdupq_n_f32(1.f), vsqrtq_f32(a)); }
+	inline float4 RSqrtFast(const float4 a) noexcept
+	{
+		float32x4_t estimate = vrsqrteq_f32(a);
+		estimate = vmulq_f32(estimate, vrsqrtsq_f32(vmulq_f32(a, estimate), estimate));
+		return vmulq_f32(estimate, vrsqrtsq_f32(vmulq_f32(a, estimate), estimate));
+	}
+	inline float4 Round(const float4 a) noexcept { return vrndnq_f32(a); }
+	inline float4 Floor(const float4 a) noexcept { return vrndmq_f32(a); }
+	inline float4 Ceiling(const float4 a) noexcept { return vrndpq_f32(a); }
+
+	inline float4 CmpEq(const float4 a, const float4 b) noexcept { return vreinterpretq_f32_u32(vceqq_f32(a, b)); }
+	inline float4 CmpGt(const float4 a, const float4 b) noexcept { return vreinterpretq_f32_u32(vcgtq_f32(a, b)); }
+	inline float4 CmpGe(const float4 a, const float4 b) noexcept { return vreinterpretq_f32_u32(vcgeq_f32(a, b)); }
+	inline float4 CmpLt(const float4 a, const float4 b) noexcept { return vreinterpretq_f32_u32(vcltq_f32(a, b)); }
+	inline float4 CmpLe(const float4 a, const float4 b) noexcept { return vreinterpretq_f32_u32(vcleq_f32(a, b)); }
+	inline float4 Select(const float4 mask, const float4 a, const float4 b) noexcept { return vbslq_f32(vreinterpretq_u32_f32(mask), a, b); }
+	inline bool Any(const float4 mask) noexcept { return vmaxvq_u32(vreinterpretq_u32_f32(mask)) != 0; }
+	inline uint32_t BitMask(const float4 mask) noexcept
+	{
+		const int32x4_t shifts = { 0, 1, 2, 3 };
+		return vaddvq_u32(vshlq_u32(vshrq_n_u32(vreinterpretq_u32_f32(mask), 31), shifts));
+	}
+	inline float4 And(const float4 a, const float4 b) noexcept { return vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(a), vreinterpretq_u32_f32(b))); }
+	inline float4 Or(const float4 a, const float4 b) noexcept { return vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(a), vreinterpretq_u32_f32(b))); }
+	inline float4 Xor(const float4 a, const float4 b) noexcept { return vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(a), vreinterpretq_u32_f32(b))); }
+
+	template<> inline float4 Splat<float4>(const float value) noexcept { return vdupq_n_f32(value); }
+	template<> inline float4 Load<float4>(const float* values) noexcept { return vld1q_f32(values); }
+	template<> inline float4 LoadAligned<float4>(const float* values) noexcept { return vld1q_f32(values); }
+	inline void Store(float* values, const float4 a) noexcept { vst1q_f32(values, a); }
+	inline void StoreInt(int32_t* values, const float4 a) noexcept { vst1q_s32(values, vcvtq_s32_f32(a)); }
+	template<> inline float4 LoadHalf<float4>(const uint16_t* values) noexcept { return vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(values))); }
+	template<> inline float4 LoadInt16<float4>(const int16_t* values) noexcept { return vcvtq_f32_s32(vmovl_s16(vld1_s16(values))); }
+	inline void StoreHalf(uint16_t* values, const float4 a) noexcept { vst1_u16(values, vreinterpret_u16_f16(vcvt_f16_f32(a))); }
+	inline void StoreInt16(int16_t* values, const float4 a) noexcept { vst1_s16(values, vqmovn_s32(vcvtq_s32_f32(a))); }
+	template<> inline float4 LoadDouble<float4>(const double* values, const double even, const double odd) noexcept
+	{
+		const double offsets[2] = { even, odd };
+		const float64x2_t offset = vld1q_f64(offsets);
+		return vcombine_f32(vcvt_f32_f64(vsubq_f64(vld1q_f64(values), offset)), vcvt_f32_f64(vsubq_f64(vld1q_f64(values + 2), offset)));
+	}
+	inline void StoreDouble(double* values, const float4 a, const double even, const double odd) noexcept
+	{
+		const double offsets[2] = { even, odd };
+		const float64x2_t offset = vld1q_f64(offsets);
+		vst1q_f64(values, vaddq_f64(vcvt_f64_f32(vget_low_f32(a)), offset));
+		vst1q_f64(values + 2, vaddq_f64(vcvt_high_f64_f32(a), offset));
+	}
+	inline void StoreAligned(float* values, const float4 a) noexcept { vst1q_f32(values, a); }
+	inline void Deinterleave(const float* values, float4& x, float4& y) noexcept
+	{
+		const float32x4x2_t result = vld2q_f32(values);
+		x = result.val[0];
+		y = result.val[1];
+	}
+	inline void Interleave(float* values, const float4 x, const float4 y) noexcept { vst2q_f32(values, float32x4x2_t{ { x, y } }); }
+
+	inline void Deinterleave3(const float* values, float4& x, float4& y, float4& z) noexcept
+	{
+		const float32x4x3_t result = vld3q_f32(values);
+		x = result.val[0];
+		y = result.val[1];
+		z = result.val[2];
+	}
+	inline void Interleave3(float* values, const float4 x, const float4 y, const float4 z) noexcept { vst3q_f32(values, float32x4x3_t{ { x, y, z } }); }
+
+	inline void Deinterleave4(const float* values, float4& x, float4& y, float4& z, float4& w) noexcept
+	{
+		const float32x4x4_t result = vld4q_f32(values);
+		x = result.val[0];
+		y = result.val[1];
+		z = result.val[2];
+		w = result.val[3];
+	}
+
+	inline float4 Set(const float x, const float y, const float z, const float w) noexcept { const float values[4] = { x, y, z, w }; return vld1q_f32(values); }
+	template<int32_t X, int32_t Y, int32_t Z, int32_t W> inline float4 Shuffle(const float4 a) noexcept { return Set(vgetq_lane_f32(a, X), vgetq_lane_f32(a, Y), vgetq_lane_f32(a, Z), vgetq_lane_f32(a, W)); }
+	template<int32_t Lane> inline float GetLane(const float4 a) noexcept { return vgetq_lane_f32(a, Lane); }
+	inline float4 Dot3(const float4 a, const float4 b) noexcept { return vdupq_n_f32(vaddvq_f32(vsetq_lane_f32(0.f, vmulq_f32(a, b), 3))); }
+	inline float4 Cross3(const float4 a, const float4 b) noexcept
+	{
+		const float4 ayzx = Set(vgetq_lane_f32(a, 1), vgetq_lane_f32(a, 2), vgetq_lane_f32(a, 0), vgetq_lane_f32(a, 3));
+		const float4 byzx = Set(vgetq_lane_f32(b, 1), vgetq_lane_f32(b, 2), vgetq_lane_f32(b, 0), vgetq_lane_f32(b, 3));
+		const float4 c = vsubq_f32(vmulq_f32(a, byzx), vmulq_f32(ayzx, b));
+		return Set(vgetq_lane_f32(c, 1), vgetq_lane_f32(c, 2), vgetq_lane_f32(c, 0), vgetq_lane_f32(c, 3));
+	}
+#else
+	template<typename Function>
+	inline float4 Apply(const float4& a, const float4& b, Function&& function) noexcept
+	{
+		return float4{ function(a.v[0], b.v[0]), function(a.v[1], b.v[1]), function(a.v[2], b.v[2]), function(a.v[3], b.v[3]) };
+	}
+
+	inline float4 Add(const float4 a, const float4 b) noexcept { return Apply(a, b, [](float x, float y) { return Add(x, y); }); }
+	inline float4 Sub(const float4 a, const float4 b) noexcept { return Apply(a, b, [](float x, float y) { return Sub(x, y); }); }
+	inline float4 Mul(const float4 a, const float4 b) noexcept { return Apply(a, b, [](float x, float y) { return Mul(x, y); }); }
+	inline float4 Div(const float4 a, const float4 b) noexcept { return Apply(a, b, [](float x, float y) { return Div(x, y); }); }
+	inline float4 MulAdd(const float4 a, const float4 b, const float4 c) noexcept { return Add(Mul(a, b), c); }
+	inline float4 MulAddUnfused(const float4 a, const float4 b, const float4 c) noexcept { return Add(Opaque(Mul(a, b)), c); }
+	inline float4 Min(const float4 a, const float4 b) noexcept { return Apply(a, b, [](float x, float y) { return Min(x, y); }); }
+	inline float4 Max(const float4 a, const float4 b) noexcept { return Apply(a, b, [](float x, float y) { return Max(x, y); }); }
+	inline float4 Neg(const float4 a) noexcept { return Apply(a, a, [](float x, float) { return Neg(x); }); }
+	inline float4 Sqrt(const float4 a) noexcept { return Apply(a, a, [](float x, float) { return Sqrt(x); }); }
+	inline float4 RSqrt(const float4 a) noexcept { return Apply(a, a, [](float x, float) { return RSqrt(x); }); }
+	inline float4 RSqrtFast(const float4 a) noexcept { return Apply(a, a, [](float x, float) { return RSqrtFast(x); }); }
+	inline float4 Round(const float4 a) noexcept { return Apply(a, a, [](float x, float) { return Round(x); }); }
+	inline float4 Floor(const float4 a) noexcept { return Apply(a, a, [](float x, float) { return Floor(x); }); }
+	inline float4 Ceiling(const float4 a) noexcept { return Apply(a, a, [](float x, float) { return Ceiling(x); }); }
+
+	inline float4 CmpEq(const float4 a, const float4 b) noexcept { return Apply(a, b, [](float x, float y) { return CmpEq(x, y); }); }
+	inline float4 CmpGt(const float4 a, const float4 b) noexcept { return Apply(a, b, [](float x, float y) { return CmpGt(x, y); }); }
+	inline float4 CmpGe(const float4 a, const float4 b) noexcept { return Apply(a, b, [](float x, float y) { return CmpGe(x, y); }); }
+	inline float4 CmpLt(const float4 a, const float4 b) noexcept { return Apply(a, b, [](float x, float y) { return CmpLt(x, y); }); }
+	inline float4 CmpLe(const float4 a, const float4 b) noexcept { return Apply(a, b, [](float x, float y) { return CmpLe(x, y); }); }
+	inline float4 Select(const float4 mask, const float4 a, const float4 b) noexcept
+	{
+		return float4{ Select(mask.v[0], a.v[0], b.v[0]), Select(mask.v[1], a.v[1], b.v[1]), Select(mask.v[2], a.v[2], b.v[2]), Select(mask.v[3], a.v[3], b.v[3]) };
+	}
+	inline bool Any(const float4 mask) noexcept { return Any(mask.v[0]) || Any(mask.v[1]) || Any(mask.v[2]) || Any(mask.v[3]); }
+	inline uint32_t BitMask(const float4 mask) noexcept { return BitMask(mask.v[0]) | (BitMask(mask.v[1]) << 1) | (BitMask(mask.v[2]) << 2) | (BitMask(mask.v[3]) << 3); }
+	inline float4 And(const float4 a, const float4 b) noexcept { return Apply(a, b, [](float x, float y) { return And(x, y); }); }
+	inline float4 Or(const float4 a, const float4 b) noexcept { return Apply(a, b, [](float x, float y) { return Or(x, y); }); }
+	inline float4 Xor(const float4 a, const float4 b) noexcept { return Apply(a, b, [](float x, float y) { return Xor(x, y); }); }
+
+	template<> inline float4 Splat<float4>(const float value) noexcept { return float4{ value, value, value, value }; }
+	template<> inline float4 Load<float4>(const float* values) noexcept { return float4{ values[0], values[1], values[2], values[3] }; }
+	template<> inline float4 LoadAligned<float4>(const float* values) noexcept { return Load<float4>(values); }
+	inline void Store(float* values, const float4 a) noexcept { values[0] = a.v[0]; values[1] = a.v[1]; values[2] = a.v[2]; values[3] = a.v[3]; }
+	inline void StoreInt(int32_t* values, const float4 a) noexcept { for (int32_t i = 0; i < 4; ++i) values[i] = static_cast<int32_t>(a.v[i]); }
+	template<> inline float4 LoadHalf<float4>(const uint16_t* values) noexcept { return float4{ FromHalf(values[0]), FromHalf(values[1]), FromHalf(values[2]), FromHalf(values[3]) }; }
+	template<> inline float4 LoadInt16<float4>(const int16_t* values) noexcept { return float4{ static_cast<float>(values[0]), static_cast<float>(values[1]), static_cast<float>(values[2]), static_cast<float>(values[3]) }; }
+	inline void StoreHalf(uint16_t* values, const float4 a) noexcept { for (int32_t i = 0; i < 4; ++i) values[i] = ToHalf(a.v[i]); }
+	inline void StoreInt16(int16_t* values, const float4 a) noexcept { for (int32_t i = 0; i < 4; ++i) values[i] = static_cast<int16_t>(a.v[i]); }
+	template<> inline float4 LoadDouble<float4>(const double* values, const double even, const double odd) noexcept { return float4{ static_cast<float>(values[0] - even), static_cast<float>(values[1] - odd), static_cast<float>(values[2] - even), static_cast<float>(values[3] - odd) }; }
+	inline void StoreDouble(double* values, const float4 a, const double even, const double odd) noexcept { for (int32_t i = 0; i < 4; ++i) values[i] = static_cast<double>(a.v[i]) + ((i & 1) ? odd : even); }
+	inline void StoreAligned(float* values, const float4 a) noexcept { Store(values, a); }
+	inline void Deinterleave(const float* values, float4& x, float4& y) noexcept
+	{
+		x = float4{ values[0], values[2], values[4], values[6] };
+		y = float4{ values[1], values[3], values[5], values[7] };
+	}
+	inline void Interleave(float* values, const float4 x, const float4 y) noexcept
+	{
+		for (int32_t i = 0; i < 4; ++i)
+		{
+			values[i * 2 + 0] = x.v[i];
+			values[i * 2 + 1] = y.v[i];
+		}
+	}
+
+	inline void Deinterleave3(const float* values, float4& x, float4& y, float4& z) noexcept
+	{
+		x = float4{ values[0], values[3], values[6], values[9] };
+		y = float4{ values[1], values[4], values[7], values[10] };
+		z = float4{ values[2], values[5], values[8], values[11] };
+	}
+	inline void Interleave3(float* values, const float4 x, const float4 y, const float4 z) noexcept
+	{
+		for (int32_t i = 0; i < 4; ++i)
+		{
+			values[i * 3 + 0] = x.v[i];
+			values[i * 3 + 1] = y.v[i];
+			values[i * 3 + 2] = z.v[i];
+		}
+	}
+
+	inline void Deinterleave4(const float* values, float4& x, float4& y, float4& z, float4& w) noexcept
+	{
+		x = float4{ values[0], values[4], values[8], values[12] };
+		y = float4{ values[1], values[5], values[9], values[13] };
+		z = float4{ values[2], values[6], values[10], values[14] };
+		w = float4{ values[3], values[7], values[11], values[15] };
+	}
+
+	inline float4 Set(const float x, const float y, const float z, const float w) noexcept { return float4{ x, y, z, w }; }
+	template<int32_t X, int32_t Y, int32_t Z, int32_t W> inline float4 Shuffle(const float4 a) noexcept { return float4{ a.v[X], a.v[Y], a.v[Z], a.v[W] }; }
+	template<int32_t Lane> inline float GetLane(const float4 a) noexcept { return a.v[Lane]; }
+	inline float4 Dot3(const float4 a, const float4 b) noexcept { return Splat<float4>(a.v[0] * b.v[0] + a.v[1] * b.v[1] + a.v[2] * b.v[2]); }
+	inline float4 Cross3(const float4 a, const float4 b) noexcept
+	{
+		return float4{
+			a.v[1] * b.v[2] - a.v[2] * b.v[1],
+			a.v[2] * b.v[0] - a.v[0] * b.v[2],
+			a.v[0] * b.v[1] - a.v[1] * b.v[0],
+			0.f };
+	}
+#endif
+
+	//////////////////////////////////////////////////////////////////////////
+	// float8
+
+#if defined(MATH_SIMD_AVX)
+	inline float8 Add(const float8 a, const float8 b) noexcept { return _mm256_add_ps(a, b); }
+	inline float8 Sub(const float8 a, const float8 b) noexcept { return _mm256_sub_ps(a, b); }
+	inline float8 Mul(const float8 a, const float8 b) noexcept { return _mm256_mul_ps(a, b); }
+	inline float8 Div(const float8 a, const float8 b) noexcept { return _mm256_div_ps(a, b); }
+#if defined(__FMA__)
+	inline float8 MulAdd(const float8 a, const float8 b, const float8 c) noexcept { return _mm256_fmadd_ps(a, b, c); }
+#else
+	inline float8 MulAdd(const float8 a, const float8 b, const float8 c) noexcept { return _mm256_add_ps(_mm256_mul_ps(a, b), c); }
+#endif
+	inline float8 MulAddUnfused(const float8 a, const float8 b, const float8 c) noexcept { return _mm256_add_ps(Opaque(_mm256_mul_ps(a, b)), c); }
+	inline float8 Min(const float8 a, const float8 b) noexcept { return _mm256_min_ps(a, b); }
+	inline float8 Max(const float8 a, const float8 b) noexcept { return _mm256_max_ps(a, b); }
+	inline float8 Neg(const float8 a) noexcept { return _mm256_xor_ps(a, _mm256_set1_ps(-0.f)); }
+	inline float8 Sqrt(const float8 a) noexcept { return _mm256_sqrt_ps(a); }
+	inline float8 RSqrt(const float8 a) noexcept { return _mm256_div_ps(_mm256_set1_ps(1.f), _mm256_sqrt_ps(a)); }
+	inline float8 RSqrtFast(const float8 a) noexcept
+	{
+		const __m256 estimate = _mm256_rsqrt_ps(a);
+		const __m256 step = _mm256_sub_ps(_mm256_set1_ps(3.f), _mm256_mul_ps(_mm256_mul_ps(a, estimate), estimate));
+		return _mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(0.5f), estimate), step);
+	}
+	inline float8 Round(const float8 a) noexcept { return _mm256_round_ps(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+	inline float8 Floor(const float8 a) noexcept { return _mm256_round_ps(a, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC); }
+	inline float8 Ceiling(const float8 a) noexcept { return _mm256_round_ps(a, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC); }
+
+	inline float8 CmpEq(const float8 a, const float8 b) noexcept { return _mm256_cmp_ps(a, b, _CMP_EQ_OQ); }
+	inline float8 CmpGt(const float8 a, const float8 b) noexcept { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+	inline float8 CmpGe(const float8 a, const float8 b) noexcept { return _mm256_cmp_ps(a, b, _CMP_GE_OQ); }
+	inline float8 CmpLt(const float8 a, const float8 b) noexcept { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+	inline float8 CmpLe(const float8 a, const float8 b) noexcept { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+	inline float8 Select(const float8 mask, const float8 a, const float8 b) noexcept { return _mm256_blendv_ps(b, a, mask); }
+	inline bool Any(const float8 mask) noexcept { return _mm256_movemask_ps(mask) != 0; }
+	inline uint32_t BitMask(const float8 mask) noexcept { return static_cast<uint32_t>(_mm256_movemask_ps(mask)); }
+	inline float8 And(const float8 a, const float8 b) noexcept { return _mm256_and_ps(a, b); }
+	inline float8 Or(const float8 a, const float8 b) noexcept { return _mm256_or_ps(a, b); }
+	inline float8 Xor(const float8 a, const float8 b) noexcept { return _mm256_xor_ps(a, b); }
+
+	template<> inline float8 Splat<float8>(const float value) noexcept { return _mm256_set1_ps(value); }
+	template<> inline float8 Load<float8>(const float* values) noexcept { return _mm256_loadu_ps(values); }
+	template<> inline float8 LoadAligned<float8>(const float* values) noexcept { return _mm256_load_ps(values); }
+	inline void Store(float* values, const float8 a) noexcept { _mm256_storeu_ps(values, a); }
+	inline void StoreInt(int32_t* values, const float8 a) noexcept { _mm256_storeu_si256(reinterpret_cast<__m256i*>(values), _mm256_cvttps_epi32(a)); }
+#if defined(MATH_SIMD_F16C)
+	template<> inline float8 LoadHalf<float8>(const uint16_t* values) noexcept { return _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(values))); }
+	inline void StoreHalf(uint16_t* values, const float8 a) noexcept { _mm_storeu_si128(reinterpret_cast<__m128i*>(values), _mm256_cvtps_ph(a, _MM_FROUND_TO_NEAREST_INT)); }
+#else
+	template<> inline float8 LoadHalf<float8>(const uint16_t* values) noexcept { return _mm256_set_m128(LoadHalf<float4>(values + 4), LoadHalf<float4>(values)); }
+	inline void StoreHalf(uint16_t* values, const float8 a) noexcept { StoreHalf(values, _mm256_castps256_ps128(a)); StoreHalf(values + 4, _mm256_extractf128_ps(a, 1)); }
+#endif
+	template<> inline float8 LoadInt16<float8>(const int16_t* values) noexcept { return _mm256_set_m128(LoadInt16<float4>(values + 4), LoadInt16<float4>(values)); }
+	inline void StoreInt16(int16_t* values, const float8 a) noexcept
+	{
+		const __m256i integers = _mm256_cvttps_epi32(a);
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(values), _mm_packs_epi32(_mm256_castsi256_si128(integers), _mm256_extractf128_si256(integers, 1)));
+	}
+	template<> inline float8 LoadDouble<float8>(const double* values, const double even, const double odd) noexcept
+	{
+		const __m256d offset = _mm256_setr_pd(even, odd, even, odd);
+		const __m128 lo = _mm256_cvtpd_ps(_mm256_sub_pd(_mm256_loadu_pd(values), offset));
+		const __m128 hi = _mm256_cvtpd_ps(_mm256_sub_pd(_mm256_loadu_pd(values + 4), offset));
+		return _mm256_set_m128(hi, lo);
+	}
+	inline void StoreDouble(double* values, const float8 a, const double even, const double odd) noexcept
+	{
+		const __m256d offset = _mm256_setr_pd(even, odd, even, odd);
+		_mm256_storeu_pd(values, _mm256_add_pd(_mm256_cvtps_pd(_mm256_castps256_ps128(a)), offset));
+		_mm256_storeu_pd(values + 4, _mm256_add_pd(_mm256_cvtps_pd(_mm256_extractf128_ps(a, 1)), offset));
+	}
+	inline void StoreAligned(float* values, const float8 a) noexcept { _mm256_store_ps(values, a); }
+	inline void Deinterleave(const float* values, float8& x, float8& y) noexcept
+	{
+		const __m256 a = _mm256_loadu_ps(values);
+		const __m256 b = _mm256_loadu_ps(values + 8);
+		const __m256 lo = _mm256_permute2f128_ps(a, b, 0x20);
+		const __m256 hi = _mm256_permute2f128_ps(a, b, 0x31);
+		x = _mm256_shuffle_ps(lo, hi, _MM_SHUFFLE(2, 0, 2, 0));
+		y = _mm256_shuffle_ps(lo, hi, _MM_SHUFFLE(3, 1, 3, 1));
+	}
+	inline void Interleave(float* values, const float8 x, const float8 y) noexcept
+	{
+		const __m256 lo = _mm256_unpacklo_ps(x, y);
+		const __m256 hi = _mm256_unpackhi_ps(x, y);
+		_mm256_storeu_ps(values, _mm256_permute2f128_ps(lo, hi, 0x20));
+		_mm256_storeu_ps(values + 8, _mm256_permute2f128_ps(lo, hi, 0x31));
+	}
+	inline void Deinterleave3(const float* values, float8& x, float8& y, float8& z) noexcept
+	{
+		float4 xlo, ylo, zlo, xhi, yhi, zhi;
+		Deinterleave3(values, xlo, ylo, zlo);
+		Deinterleave3(values + 12, xhi, yhi, zhi);
+		x = _mm256_set_m128(xhi, xlo);
+		y = _mm256_set_m128(yhi, ylo);
+		z = _mm256_set_m128(zhi, zlo);
+	}
+	inline void Interleave3(float* values, const float8 x, const float8 y, const float8 z) noexcept
+	{
+		Interleave3(values, _mm256_castps256_ps128(x), _mm256_castps256_ps128(y), _mm256_castps256_ps128(z));
+		Interleave3(values + 12, _mm256_extractf128_ps(x, 1), _mm256_extractf128_ps(y, 1), _mm256_extractf128_ps(z, 1));
+	}
+
+	inline void Deinterleave4(const float* values, float8& x, float8& y, float8& z, float8& w) noexcept
+	{
+		float4 xlo, ylo, zlo, wlo, xhi, yhi, zhi, whi;
+		Deinterleave4(values, xlo, ylo, zlo, wlo);
+		Deinterleave4(values + 16, xhi, yhi, zhi, whi);
+		x = _mm256_set_m128(xhi, xlo);
+		y = _mm256_set_m128(yhi, ylo);
+		z = _mm256_set_m128(zhi, zlo);
+		w = _mm256_set_m128(whi, wlo);
+	}
+#else
+	inline float8 Add(const float8 a, const float8 b) noexcept { return float8{ Add(a.lo, b.lo), Add(a.hi, b.hi) }; }
+	inline float8 Sub(const float8 a, const float8 b) noexcept { return float8{ Sub(a.lo, b.lo), Sub(a.hi, b.hi) }; }
+	inline float8 Mul(const float8 a, const float8 b) noexcept { return float8{ Mul(a.lo, b.lo), Mul(a.hi, b.hi) }; }
+	inline float8 Div(const float8 a, const float8 b) noexcept { return float8{ Div(a.lo, b.lo), Div(a.hi, b.hi) }; }
+	inline float8 MulAdd(const float8 a, const float8 b, const float8 c) noexcept { return float8{ MulAdd(a.lo, b.lo, c.lo), MulAdd(a.hi, b.hi, c.hi) }; }
+	inline float8 MulAddUnfused(const float8 a, const float8 b, const float8 c) noexcept { return float8{ MulAddUnfused(a.lo, b.lo, c.lo), MulAddUnfused(a.hi, b.hi, c.hi) }; }
+	inline float8 Min(const float8 a, const float8 b) noexcept { return float8{ Min(a.lo, b.lo), Min(a.hi, b.hi) }; }
+	inline float8 Max(const float8 a, const float8 b) noexcept { return float8{ Max(a.lo, b.lo), Max(a.hi, b.hi) }; }
+	inline float8 Neg(const float8 a) noexcept { return float8{ Neg(a.lo), Neg(a.hi) }; }
+	inline float8 Sqrt(const float8 a) noexcept { return float8{ Sqrt(a.lo), Sqrt(a.hi) }; }
+	inline float8 RSqrt(const float8 a) noexcept { return float8{ RSqrt(a.lo), RSqrt(a.hi) }; }
+	inline float8 RSqrtFast(const float8 a) noexcept { return float8{ RSqrtFast(a.lo), RSqrtFast(a.hi) }; }
+	inline float8 Round(const float8 a) noexcept { return float8{ Round(a.lo), Round(a.hi) }; }
+	inline float8 Floor(const float8 a) noexcept { return float8{ Floor(a.lo), Floor(a.hi) }; }
+	inline float8 Ceiling(const float8 a) noexcept { return float8{ Ceiling(a.lo), Ceiling(a.hi) }; }
+
+	inline float8 CmpEq(const float8 a, const float8 b) noexcept { return float8{ CmpEq(a.lo, b.lo), CmpEq(a.hi, b.hi) }; }
+	inline float8 CmpGt(const float8 a, const float8 b) noexcept { return float8{ CmpGt(a.lo, b.lo), CmpGt(a.hi, b.hi) }; }
+	inline float8 CmpGe(const float8 a, const float8 b) noexcept { return float8{ CmpGe(a.lo, b.lo), CmpGe(a.hi, b.hi) }; }
+	inline float8 CmpLt(const float8 a, const float8 b) noexcept { return float8{ CmpLt(a.lo, b.lo), CmpLt(a.hi, b.hi) }; }
+	inline float8 CmpLe(const float8 a, const float8 b) noexcept { return float8{ CmpLe(a.lo, b.lo), CmpLe(a.hi, b.hi) }; }
+	inline float8 Select(const float8 mask, const float8 a, const float8 b) noexcept { return float8{ Select(mask.lo, a.lo, b.lo), Select(mask.hi, a.hi, b.hi) }; }
+	inline bool Any(const float8 mask) noexcept { return Any(mask.lo) || Any(mask.hi); }
+	inline uint32_t BitMask(const float8 mask) noexcept { return BitMask(mask.lo) | (BitMask(mask.hi) << 4); }
+	inline float8 And(const float8 a, const float8 b) noexcept { return float8{ And(a.lo, b.lo), And(a.hi, b.hi) }; }
+	inline float8 Or(const float8 a, const float8 b) noexcept { return float8{ Or(a.lo, b.lo), Or(a.hi, b.hi) }; }
+	inline float8 Xor(const float8 a, const float8 b) noexcept { return float8{ Xor(a.lo, b.lo), Xor(a.hi, b.hi) }; }
+
+	template<> inline float8 Splat<float8>(const float value) noexcept { return float8{ Splat<float4>(value), Splat<float4>(value) }; }
+	template<> inline float8 Load<float8>(const float* values) noexcept { return float8{ Load<float4>(values), Load<float4>(values + 4) }; }
+	template<> inline float8 LoadAligned<float8>(const float* values) noexcept { return float8{ LoadAligned<float4>(values), LoadAligned<float4>(values + 4) }; }
+	inline void Store(float* values, const float8 a) noexcept { Store(values, a.lo); Store(values + 4, a.hi); }
+	inline void StoreInt(int32_t* values, const float8 a) noexcept { StoreInt(values, a.lo); StoreInt(values + 4, a.hi); }
+	template<> inline float8 LoadHalf<float8>(const uint16_t* values) noexcept { return float8{ LoadHalf<float4>(values), LoadHalf<float4>(values + 4) }; }
+	template<> inline float8 LoadInt16<float8>(const int16_t* values) noexcept { return float8{ LoadInt16<float4>(values), LoadInt16<float4>(values + 4) }; }
+	inline void StoreHalf(uint16_t* values, const float8 a) noexcept { StoreHalf(values, a.lo); StoreHalf(values + 4, a.hi); }
+	inline void StoreInt16(int16_t* values, const float8 a) noexcept { StoreInt16(values, a.lo); StoreInt16(values + 4, a.hi); }
+	template<> inline float8 LoadDouble<float8>(const double* values, const double even, const double odd) noexcept { return float8{ LoadDouble<float4>(values, even, odd), LoadDouble<float4>(values + 4, even, odd) }; }
+	inline void StoreDouble(double* values, const float8 a, const double even, const double odd) noexcept { StoreDouble(values, a.lo, even, odd); StoreDouble(values + 4, a.hi, even, odd); }
+	inline void StoreAligned(float* values, const float8 a) noexcept { StoreAligned(values, a.lo); StoreAligned(values + 4, a.hi); }
+	inline void Deinterleave(const float* values, float8& x, float8& y) noexcept { Deinterleave(values, x.lo, y.lo); Deinterleave(values + 8, x.hi, y.hi); }
+	inline void Interleave(float* values, const float8 x, const float8 y) noexcept { Interleave(values, x.lo, y.lo); Interleave(values + 8, x.hi, y.hi); }
+	inline void Deinterleave3(const float* values, float8& x, float8& y, float8& z) noexcept { Deinterleave3(values, x.lo, y.lo, z.lo); Deinterleave3(values + 12, x.hi, y.hi, z.hi); }
+	inline void Interleave3(float* values, const float8 x, const float8 y, const float8 z) noexcept { Interleave3(values, x.lo, y.lo, z.lo); Interleave3(values + 12, x.hi, y.hi, z.hi); }
+	inline void Deinterleave4(const float* values, float8& x, float8& y, float8& z, float8& w) noexcept { Deinterleave4(values, x.lo, y.lo, z.lo, w.lo); Deinterleave4(values + 16, x.hi, y.hi, z.hi, w.hi); }
+#endif
+
+	/// \brief Calls function for every element in [0, count), first in blocks of the widest register and
+	/// then one float at a time for the remainder. The function receives the register type as a template
+	/// parameter and the index of the first element it should process.
+	template<typename Function>
+	inline void ForEach(const int32_t count, Function&& function) noexcept
+	{
+		int32_t i = 0;
+		for (; i + Width <= count; i += Width)
+			function.template operator()<floatn>(i);
+		for (; i < count; ++i)
+			function.template operator()<float>(i);
+	}
+}
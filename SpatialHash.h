@@ -0,0 +1,64 @@
+#pragma once
+
+#include <Core/Math.h>
+#include <Core/Vector.h>
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+/// \brief A uniform grid in 2d that buckets points by the cell they are in so that neighbour queries
+/// only have to test the points in the cells that overlap the query instead of every point.
+///
+/// The points are stored in a single flat array sorted by their cell, rows of cells are contiguous
+/// so a query does one binary search per row of cells that it overlaps and then scans linearly.
+/// Queries return the index that each point had in the span that was used to build the grid.
+///
+/// Values outside of the range of cells are clamped to the outermost cells and a query with
+/// a nan bound returns nothing.
+class SpatialHash2f
+{
+public:
+	/// \brief Construct an empty grid where each cell is cellSize units wide and tall.
+	explicit SpatialHash2f(const float cellSize) noexcept;
+
+	/// \brief Returns the width and height of each cell.
+	float GetCellSize() const noexcept { return m_CellSize; }
+	/// \brief Returns the number of points in the grid.
+	int32 GetCount() const noexcept { return static_cast<int32>(m_Entries.size()); }
+	/// \brief Returns true if the grid doesn't contain any points.
+	bool IsEmpty() const noexcept { return m_Entries.empty(); }
+
+	/// \brief Replaces the contents of the grid with the points.
+	void Build(std::span<const Vector2f> points);
+	/// \brief Removes all points from the grid without releasing its memory.
+	void Clear() noexcept { m_Entries.clear(); }
+	/// \brief Moves the points to their new positions, points must be the same size as when the grid was built.
+	/// Points that stay in their cell are updated in place and only the points that changed cell are re-sorted.
+	void Update(std::span<const Vector2f> points);
+
+	/// \brief Appends the index of every point that is inside the box (inclusive) to results.
+	void QueryBox(const Vector2f& min, const Vector2f& max, std::vector<int32>& results) const;
+	/// \brief Appends the index of every point whose distance to center is less than or equal to radius to results.
+	void QueryRadius(const Vector2f& center, const float radius, std::vector<int32>& results) const;
+
+private:
+	struct Entry
+	{
+		uint64_t key;
+		Vector2f position;
+		int32 index;
+	};
+
+	static uint64_t ToKey(const int32 cellX, const int32 cellY) noexcept;
+	uint64_t ToKey(const Vector2f& position) const noexcept;
+	int32 ToCell(const float value) const noexcept;
+
+	template<typename Function>
+	void ForEachInBox(const Vector2f& min, const Vector2f& max, Function&& function) const;
+
+private:
+	std::vector<Entry> m_Entries;
+	float m_CellSize = 1.f;
+	float m_Reciprocal = 1.f;
+};
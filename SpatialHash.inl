@@ -0,0 +1,134 @@
+#pragma once
+
+#include <Core/Math.h>
+
+#include <algorithm>
+#include <limits>
+
+inline SpatialHash2f::SpatialHash2f(const float cellSize) noexcept
+	: m_CellSize(cellSize)
+	, m_Reciprocal(1.f / cellSize)
+{
+}
+
+inline void SpatialHash2f::Build(std::span<const Vector2f> points)
+{
+	m_Entries.resize(points.size());
+	for (int32 i = 0; i < static_cast<int32>(points.size()); ++i)
+		m_Entries[i] = Entry{ ToKey(points[i]), points[i], i };
+
+	std::sort(m_Entries.begin(), m_Entries.end(), [](const Entry& a, const Entry& b) { return a.key < b.key; });
+}
+
+inline void SpatialHash2f::Update(std::span<const Vector2f> points)
+{
+	int32 moved = 0;
+	for (Entry& entry : m_Entries)
+	{
+		const uint64_t key = ToKey(points[entry.index]);
+		moved += (key != entry.key) ? 1 : 0;
+		entry.key = key;
+		entry.position = points[entry.index];
+	}
+
+	if (moved == 0)
+		return;
+
+	// an insertion sort only has to shift the entries that changed cell which is cheaper than a
+	// full sort while few points move, once many of them move it is better to sort from scratch
+	const auto compare = [](const Entry& a, const Entry& b) { return a.key < b.key; };
+	if (moved * 16 < static_cast<int32>(m_Entries.size()))
+	{
+		for (auto it = m_Entries.begin() + 1; it < m_Entries.end(); ++it)
+		{
+			if (compare(*it, *(it - 1)))
+			{
+				const auto next = std::upper_bound(m_Entries.begin(), it, *it, compare);
+				std::rotate(next, it, it + 1);
+			}
+		}
+	}
+	else
+	{
+		std::sort(m_Entries.begin(), m_Entries.end(), compare);
+	}
+}
+
+inline void SpatialHash2f::QueryBox(const Vector2f& min, const Vector2f& max, std::vector<int32>& results) const
+{
+	ForEachInBox(min, max, [&](const Entry& entry)
+	{
+		const Vector2f& position = entry.position;
+		if (position.x >= min.x && position.x <= max.x && position.y >= min.y && position.y <= max.y)
+			results.push_back(entry.index);
+	});
+}
+
+inline void SpatialHash2f::QueryRadius(const Vector2f& center, const float radius, std::vector<int32>& results) const
+{
+	const float radiusSqr = radius * radius;
+	ForEachInBox(center - Vector2f(radius), center + Vector2f(radius), [&](const Entry& entry)
+	{
+		if (math::DistanceSqr(center, entry.position) <= radiusSqr)
+			results.push_back(entry.index);
+	});
+}
+
+inline uint64_t SpatialHash2f::ToKey(const int32 cellX, const int32 cellY) noexcept
+{
+	// flipping the sign bits makes the unsigned order match the signed order so that the cells of a row
+	// are sorted from left to right and each row is sorted after the ones below it
+	const uint64_t x = static_cast<uint32_t>(cellX) ^ 0x80000000u;
+	const uint64_t y = static_cast<uint32_t>(cellY) ^ 0x80000000u;
+	return (y << 32) | x;
+}
+
+inline uint64_t SpatialHash2f::ToKey(const Vector2f& position) const noexcept
+{
+	return ToKey(ToCell(position.x), ToCell(position.y));
+}
+
+inline int32 SpatialHash2f::ToCell(const float value) const noexcept
+{
+	// converting a float outside of the int32 range is undefined so those are clamped to the edge cells
+	// first, nan fails both comparisons and ends up in the lowest cell
+	const float scaled = value * m_Reciprocal;
+	if (!(scaled >= -2147483648.f))
+		return std::numeric_limits<int32>::min();
+	if (scaled >= 2147483648.f)
+		return std::numeric_limits<int32>::max();
+	return math::FloorToInt(scaled);
+}
+
+template<typename Function>
+inline void SpatialHash2f::ForEachInBox(const Vector2f& min, const Vector2f& max, Function&& function) const
+{
+	// a box with a nan bound can't contain anything, the comparisons also reject a box that is inside out
+	if (m_Entries.empty() || !(min.x <= max.x) || !(min.y <= max.y))
+		return;
+
+	const int32 minX = ToCell(min.x);
+	const int32 maxX = ToCell(max.x);
+	const int64_t maxY = ToCell(max.y);
+
+	// rows without any points are skipped by jumping to the row of the next entry, so a huge box only costs a
+	// binary search per occupied row and the int64 counter can't overflow when the last row is INT32_MAX
+	const auto compare = [](const Entry& entry, const uint64_t key) { return entry.key < key; };
+	for (int64_t y = ToCell(min.y); y <= maxY; ++y)
+	{
+		auto it = std::lower_bound(m_Entries.begin(), m_Entries.end(), ToKey(minX, static_cast<int32>(y)), compare);
+		if (it == m_Entries.end())
+			return;
+
+		const int64_t row = static_cast<int32>(static_cast<uint32_t>(it->key >> 32) ^ 0x80000000u);
+		if (row != y)
+		{
+			y = row - 1;
+			continue;
+		}
+
+		const uint64_t last = ToKey(maxX, static_cast<int32>(y));
+		for (; it != m_Entries.end() && it->key <= last; ++it)
+			function(*it);
+	}
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <Core/Math.h>
+#include <Core/Vector.h>
+#include <Core/VectorStream.h>
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+/// \brief Keys along space filling curves and a radix sort by them, so that arrays of positions can be
+/// reordered to put the positions that are close in space next to each other in memory.
+///
+/// The positions are quantized to a grid of 65536 by 65536 cells that covers the box from min to max, the
+/// positions outside of the box are clamped to its edges. A Morton key interleaves the bits of the cells and
+/// is cheaper, while a Hilbert key never jumps between cells that aren't adjacent so it keeps more of the
+/// neighbours close together. The batch versions quantize in the widest registers, the positions and keys
+/// must have the same size and the keys are identical to the single versions.
+///
+/// SortByKey returns the order instead of sorting the keys so that the same order can be used to Reorder
+/// every array that is parallel to the positions.
+namespace math
+{
+	/// \brief Returns the Morton key of the cell that contains the position.
+	inline uint32_t MortonKey(const Vector2f& position, const Vector2f& min, const Vector2f& max) noexcept;
+	/// \brief Writes the Morton key of the cell that contains each position into keys.
+	inline void MortonKey(std::span<const Vector2f> positions, const Vector2f& min, const Vector2f& max, std::span<uint32_t> keys) noexcept;
+	/// \brief Writes the Morton key of the cell that contains each position into keys.
+	inline void MortonKey(const Vector2fStream& positions, const Vector2f& min, const Vector2f& max, std::span<uint32_t> keys) noexcept;
+
+	/// \brief Returns the Hilbert key of the cell that contains the position.
+	inline uint32_t HilbertKey(const Vector2f& position, const Vector2f& min, const Vector2f& max) noexcept;
+	/// \brief Writes the Hilbert key of the cell that contains each position into keys.
+	inline void HilbertKey(std::span<const Vector2f> positions, const Vector2f& min, const Vector2f& max, std::span<uint32_t> keys) noexcept;
+	/// \brief Writes the Hilbert key of the cell that contains each position into keys.
+	inline void HilbertKey(const Vector2fStream& positions, const Vector2f& min, const Vector2f& max, std::span<uint32_t> keys) noexcept;
+
+	/// \brief Replaces order with the indices of the keys sorted from the smallest key to the biggest.
+	/// The sort is stable so the keys that are equal stay in the order that they were in.
+	inline void SortByKey(std::span<const uint32_t> keys, std::vector<int32>& order);
+
+	/// \brief Moves each value to its index in the order, so that values[i] becomes the old values[order[i]].
+	/// Both spans must have the same size.
+	template<typename Type>
+	inline void Reorder(std::span<Type> values, std::span<const int32> order);
+	/// \brief Moves each vector to its index in the order, so that stream[i] becomes the old stream[order[i]].
+	/// The order must be the same size as the stream.
+	inline void Reorder(Vector2fStream& stream, std::span<const int32> order);
+}
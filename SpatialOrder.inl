@@ -0,0 +1,220 @@
+#pragma once
+
+#include <Core/Math.h>
+#include <Core/Simd.h>
+
+#include <iterator>
+#include <utility>
+
+namespace math::detail
+{
+	// the number of positions that are quantized at a time on the stack
+	constexpr int32 s_KeyChunk = 256;
+	constexpr int32 s_KeyBits = 16;
+	constexpr float s_KeyCells = static_cast<float>(1 << s_KeyBits);
+
+	inline Vector2f GetKeyScale(const Vector2f& min, const Vector2f& max) noexcept
+	{
+		// a box with no width or height puts every position in the first column or row of cells
+		const Vector2f extent = max - min;
+		return Vector2f(
+			(extent.x > 0.f) ? s_KeyCells / extent.x : 0.f,
+			(extent.y > 0.f) ? s_KeyCells / extent.y : 0.f);
+	}
+
+	inline uint32_t GetKeyCell(const float value, const float min, const float scale) noexcept
+	{
+		return static_cast<uint32_t>(math::Floor<int32>(math::Clamp((value - min) * scale, 0.f, s_KeyCells - 1.f)));
+	}
+
+	template<typename Float>
+	inline Float GetKeyCells(const Float values, const float min, const float scale) noexcept
+	{
+		const Float cell = simd::Mul(simd::Sub(values, simd::Splat<Float>(min)), simd::Splat<Float>(scale));
+		return simd::Floor(simd::Min(simd::Max(cell, simd::Splat<Float>(0.f)), simd::Splat<Float>(s_KeyCells - 1.f)));
+	}
+
+	inline constexpr uint32_t SpreadBits(uint32_t value) noexcept
+	{
+		// moves each of the lower 16 bits to the even bit above it
+		value = (value | (value << 8)) & 0x00FF00FFu;
+		value = (value | (value << 4)) & 0x0F0F0F0Fu;
+		value = (value | (value << 2)) & 0x33333333u;
+		value = (value | (value << 1)) & 0x55555555u;
+		return value;
+	}
+
+	inline constexpr uint32_t ToMorton(const uint32_t x, const uint32_t y) noexcept
+	{
+		return SpreadBits(x) | (SpreadBits(y) << 1);
+	}
+
+	inline constexpr uint32_t ToHilbert(uint32_t x, uint32_t y) noexcept
+	{
+		// each level picks the quadrant from the top bits and then rotates the lower bits into the orientation
+		// of the curve inside of that quadrant
+		constexpr uint32_t mask = (1u << s_KeyBits) - 1;
+		uint32_t key = 0;
+		for (uint32_t level = 1u << (s_KeyBits - 1); level > 0; level >>= 1)
+		{
+			const uint32_t rx = (x & level) ? 1 : 0;
+			const uint32_t ry = (y & level) ? 1 : 0;
+			key += level * level * ((3 * rx) ^ ry);
+			if (ry == 0)
+			{
+				if (rx == 1)
+				{
+					x = mask ^ x;
+					y = mask ^ y;
+				}
+				std::swap(x, y);
+			}
+		}
+		return key;
+	}
+
+	template<typename Quantize, typename Encode>
+	inline void GenerateKeys(const int32 size, Quantize&& quantize, Encode&& encode, uint32_t* keys) noexcept
+	{
+		int32 cellX[s_KeyChunk];
+		int32 cellY[s_KeyChunk];
+		for (int32 begin = 0; begin < size; begin += s_KeyChunk)
+		{
+			const int32 count = math::Min(size - begin, s_KeyChunk);
+			quantize(begin, count, cellX, cellY);
+			for (int32 i = 0; i < count; ++i)
+				keys[begin + i] = encode(static_cast<uint32_t>(cellX[i]), static_cast<uint32_t>(cellY[i]));
+		}
+	}
+
+	template<typename Encode>
+	inline void GenerateKeys(std::span<const Vector2f> positions, const Vector2f& min, const Vector2f& max, Encode&& encode, uint32_t* keys) noexcept
+	{
+		const Vector2f scale = GetKeyScale(min, max);
+		const float* input = &positions.data()->x;
+		GenerateKeys(static_cast<int32>(positions.size()), [&](const int32 begin, const int32 count, int32* cellX, int32* cellY)
+		{
+			simd::ForEach(count, [&]<typename Float>(const int32 i)
+			{
+				Float x, y;
+				simd::Deinterleave(input + (begin + i) * 2, x, y);
+				simd::StoreInt(cellX + i, GetKeyCells(x, min.x, scale.x));
+				simd::StoreInt(cellY + i, GetKeyCells(y, min.y, scale.y));
+			});
+		}, encode, keys);
+	}
+
+	template<typename Encode>
+	inline void GenerateKeys(const Vector2fStream& positions, const Vector2f& min, const Vector2f& max, Encode&& encode, uint32_t* keys) noexcept
+	{
+		const Vector2f scale = GetKeyScale(min, max);
+		const float* inputX = positions.GetX();
+		const float* inputY = positions.GetY();
+		GenerateKeys(positions.GetCount(), [&](const int32 begin, const int32 count, int32* cellX, int32* cellY)
+		{
+			simd::ForEach(count, [&]<typename Float>(const int32 i)
+			{
+				simd::StoreInt(cellX + i, GetKeyCells(simd::Load<Float>(inputX + begin + i), min.x, scale.x));
+				simd::StoreInt(cellY + i, GetKeyCells(simd::Load<Float>(inputY + begin + i), min.y, scale.y));
+			});
+		}, encode, keys);
+	}
+}
+
+inline uint32_t math::MortonKey(const Vector2f& position, const Vector2f& min, const Vector2f& max) noexcept
+{
+	const Vector2f scale = detail::GetKeyScale(min, max);
+	return detail::ToMorton(detail::GetKeyCell(position.x, min.x, scale.x), detail::GetKeyCell(position.y, min.y, scale.y));
+}
+
+inline void math::MortonKey(std::span<const Vector2f> positions, const Vector2f& min, const Vector2f& max, std::span<uint32_t> keys) noexcept
+{
+	detail::GenerateKeys(positions, min, max, detail::ToMorton, keys.data());
+}
+
+inline void math::MortonKey(const Vector2fStream& positions, const Vector2f& min, const Vector2f& max, std::span<uint32_t> keys) noexcept
+{
+	detail::GenerateKeys(positions, min, max, detail::ToMorton, keys.data());
+}
+
+inline uint32_t math::HilbertKey(const Vector2f& position, const Vector2f& min, const Vector2f& max) noexcept
+{
+	const Vector2f scale = detail::GetKeyScale(min, max);
+	return detail::ToHilbert(detail::GetKeyCell(position.x, min.x, scale.x), detail::GetKeyCell(position.y, min.y, scale.y));
+}
+
+inline void math::HilbertKey(std::span<const Vector2f> positions, const Vector2f& min, const Vector2f& max, std::span<uint32_t> keys) noexcept
+{
+	detail::GenerateKeys(positions, min, max, detail::ToHilbert, keys.data());
+}
+
+inline void math::HilbertKey(const Vector2fStream& positions, const Vector2f& min, const Vector2f& max, std::span<uint32_t> keys) noexcept
+{
+	detail::GenerateKeys(positions, min, max, detail::ToHilbert, keys.data());
+}
+
+inline void math::SortByKey(std::span<const uint32_t> keys, std::vector<int32>& order)
+{
+	// a least significant digit radix sort of 8 bits per pass over the keys packed above their index, the
+	// counts of every pass are made in a single read and the passes where every key has the same digit are skipped
+	const int32 count = static_cast<int32>(keys.size());
+	std::vector<uint64_t> entries(count);
+	std::vector<uint64_t> scratch(count);
+
+	int32 counts[4][256] = {};
+	for (int32 i = 0; i < count; ++i)
+	{
+		const uint32_t key = keys[i];
+		entries[i] = (static_cast<uint64_t>(key) << 32) | static_cast<uint32_t>(i);
+		for (int32 pass = 0; pass < 4; ++pass)
+			counts[pass][(key >> (pass * 8)) & 0xFF]++;
+	}
+
+	for (int32 pass = 0; pass < 4; ++pass)
+	{
+		const int32 shift = 32 + pass * 8;
+		if (count == 0 || counts[pass][(entries[0] >> shift) & 0xFF] == count)
+			continue;
+
+		int32 offsets[256];
+		int32 offset = 0;
+		for (int32 digit = 0; digit < 256; ++digit)
+		{
+			offsets[digit] = offset;
+			offset += counts[pass][digit];
+		}
+
+		for (const uint64_t entry : entries)
+			scratch[offsets[(entry >> shift) & 0xFF]++] = entry;
+		entries.swap(scratch);
+	}
+
+	order.resize(count);
+	for (int32 i = 0; i < count; ++i)
+		order[i] = static_cast<int32>(entries[i] & 0xFFFFFFFFu);
+}
+
+template<typename Type>
+inline void math::Reorder(std::span<Type> values, std::span<const int32> order)
+{
+	std::vector<Type> copy(std::make_move_iterator(values.begin()), std::make_move_iterator(values.end()));
+	const int32 count = static_cast<int32>(order.size());
+	for (int32 i = 0; i < count; ++i)
+		values[i] = std::move(copy[order[i]]);
+}
+
+inline void math::Reorder(Vector2fStream& stream, std::span<const int32> order)
+{
+	const int32 count = stream.GetCount();
+	Vector2fStream result(count);
+	const float* inputX = stream.GetX();
+	const float* inputY = stream.GetY();
+	float* outputX = result.GetX();
+	float* outputY = result.GetY();
+	for (int32 i = 0; i < count; ++i)
+	{
+		outputX[i] = inputX[order[i]];
+		outputY[i] = inputY[order[i]];
+	}
+	stream = std::move(result);
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <Core/Vector.h>
+#include <Core/VectorStream.h>
+
+#include <span>
+
+/// \brief Polynomial approximations of sine and cosine that avoid the libm calls and vectorize.
+///
+/// The angle is reduced to [-PI/4, PI/4] around the nearest multiple of PI/2 and then evaluated
+/// with a minimax polynomial whose degree is chosen by the precision. The errors are the max
+/// absolute error in the range [-8192, 8192], beyond that the reduction loses accuracy gradually.
+namespace math
+{
+	/// \brief Selects the degree of the polynomials used by the fast trigonometry.
+	enum class Precision
+	{
+		/// \brief Degree 5 sine and degree 4 cosine, max error of 1.3e-5.
+		Low,
+		/// \brief Degree 7 sine and degree 6 cosine, max error of 1.2e-7.
+		Medium,
+		/// \brief Degree 9 sine and degree 8 cosine, max error of 9e-8.
+		Full,
+	};
+
+	/// \brief Returns the cosine in x and the sine in y of an angle in radians, which is the direction
+	/// of the angle (counter-clockwise) from the positive x axis.
+	template<Precision Level = Precision::Full>
+	inline Vector2f SinCos(const float radians) noexcept;
+
+	/// \brief Computes the sine and the cosine of every angle in a register of radians.
+	/// Float is any of the simd register types so that it can be used inside other kernels.
+	template<Precision Level = Precision::Full, typename Float>
+	inline void SinCos(const Float radians, Float& sin, Float& cos) noexcept;
+
+	/// \brief Computes the same as SinCos but rounds each step of the polynomials separately instead of using
+	/// fused multiply-adds, so that the results are bit for bit the same on every instruction set.
+	template<Precision Level = Precision::Full, typename Float>
+	inline void SinCosUnfused(const Float radians, Float& sin, Float& cos) noexcept;
+
+	/// \brief Writes the cosine in x and the sine in y of each angle in radians into results.
+	/// Both spans must have the same size.
+	template<Precision Level = Precision::Full>
+	inline void SinCos(std::span<const float> radians, std::span<Vector2f> results) noexcept;
+
+	/// \brief Writes the cosine in x and the sine in y of each angle in radians into results.
+	/// The stream is resized to the number of angles.
+	template<Precision Level = Precision::Full>
+	inline void SinCos(std::span<const float> radians, Vector2fStream& results);
+
+	/// \brief Writes the sine and the cosine of each angle in radians into separate spans.
+	/// All spans must have the same size.
+	template<Precision Level = Precision::Full>
+	inline void SinCos(std::span<const float> radians, std::span<float> sin, std::span<float> cos) noexcept;
+
+	/// \brief Returns an approximation of the cosine of an angle in radians.
+	template<Precision Level = Precision::Full>
+	inline float CosFast(const float radians) noexcept;
+
+	/// \brief Returns an approximation of the sine of an angle in radians.
+	template<Precision Level = Precision::Full>
+	inline float SinFast(const float radians) noexcept;
+}
@@ -0,0 +1,133 @@
+#pragma once
+
+#include <Core/Math.h>
+#include <Core/Simd.h>
+
+namespace math::detail
+{
+	template<math::Precision Level, bool Fused, typename Float>
+	inline void SinCos(const Float radians, Float& sin, Float& cos) noexcept
+	{
+		const auto mulAdd = [](const Float a, const Float b, const Float c)
+		{
+			if constexpr (Fused)
+				return simd::MulAdd(a, b, c);
+			else
+				return simd::MulAddUnfused(a, b, c);
+		};
+
+		// the nearest multiple of PI/2 is subtracted in three parts so that the product with the
+		// first two parts is exact, which keeps the reduced angle accurate for large angles
+		const Float quadrant = simd::Round(simd::Mul(radians, simd::Splat<Float>(0.63661977236758134f)));
+		Float r = mulAdd(quadrant, simd::Splat<Float>(-1.5703125f), radians);
+		r = mulAdd(quadrant, simd::Splat<Float>(-4.837512969970703125e-4f), r);
+		r = mulAdd(quadrant, simd::Splat<Float>(-7.54978995489188216e-8f), r);
+		const Float r2 = simd::Mul(r, r);
+
+		// sin(r) = r + r^3 * s(r^2), cos(r) = 1 + r^2 * c(r^2)
+		Float s, c;
+		if constexpr (Level == Precision::Low)
+		{
+			s = mulAdd(r2, simd::Splat<Float>(8.1632818895e-3f), simd::Splat<Float>(-1.6663390376e-1f));
+			c = mulAdd(r2, simd::Splat<Float>(4.0488935621e-2f), simd::Splat<Float>(-4.9977630696e-1f));
+		}
+		else if constexpr (Level == Precision::Medium)
+		{
+			s = mulAdd(r2, simd::Splat<Float>(-1.9515283148e-4f), simd::Splat<Float>(8.3321607615e-3f));
+			s = mulAdd(r2, s, simd::Splat<Float>(-1.6666654610e-1f));
+			c = mulAdd(r2, simd::Splat<Float>(-1.3597823071e-3f), simd::Splat<Float>(4.1656294575e-2f));
+			c = mulAdd(r2, c, simd::Splat<Float>(-4.9999894781e-1f));
+		}
+		else
+		{
+			s = mulAdd(r2, simd::Splat<Float>(2.7181216246e-6f), simd::Splat<Float>(-1.9839312269e-4f));
+			s = mulAdd(r2, s, simd::Splat<Float>(8.3333293048e-3f));
+			s = mulAdd(r2, s, simd::Splat<Float>(-1.6666666641e-1f));
+			c = mulAdd(r2, simd::Splat<Float>(2.4390450674e-5f), simd::Splat<Float>(-1.3886763794e-3f));
+			c = mulAdd(r2, c, simd::Splat<Float>(4.1666623324e-2f));
+			c = mulAdd(r2, c, simd::Splat<Float>(-4.9999999725e-1f));
+		}
+		s = mulAdd(simd::Mul(r2, r), s, r);
+		c = mulAdd(r2, c, simd::Splat<Float>(1.f));
+
+		// odd quadrants swap sine and cosine, the sine is negative in quadrants 2 and 3 and
+		// the cosine is negative in quadrants 1 and 2
+		const Float half = simd::Floor(simd::Mul(quadrant, simd::Splat<Float>(0.5f)));
+		const Float odd = simd::CmpGt(simd::Sub(quadrant, simd::Add(half, half)), simd::Splat<Float>(0.5f));
+		const Float negative = simd::CmpGt(simd::Sub(half, simd::Mul(simd::Floor(simd::Mul(half, simd::Splat<Float>(0.5f))), simd::Splat<Float>(2.f))), simd::Splat<Float>(0.5f));
+		const Float signBit = simd::Splat<Float>(-0.f);
+		sin = simd::Xor(simd::Select(odd, c, s), simd::And(negative, signBit));
+		cos = simd::Xor(simd::Select(odd, s, c), simd::And(simd::Xor(negative, odd), signBit));
+	}
+}
+
+template<math::Precision Level, typename Float>
+inline void math::SinCos(const Float radians, Float& sin, Float& cos) noexcept
+{
+	detail::SinCos<Level, true>(radians, sin, cos);
+}
+
+template<math::Precision Level, typename Float>
+inline void math::SinCosUnfused(const Float radians, Float& sin, Float& cos) noexcept
+{
+	detail::SinCos<Level, false>(radians, sin, cos);
+}
+
+template<math::Precision Level>
+inline Vector2f math::SinCos(const float radians) noexcept
+{
+	float sin, cos;
+	math::SinCos<Level>(radians, sin, cos);
+	return Vector2f(cos, sin);
+}
+
+template<math::Precision Level>
+inline void math::SinCos(std::span<const float> radians, std::span<Vector2f> results) noexcept
+{
+	const float* input = radians.data();
+	Vector2f* output = results.data();
+	simd::ForEach(static_cast<int32>(radians.size()), [&]<typename Float>(const int32 i)
+	{
+		Float sin, cos;
+		math::SinCos<Level>(simd::Load<Float>(input + i), sin, cos);
+		simd::Interleave(&output[i].x, cos, sin);
+	});
+}
+
+template<math::Precision Level>
+inline void math::SinCos(std::span<const float> radians, Vector2fStream& results)
+{
+	results.Resize(static_cast<int32>(radians.size()));
+	math::SinCos<Level>(radians, std::span<float>(results.GetY(), radians.size()), std::span<float>(results.GetX(), radians.size()));
+}
+
+template<math::Precision Level>
+inline void math::SinCos(std::span<const float> radians, std::span<float> sin, std::span<float> cos) noexcept
+{
+	const float* input = radians.data();
+	float* outputSin = sin.data();
+	float* outputCos = cos.data();
+	simd::ForEach(static_cast<int32>(radians.size()), [&]<typename Float>(const int32 i)
+	{
+		Float s, c;
+		math::SinCos<Level>(simd::Load<Float>(input + i), s, c);
+		simd::Store(outputSin + i, s);
+		simd::Store(outputCos + i, c);
+	});
+}
+
+template<math::Precision Level>
+inline float math::CosFast(const float radians) noexcept
+{
+	float sin, cos;
+	math::SinCos<Level>(radians, sin, cos);
+	return cos;
+}
+
+template<math::Precision Level>
+inline float math::SinFast(const float radians) noexcept
+{
+	float sin, cos;
+	math::SinCos<Level>(radians, sin, cos);
+	return sin;
+}
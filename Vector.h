@@ -44,29 +44,43 @@ public:
 	constexpr Vector2f operator-() const noexcept { return Vector2f(-x, -y); }
 
 	/// \brief Returns the length of this vector.
-	float Length() const noexcept;
+	constexpr float Length() const noexcept;
 	/// \brief Returns the squared length of this vector.
 	constexpr float LengthSqr() const noexcept;
 
 	/// \brief Reduce the vector length so that it doesn't exceed value.
 	/// If the length of the vector is 0 and value is less than 0 then it makes it a NaN vector.
-	void Limit(const float value) noexcept;
+	constexpr void Limit(const float value) noexcept;
 	/// \brief Normalize this vector have a length of 1 unit.
 	/// If the length of the vector is 0 then it makes it a zero vector.
-	void Normalize() noexcept;
+	constexpr void Normalize() noexcept;
 	/// \brief Normalize this vector have a length of 1 unit.
 	/// If the length of the vector is 0 then it makes it a NaN vector.
-	void NormalizeUnsafe() noexcept;
+	constexpr void NormalizeUnsafe() noexcept;
+
+	/// \brief Reduce the vector length so that it doesn't exceed value using math::RSqrtFast.
+	/// The resulting length has a max relative error of 4e-7.
+	constexpr void LimitFast(const float value) noexcept;
+	/// \brief Normalize this vector have a length of 1 unit using math::RSqrtFast.
+	/// The resulting length has a max relative error of 4e-7, if the length of the vector is 0 then it makes it a zero vector.
+	constexpr void NormalizeFast() noexcept;
 
 	/// \brief Returns a vector whose length doesn't exceed value.
 	/// If the length of the vector is 0 and value is less than it returns a NaN vector.
-	[[nodiscard]] Vector2f Limited(const float value) const noexcept;
+	[[nodiscard]] constexpr Vector2f Limited(const float value) const noexcept;
 	/// \brief Returns a normalized vector with a length of 1 unit.
 	/// If the length of the vector is 0 then it returns a zero vector.
-	[[nodiscard]] Vector2f Normalized() const noexcept;
+	[[nodiscard]] constexpr Vector2f Normalized() const noexcept;
 	/// \brief Returns a normalized vector with a length of 1 unit.
 	/// If the length of the vector is 0 then it returns a NaN vector.
-	[[nodiscard]] Vector2f NormalizedUnsafe() const noexcept;
+	[[nodiscard]] constexpr Vector2f NormalizedUnsafe() const noexcept;
+
+	/// \brief Returns a vector whose length doesn't exceed value using math::RSqrtFast.
+	/// The resulting length has a max relative error of 4e-7.
+	[[nodiscard]] constexpr Vector2f LimitedFast(const float value) const noexcept;
+	/// \brief Returns a normalized vector with a length of 1 unit using math::RSqrtFast.
+	/// The resulting length has a max relative error of 4e-7, if the length of the vector is 0 then it returns a zero vector.
+	[[nodiscard]] constexpr Vector2f NormalizedFast() const noexcept;
 
 	/// \brief Converts this vector to a Vector3f with 0 in place of Y, and Y in place of Z.
 	constexpr Vector3f X0Y() const noexcept;
@@ -96,7 +110,7 @@ namespace math
 	inline constexpr Vector2f Clamp(const Vector2f& value, const Vector2f& min, const Vector2f& max) noexcept;
 
 	/// \brief Returns the distance between two vectors.
-	inline float Distance(const Vector2f& a, const Vector2f& b) noexcept;
+	inline constexpr float Distance(const Vector2f& a, const Vector2f& b) noexcept;
 
 	/// \brief Returns the squared distance between two vectors.
 	inline constexpr float DistanceSqr(const Vector2f& a, const Vector2f& b) noexcept;
@@ -115,4 +129,146 @@ namespace math
 
 	/// \brief Reflects a vector off the vector defined by a normal.
 	inline constexpr Vector2f Reflect(const Vector2f& vector, const Vector2f& normal) noexcept;
-}
\ No newline at end of file
+}
+
+/// \brief A geometric object that has length and direction that can be used to represent positions and/or directions in 3d.
+class Vector3f
+{
+public:
+	/// \brief Construct a new vector with uninitialized members.
+	constexpr Vector3f() noexcept : x(), y(), z() {}
+	/// \brief Construct a new vector with all members initialized to value.
+	constexpr explicit Vector3f(const float value) noexcept : x(value), y(value), z(value) {}
+	/// \brief Construct a new vector with members initialized to values x, y and z.
+	constexpr explicit Vector3f(const float x, const float y, const float z) noexcept : x(x), y(y), z(z) {}
+	/// \brief Construct a new vector with members initialized to the members of xy and the value z.
+	constexpr explicit Vector3f(const Vector2f& xy, const float z) noexcept : x(xy.x), y(xy.y), z(z) {}
+
+	/// \brief Returns true if all members are identical.
+	constexpr bool operator==(const Vector3f& rhs) const noexcept { return (x == rhs.x) && (y == rhs.y) && (z == rhs.z); }
+	/// \brief Returns true if any members aren't identical.
+	constexpr bool operator!=(const Vector3f& rhs) const noexcept { return (x != rhs.x) || (y != rhs.y) || (z != rhs.z); }
+
+	/// \brief Adds the two vectors component-wise and returns the result in a new vector.
+	constexpr Vector3f operator+(const Vector3f& rhs) const noexcept { return Vector3f(x + rhs.x, y + rhs.y, z + rhs.z); }
+	/// \brief Subtracts the two vectors component-wise and returns the result in a new vector.
+	constexpr Vector3f operator-(const Vector3f& rhs) const noexcept { return Vector3f(x - rhs.x, y - rhs.y, z - rhs.z); }
+
+	/// \brief Adds the two vectors component-wise, stores the result in this vector and returns a reference.
+	constexpr Vector3f& operator+=(const Vector3f& rhs) noexcept { x += rhs.x; y += rhs.y; z += rhs.z; return *this; }
+	/// \brief Subtracts the two vectors component-wise, stores the result in this vector and returns a reference.
+	constexpr Vector3f& operator-=(const Vector3f& rhs) noexcept { x -= rhs.x; y -= rhs.y; z -= rhs.z; return *this; }
+
+	/// \brief Multiplies the vector by a value and returns the result in a new vector.
+	constexpr Vector3f operator*(const float rhs) const noexcept { return Vector3f(x * rhs, y * rhs, z * rhs); }
+	/// \brief Divides the vector by a value and returns the result in a new vector.
+	constexpr Vector3f operator/(const float rhs) const noexcept { return Vector3f(x / rhs, y / rhs, z / rhs); }
+
+	/// \brief Multiplies the vector by a value, stores the result in this vector and returns a reference.
+	constexpr Vector3f& operator*=(const float rhs) noexcept { x *= rhs; y *= rhs; z *= rhs; return *this; }
+	/// \brief Divides the vector by a value, stores the result in this vector and returns a reference.
+	constexpr Vector3f& operator/=(const float rhs) noexcept { x /= rhs; y /= rhs; z /= rhs; return *this; }
+
+	/// \brief Returns a new vector with non-negated members.
+	constexpr Vector3f operator+() const noexcept { return *this; }
+	/// \brief Returns a new vector with negated members.
+	constexpr Vector3f operator-() const noexcept { return Vector3f(-x, -y, -z); }
+
+	/// \brief Returns the length of this vector.
+	constexpr float Length() const noexcept;
+	/// \brief Returns the squared length of this vector.
+	constexpr float LengthSqr() const noexcept;
+
+	/// \brief Reduce the vector length so that it doesn't exceed value.
+	/// If the length of the vector is 0 and value is less than 0 then it makes it a NaN vector.
+	constexpr void Limit(const float value) noexcept;
+	/// \brief Normalize this vector have a length of 1 unit.
+	/// If the length of the vector is 0 then it makes it a zero vector.
+	constexpr void Normalize() noexcept;
+	/// \brief Normalize this vector have a length of 1 unit.
+	/// If the length of the vector is 0 then it makes it a NaN vector.
+	constexpr void NormalizeUnsafe() noexcept;
+
+	/// \brief Reduce the vector length so that it doesn't exceed value using math::RSqrtFast.
+	/// The resulting length has a max relative error of 4e-7.
+	constexpr void LimitFast(const float value) noexcept;
+	/// \brief Normalize this vector have a length of 1 unit using math::RSqrtFast.
+	/// The resulting length has a max relative error of 4e-7, if the length of the vector is 0 then it makes it a zero vector.
+	constexpr void NormalizeFast() noexcept;
+
+	/// \brief Returns a vector whose length doesn't exceed value.
+	/// If the length of the vector is 0 and value is less than it returns a NaN vector.
+	[[nodiscard]] constexpr Vector3f Limited(const float value) const noexcept;
+	/// \brief Returns a normalized vector with a length of 1 unit.
+	/// If the length of the vector is 0 then it returns a zero vector.
+	[[nodiscard]] constexpr Vector3f Normalized() const noexcept;
+	/// \brief Returns a normalized vector with a length of 1 unit.
+	/// If the length of the vector is 0 then it returns a NaN vector.
+	[[nodiscard]] constexpr Vector3f NormalizedUnsafe() const noexcept;
+
+	/// \brief Returns a vector whose length doesn't exceed value using math::RSqrtFast.
+	/// The resulting length has a max relative error of 4e-7.
+	[[nodiscard]] constexpr Vector3f LimitedFast(const float value) const noexcept;
+	/// \brief Returns a normalized vector with a length of 1 unit using math::RSqrtFast.
+	/// The resulting length has a max relative error of 4e-7, if the length of the vector is 0 then it returns a zero vector.
+	[[nodiscard]] constexpr Vector3f NormalizedFast() const noexcept;
+
+	/// \brief Converts this vector to a Vector2f by discarding Z.
+	constexpr Vector2f XY() const noexcept;
+	/// \brief Converts this vector to a Vector2f by discarding Y, and Z in place of Y.
+	constexpr Vector2f XZ() const noexcept;
+
+	/// \brief Shorthand for writing Vector3f(1.f, 0.f, 0.f).
+	static const Vector3f AxisX;
+	/// \brief Shorthand for writing Vector3f(0.f, 1.f, 0.f).
+	static const Vector3f AxisY;
+	/// \brief Shorthand for writing Vector3f(0.f, 0.f, 1.f).
+	static const Vector3f AxisZ;
+	/// \brief Shorthand for writing Vector3f(1.f).
+	static const Vector3f One;
+	/// \brief Shorthand for writing Vector3f(0.f).
+	static const Vector3f Zero;
+
+public:
+	float x, y, z;
+};
+
+inline constexpr Vector3f Vector3f::AxisX(1.f, 0.f, 0.f);
+inline constexpr Vector3f Vector3f::AxisY(0.f, 1.f, 0.f);
+inline constexpr Vector3f Vector3f::AxisZ(0.f, 0.f, 1.f);
+inline constexpr Vector3f Vector3f::One(1.f);
+inline constexpr Vector3f Vector3f::Zero(0.f);
+
+namespace math
+{
+	inline constexpr Vector3f Clamp(const Vector3f& value, const Vector3f& min, const Vector3f& max) noexcept;
+
+	/// \brief Returns the cross product of two vectors using the right-hand rule.
+	inline constexpr Vector3f Cross(const Vector3f& a, const Vector3f& b) noexcept;
+
+	/// \brief Returns the distance between two vectors.
+	inline constexpr float Distance(const Vector3f& a, const Vector3f& b) noexcept;
+
+	/// \brief Returns the squared distance between two vectors.
+	inline constexpr float DistanceSqr(const Vector3f& a, const Vector3f& b) noexcept;
+
+	/// \brief Divides the two vectors component-wise and returns the result in a new vector.
+	inline constexpr Vector3f Divide(const Vector3f& a, const Vector3f& b) noexcept;
+
+	/// \brief Returns the dot product of two vectors.
+	inline constexpr float Dot(const Vector3f& a, const Vector3f& b) noexcept;
+
+	/// \brief Multiplies the two vectors component-wise and returns the result in a new vector.
+	inline constexpr Vector3f Multiply(const Vector3f& a, const Vector3f& b) noexcept;
+
+	/// \brief Reflects a vector off the plane defined by a normal.
+	inline constexpr Vector3f Reflect(const Vector3f& vector, const Vector3f& normal) noexcept;
+}
+
+#if defined(MATH_EXTERN_TEMPLATES)
+namespace math
+{
+	extern template Vector2f Lerp<Vector2f>(const Vector2f&, const Vector2f&, const float) noexcept;
+	extern template Vector3f Lerp<Vector3f>(const Vector3f&, const Vector3f&, const float) noexcept;
+}
+#endif
@@ -1,6 +1,8 @@
+#pragma once
+
 #include <Core/Math.h>
 
-inline float Vector2f::Length() const noexcept
+inline constexpr float Vector2f::Length() const noexcept
 {
 	return math::Sqrt(x * x + y * y);
 }
@@ -10,7 +12,7 @@ inline constexpr float Vector2f::LengthSqr() const noexcept
 	return x * x + y * y;
 }
 
-inline void Vector2f::Limit(const float value) noexcept
+inline constexpr void Vector2f::Limit(const float value) noexcept
 {
 	// assumes that value >= 0.f
 	const float length = Length();
@@ -18,7 +20,7 @@ inline void Vector2f::Limit(const float value) noexcept
 		*this *= (value / length);
 }
 
-inline void Vector2f::Normalize() noexcept
+inline constexpr void Vector2f::Normalize() noexcept
 {
 	constexpr float epsilon = 0.0000001f;
 	const float length = Length();
@@ -32,32 +34,68 @@ inline void Vector2f::Normalize() noexcept
 	}
 }
 
-inline void Vector2f::NormalizeUnsafe() noexcept
+inline constexpr void Vector2f::NormalizeUnsafe() noexcept
 {
 	*this *= 1.f / Length();
 }
 
-inline Vector2f Vector2f::Limited(const float value) const noexcept
+inline constexpr void Vector2f::LimitFast(const float value) noexcept
+{
+	// assumes that value >= 0.f
+	const float lengthSqr = LengthSqr();
+	if (lengthSqr > value * value)
+		*this *= value * math::RSqrtFast(lengthSqr);
+}
+
+inline constexpr void Vector2f::NormalizeFast() noexcept
+{
+	constexpr float epsilon = 0.0000001f;
+	const float lengthSqr = LengthSqr();
+	if (lengthSqr > epsilon * epsilon)
+	{
+		*this *= math::RSqrtFast(lengthSqr);
+	}
+	else
+	{
+		x = y = 0.f;
+	}
+}
+
+inline constexpr Vector2f Vector2f::Limited(const float value) const noexcept
 {
 	Vector2f result(*this);
 	result.Limit(value);
 	return result;
 }
 
-inline Vector2f Vector2f::Normalized() const noexcept
+inline constexpr Vector2f Vector2f::Normalized() const noexcept
 {
 	Vector2f result(*this);
 	result.Normalize();
 	return result;
 }
 
-inline Vector2f Vector2f::NormalizedUnsafe() const noexcept
+inline constexpr Vector2f Vector2f::NormalizedUnsafe() const noexcept
 {
 	Vector2f result(*this);
 	result.NormalizeUnsafe();
 	return result;
 }
 
+inline constexpr Vector2f Vector2f::LimitedFast(const float value) const noexcept
+{
+	Vector2f result(*this);
+	result.LimitFast(value);
+	return result;
+}
+
+inline constexpr Vector2f Vector2f::NormalizedFast() const noexcept
+{
+	Vector2f result(*this);
+	result.NormalizeFast();
+	return result;
+}
+
 inline constexpr Vector3f Vector2f::X0Y() const noexcept
 {
 	return Vector3f(x, 0.f, y);
@@ -75,7 +113,7 @@ inline constexpr Vector2f math::Clamp(const Vector2f& value, const Vector2f& min
 		(value.y < min.y) ? min.y : (value.y > max.y) ? max.y : value.y);
 }
 
-inline float math::Distance(const Vector2f& a, const Vector2f& b) noexcept
+inline constexpr float math::Distance(const Vector2f& a, const Vector2f& b) noexcept
 {
 	return (b - a).Length();
 }
@@ -126,4 +164,174 @@ inline constexpr Vector2f math::Reflect(const Vector2f& vector, const Vector2f&
 	// -2 * (V dot N) * N + V
 	const float dot2 = -2.0f * math::Dot(vector, normal);
 	return math::Multiply(Vector2f(dot2), normal) + vector;
+}
+
+inline constexpr float Vector3f::Length() const noexcept
+{
+	return math::Sqrt(x * x + y * y + z * z);
+}
+
+inline constexpr float Vector3f::LengthSqr() const noexcept
+{
+	return x * x + y * y + z * z;
+}
+
+inline constexpr void Vector3f::Limit(const float value) noexcept
+{
+	// assumes that value >= 0.f
+	const float length = Length();
+	if (length > value)
+		*this *= (value / length);
+}
+
+inline constexpr void Vector3f::Normalize() noexcept
+{
+	constexpr float epsilon = 0.0000001f;
+	const float length = Length();
+	if (length > epsilon)
+	{
+		*this *= 1.f / length;
+	}
+	else
+	{
+		x = y = z = 0.f;
+	}
+}
+
+inline constexpr void Vector3f::NormalizeUnsafe() noexcept
+{
+	*this *= 1.f / Length();
+}
+
+inline constexpr void Vector3f::LimitFast(const float value) noexcept
+{
+	// assumes that value >= 0.f
+	const float lengthSqr = LengthSqr();
+	if (lengthSqr > value * value)
+		*this *= value * math::RSqrtFast(lengthSqr);
+}
+
+inline constexpr void Vector3f::NormalizeFast() noexcept
+{
+	constexpr float epsilon = 0.0000001f;
+	const float lengthSqr = LengthSqr();
+	if (lengthSqr > epsilon * epsilon)
+	{
+		*this *= math::RSqrtFast(lengthSqr);
+	}
+	else
+	{
+		x = y = z = 0.f;
+	}
+}
+
+inline constexpr Vector3f Vector3f::Limited(const float value) const noexcept
+{
+	Vector3f result(*this);
+	result.Limit(value);
+	return result;
+}
+
+inline constexpr Vector3f Vector3f::Normalized() const noexcept
+{
+	Vector3f result(*this);
+	result.Normalize();
+	return result;
+}
+
+inline constexpr Vector3f Vector3f::NormalizedUnsafe() const noexcept
+{
+	Vector3f result(*this);
+	result.NormalizeUnsafe();
+	return result;
+}
+
+inline constexpr Vector3f Vector3f::LimitedFast(const float value) const noexcept
+{
+	Vector3f result(*this);
+	result.LimitFast(value);
+	return result;
+}
+
+inline constexpr Vector3f Vector3f::NormalizedFast() const noexcept
+{
+	Vector3f result(*this);
+	result.NormalizeFast();
+	return result;
+}
+
+inline constexpr Vector2f Vector3f::XY() const noexcept
+{
+	return Vector2f(x, y);
+}
+
+inline constexpr Vector2f Vector3f::XZ() const noexcept
+{
+	return Vector2f(x, z);
+}
+
+inline constexpr Vector3f math::Clamp(const Vector3f& value, const Vector3f& min, const Vector3f& max) noexcept
+{
+	return Vector3f(
+		(value.x < min.x) ? min.x : (value.x > max.x) ? max.x : value.x,
+		(value.y < min.y) ? min.y : (value.y > max.y) ? max.y : value.y,
+		(value.z < min.z) ? min.z : (value.z > max.z) ? max.z : value.z);
+}
+
+inline constexpr Vector3f math::Cross(const Vector3f& a, const Vector3f& b) noexcept
+{
+	return Vector3f(
+		a.y * b.z - a.z * b.y,
+		a.z * b.x - a.x * b.z,
+		a.x * b.y - a.y * b.x);
+}
+
+inline constexpr float math::Distance(const Vector3f& a, const Vector3f& b) noexcept
+{
+	return (b - a).Length();
+}
+
+inline constexpr float math::DistanceSqr(const Vector3f& a, const Vector3f& b) noexcept
+{
+	return (b - a).LengthSqr();
+}
+
+inline constexpr Vector3f math::Divide(const Vector3f& a, const Vector3f& b) noexcept
+{
+	return Vector3f(a.x / b.x, a.y / b.y, a.z / b.z);
+}
+
+inline constexpr float math::Dot(const Vector3f& a, const Vector3f& b) noexcept
+{
+	return a.x * b.x + a.y * b.y + a.z * b.z;
+}
+
+template<>
+inline constexpr Vector3f math::Max<Vector3f>(const Vector3f& a, const Vector3f& b) noexcept
+{
+	return Vector3f(
+		(a.x > b.x) ? a.x : b.x,
+		(a.y > b.y) ? a.y : b.y,
+		(a.z > b.z) ? a.z : b.z);
+}
+
+template<>
+inline constexpr Vector3f math::Min<Vector3f>(const Vector3f& a, const Vector3f& b) noexcept
+{
+	return Vector3f(
+		(a.x < b.x) ? a.x : b.x,
+		(a.y < b.y) ? a.y : b.y,
+		(a.z < b.z) ? a.z : b.z);
+}
+
+inline constexpr Vector3f math::Multiply(const Vector3f& a, const Vector3f& b) noexcept
+{
+	return Vector3f(a.x * b.x, a.y * b.y, a.z * b.z);
+}
+
+inline constexpr Vector3f math::Reflect(const Vector3f& vector, const Vector3f& normal) noexcept
+{
+	// -2 * (V dot N) * N + V
+	const float dot2 = -2.0f * math::Dot(vector, normal);
+	return math::Multiply(Vector3f(dot2), normal) + vector;
 }
\ No newline at end of file
@@ -0,0 +1,131 @@
+#pragma once
+
+#include <Core/Math.h>
+#include <Core/Simd.h>
+#include <Core/Vector.h>
+
+/// \brief A Vector3f that is padded to 16 bytes and held in a single register so that each operation
+/// compiles to a single SIMD instruction and loads/stores never straddle an unaligned boundary.
+/// The 4th lane is padding, its value is unspecified and is ignored by every operation.
+class alignas(16) Vector3fA
+{
+public:
+	/// \brief Construct a new vector with all members initialized to zero.
+	Vector3fA() noexcept : value(simd::Splat<simd::float4>(0.f)) {}
+	/// \brief Construct a new vector with all members initialized to value.
+	explicit Vector3fA(const float value) noexcept : value(simd::Splat<simd::float4>(value)) {}
+	/// \brief Construct a new vector with members initialized to values x, y and z.
+	explicit Vector3fA(const float x, const float y, const float z) noexcept : value(simd::Set(x, y, z, 0.f)) {}
+	/// \brief Construct a new vector with members initialized to the members of vector.
+	explicit Vector3fA(const Vector3f& vector) noexcept : value(simd::Set(vector.x, vector.y, vector.z, 0.f)) {}
+	/// \brief Construct a new vector from a register.
+	explicit Vector3fA(const simd::float4 value) noexcept : value(value) {}
+
+	/// \brief Returns true if all members are identical.
+	bool operator==(const Vector3fA& rhs) const noexcept { return XYZ() == rhs.XYZ(); }
+	/// \brief Returns true if any members aren't identical.
+	bool operator!=(const Vector3fA& rhs) const noexcept { return XYZ() != rhs.XYZ(); }
+
+	/// \brief Adds the two vectors component-wise and returns the result in a new vector.
+	Vector3fA operator+(const Vector3fA& rhs) const noexcept { return Vector3fA(simd::Add(value, rhs.value)); }
+	/// \brief Subtracts the two vectors component-wise and returns the result in a new vector.
+	Vector3fA operator-(const Vector3fA& rhs) const noexcept { return Vector3fA(simd::Sub(value, rhs.value)); }
+
+	/// \brief Adds the two vectors component-wise, stores the result in this vector and returns a reference.
+	Vector3fA& operator+=(const Vector3fA& rhs) noexcept { value = simd::Add(value, rhs.value); return *this; }
+	/// \brief Subtracts the two vectors component-wise, stores the result in this vector and returns a reference.
+	Vector3fA& operator-=(const Vector3fA& rhs) noexcept { value = simd::Sub(value, rhs.value); return *this; }
+
+	/// \brief Multiplies the vector by a value and returns the result in a new vector.
+	Vector3fA operator*(const float rhs) const noexcept { return Vector3fA(simd::Mul(value, simd::Splat<simd::float4>(rhs))); }
+	/// \brief Divides the vector by a value and returns the result in a new vector.
+	Vector3fA operator/(const float rhs) const noexcept { return Vector3fA(simd::Div(value, simd::Splat<simd::float4>(rhs))); }
+
+	/// \brief Multiplies the vector by a value, stores the result in this vector and returns a reference.
+	Vector3fA& operator*=(const float rhs) noexcept { value = simd::Mul(value, simd::Splat<simd::float4>(rhs)); return *this; }
+	/// \brief Divides the vector by a value, stores the result in this vector and returns a reference.
+	Vector3fA& operator/=(const float rhs) noexcept { value = simd::Div(value, simd::Splat<simd::float4>(rhs)); return *this; }
+
+	/// \brief Returns a new vector with non-negated members.
+	Vector3fA operator+() const noexcept { return *this; }
+	/// \brief Returns a new vector with negated members.
+	Vector3fA operator-() const noexcept { return Vector3fA(simd::Neg(value)); }
+
+	/// \brief Returns the x member.
+	float GetX() const noexcept { return simd::GetLane<0>(value); }
+	/// \brief Returns the y member.
+	float GetY() const noexcept { return simd::GetLane<1>(value); }
+	/// \brief Returns the z member.
+	float GetZ() const noexcept { return simd::GetLane<2>(value); }
+
+	/// \brief Returns the length of this vector.
+	float Length() const noexcept;
+	/// \brief Returns the squared length of this vector.
+	float LengthSqr() const noexcept;
+
+	/// \brief Reduce the vector length so that it doesn't exceed value.
+	/// If the length of the vector is 0 and value is less than 0 then it makes it a NaN vector.
+	void Limit(const float value) noexcept;
+	/// \brief Normalize this vector have a length of 1 unit.
+	/// If the length of the vector is 0 then it makes it a zero vector.
+	void Normalize() noexcept;
+	/// \brief Normalize this vector have a length of 1 unit.
+	/// If the length of the vector is 0 then it makes it a NaN vector.
+	void NormalizeUnsafe() noexcept;
+
+	/// \brief Reduce the vector length so that it doesn't exceed value using simd::RSqrtFast.
+	/// The resulting length has a max relative error of 4e-7.
+	void LimitFast(const float value) noexcept;
+	/// \brief Normalize this vector have a length of 1 unit using simd::RSqrtFast.
+	/// The resulting length has a max relative error of 4e-7, if the length of the vector is 0 then it makes it a zero vector.
+	void NormalizeFast() noexcept;
+
+	/// \brief Returns a vector whose length doesn't exceed value.
+	/// If the length of the vector is 0 and value is less than it returns a NaN vector.
+	[[nodiscard]] Vector3fA Limited(const float value) const noexcept;
+	/// \brief Returns a normalized vector with a length of 1 unit.
+	/// If the length of the vector is 0 then it returns a zero vector.
+	[[nodiscard]] Vector3fA Normalized() const noexcept;
+	/// \brief Returns a normalized vector with a length of 1 unit.
+	/// If the length of the vector is 0 then it returns a NaN vector.
+	[[nodiscard]] Vector3fA NormalizedUnsafe() const noexcept;
+
+	/// \brief Returns a vector whose length doesn't exceed value using simd::RSqrtFast.
+	/// The resulting length has a max relative error of 4e-7.
+	[[nodiscard]] Vector3fA LimitedFast(const float value) const noexcept;
+	/// \brief Returns a normalized vector with a length of 1 unit using simd::RSqrtFast.
+	/// The resulting length has a max relative error of 4e-7, if the length of the vector is 0 then it returns a zero vector.
+	[[nodiscard]] Vector3fA NormalizedFast() const noexcept;
+
+	/// \brief Converts this vector to an unpadded Vector3f.
+	Vector3f XYZ() const noexcept;
+
+public:
+	simd::float4 value;
+};
+
+namespace math
+{
+	inline Vector3fA Clamp(const Vector3fA& value, const Vector3fA& min, const Vector3fA& max) noexcept;
+
+	/// \brief Returns the cross product of two vectors using the right-hand rule.
+	inline Vector3fA Cross(const Vector3fA& a, const Vector3fA& b) noexcept;
+
+	/// \brief Returns the distance between two vectors.
+	inline float Distance(const Vector3fA& a, const Vector3fA& b) noexcept;
+
+	/// \brief Returns the squared distance between two vectors.
+	inline float DistanceSqr(const Vector3fA& a, const Vector3fA& b) noexcept;
+
+	/// \brief Divides the two vectors component-wise and returns the result in a new vector.
+	inline Vector3fA Divide(const Vector3fA& a, const Vector3fA& b) noexcept;
+
+	/// \brief Returns the dot product of two vectors.
+	inline float Dot(const Vector3fA& a, const Vector3fA& b) noexcept;
+
+	/// \brief Multiplies the two vectors component-wise and returns the result in a new vector.
+	inline Vector3fA Multiply(const Vector3fA& a, const Vector3fA& b) noexcept;
+
+	/// \brief Reflects a vector off the plane defined by a normal.
+	inline Vector3fA Reflect(const Vector3fA& vector, const Vector3fA& normal) noexcept;
+}
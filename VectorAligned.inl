@@ -0,0 +1,147 @@
+#pragma once
+
+#include <Core/Math.h>
+#include <Core/Simd.h>
+
+inline float Vector3fA::Length() const noexcept
+{
+	return simd::GetLane<0>(simd::Sqrt(simd::Dot3(value, value)));
+}
+
+inline float Vector3fA::LengthSqr() const noexcept
+{
+	return simd::GetLane<0>(simd::Dot3(value, value));
+}
+
+inline void Vector3fA::Limit(const float value) noexcept
+{
+	// assumes that value >= 0.f
+	const simd::float4 limit = simd::Splat<simd::float4>(value);
+	const simd::float4 length = simd::Sqrt(simd::Dot3(this->value, this->value));
+	this->value = simd::Select(simd::CmpGt(length, limit), simd::Mul(this->value, simd::Div(limit, length)), this->value);
+}
+
+inline void Vector3fA::Normalize() noexcept
+{
+	constexpr float epsilon = 0.0000001f;
+	const simd::float4 length = simd::Sqrt(simd::Dot3(value, value));
+	value = simd::Select(simd::CmpGt(length, simd::Splat<simd::float4>(epsilon)), simd::Div(value, length), simd::Splat<simd::float4>(0.f));
+}
+
+inline void Vector3fA::NormalizeUnsafe() noexcept
+{
+	value = simd::Div(value, simd::Sqrt(simd::Dot3(value, value)));
+}
+
+inline void Vector3fA::LimitFast(const float value) noexcept
+{
+	// assumes that value >= 0.f
+	const simd::float4 limit = simd::Splat<simd::float4>(value);
+	const simd::float4 lengthSqr = simd::Dot3(this->value, this->value);
+	const simd::float4 scale = simd::Mul(limit, simd::RSqrtFast(lengthSqr));
+	this->value = simd::Select(simd::CmpGt(lengthSqr, simd::Mul(limit, limit)), simd::Mul(this->value, scale), this->value);
+}
+
+inline void Vector3fA::NormalizeFast() noexcept
+{
+	constexpr float epsilon = 0.0000001f;
+	const simd::float4 lengthSqr = simd::Dot3(value, value);
+	const simd::float4 scale = simd::Select(simd::CmpGt(lengthSqr, simd::Splat<simd::float4>(epsilon * epsilon)), simd::RSqrtFast(lengthSqr), simd::Splat<simd::float4>(0.f));
+	value = simd::Mul(value, scale);
+}
+
+inline Vector3fA Vector3fA::Limited(const float value) const noexcept
+{
+	Vector3fA result(*this);
+	result.Limit(value);
+	return result;
+}
+
+inline Vector3fA Vector3fA::Normalized() const noexcept
+{
+	Vector3fA result(*this);
+	result.Normalize();
+	return result;
+}
+
+inline Vector3fA Vector3fA::NormalizedUnsafe() const noexcept
+{
+	Vector3fA result(*this);
+	result.NormalizeUnsafe();
+	return result;
+}
+
+inline Vector3fA Vector3fA::LimitedFast(const float value) const noexcept
+{
+	Vector3fA result(*this);
+	result.LimitFast(value);
+	return result;
+}
+
+inline Vector3fA Vector3fA::NormalizedFast() const noexcept
+{
+	Vector3fA result(*this);
+	result.NormalizeFast();
+	return result;
+}
+
+inline Vector3f Vector3fA::XYZ() const noexcept
+{
+	alignas(16) float values[4];
+	simd::StoreAligned(values, value);
+	return Vector3f(values[0], values[1], values[2]);
+}
+
+inline Vector3fA math::Clamp(const Vector3fA& value, const Vector3fA& min, const Vector3fA& max) noexcept
+{
+	return Vector3fA(simd::Min(simd::Max(value.value, min.value), max.value));
+}
+
+inline Vector3fA math::Cross(const Vector3fA& a, const Vector3fA& b) noexcept
+{
+	return Vector3fA(simd::Cross3(a.value, b.value));
+}
+
+inline float math::Distance(const Vector3fA& a, const Vector3fA& b) noexcept
+{
+	return (b - a).Length();
+}
+
+inline float math::DistanceSqr(const Vector3fA& a, const Vector3fA& b) noexcept
+{
+	return (b - a).LengthSqr();
+}
+
+inline Vector3fA math::Divide(const Vector3fA& a, const Vector3fA& b) noexcept
+{
+	return Vector3fA(simd::Div(a.value, b.value));
+}
+
+inline float math::Dot(const Vector3fA& a, const Vector3fA& b) noexcept
+{
+	return simd::GetLane<0>(simd::Dot3(a.value, b.value));
+}
+
+template<>
+inline Vector3fA math::Max<Vector3fA>(const Vector3fA& a, const Vector3fA& b) noexcept
+{
+	return Vector3fA(simd::Max(a.value, b.value));
+}
+
+template<>
+inline Vector3fA math::Min<Vector3fA>(const Vector3fA& a, const Vector3fA& b) noexcept
+{
+	return Vector3fA(simd::Min(a.value, b.value));
+}
+
+inline Vector3fA math::Multiply(const Vector3fA& a, const Vector3fA& b) noexcept
+{
+	return Vector3fA(simd::Mul(a.value, b.value));
+}
+
+inline Vector3fA math::Reflect(const Vector3fA& vector, const Vector3fA& normal) noexcept
+{
+	// -2 * (V dot N) * N + V
+	const simd::float4 dot2 = simd::Mul(simd::Splat<simd::float4>(-2.0f), simd::Dot3(vector.value, normal.value));
+	return Vector3fA(simd::MulAdd(normal.value, dot2, vector.value));
+}
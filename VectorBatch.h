@@ -0,0 +1,29 @@
+#pragma once
+
+#include <Core/Math.h>
+#include <Core/Vector.h>
+
+#include <span>
+
+/// \brief Batch versions of the Vector2f operations that process a whole array in the widest registers.
+/// The input and output spans must have the same size and they are allowed to be the same span.
+namespace math
+{
+	/// \brief Clamps each vector component-wise between min and max.
+	inline void Clamp(std::span<const Vector2f> values, const Vector2f& min, const Vector2f& max, std::span<Vector2f> results) noexcept;
+
+	/// \brief Linearly interpolates from each vector in a to the matching vector in b based on t.
+	inline void Lerp(std::span<const Vector2f> a, std::span<const Vector2f> b, const float t, std::span<Vector2f> results) noexcept;
+
+	/// \brief Reduces the length of each vector so that it doesn't exceed value.
+	/// If the length of a vector is 0 and value is less than 0 then it makes it a NaN vector.
+	inline void Limit(std::span<const Vector2f> values, const float value, std::span<Vector2f> results) noexcept;
+
+	/// \brief Normalizes each vector to have a length of 1 unit.
+	/// If the length of a vector is 0 then it makes it a zero vector.
+	inline void Normalize(std::span<const Vector2f> values, std::span<Vector2f> results) noexcept;
+
+	/// \brief Converts each vector component-wise from one range to another range.
+	/// The scale between the ranges is computed once so the results can differ from Remap by a rounding error.
+	inline void Remap(std::span<const Vector2f> values, const Vector2f& fromA, const Vector2f& fromB, const Vector2f& toA, const Vector2f& toB, std::span<Vector2f> results) noexcept;
+}
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <Core/Instrument.h>
+#include <Core/Math.h>
+#include <Core/Simd.h>
+#include <Core/VectorWide.h>
+
+// the kernels without instrumentation, which the native kernels of Dispatch.h also use
+namespace math::detail
+{
+	inline void Clamp(std::span<const Vector2f> values, const Vector2f& min, const Vector2f& max, std::span<Vector2f> results) noexcept
+	{
+		const Vector2f* input = values.data();
+		Vector2f* output = results.data();
+		simd::ForEach(static_cast<int32>(values.size()), [&]<typename Float>(const int32 i)
+		{
+			using Wide = Vector2fx<sizeof(Float) / sizeof(float)>;
+			math::Clamp(Wide::Load(input + i), Wide(min), Wide(max)).Store(output + i);
+		});
+	}
+
+	inline void Lerp(std::span<const Vector2f> a, std::span<const Vector2f> b, const float t, std::span<Vector2f> results) noexcept
+	{
+		const Vector2f* inputA = a.data();
+		const Vector2f* inputB = b.data();
+		Vector2f* output = results.data();
+		simd::ForEach(static_cast<int32>(a.size()), [&]<typename Float>(const int32 i)
+		{
+			using Wide = Vector2fx<sizeof(Float) / sizeof(float)>;
+			const Wide from = Wide::Load(inputA + i);
+			(from + (Wide::Load(inputB + i) - from) * t).Store(output + i);
+		});
+	}
+
+	inline void Limit(std::span<const Vector2f> values, const float value, std::span<Vector2f> results) noexcept
+	{
+		const Vector2f* input = values.data();
+		Vector2f* output = results.data();
+		simd::ForEach(static_cast<int32>(values.size()), [&]<typename Float>(const int32 i)
+		{
+			using Wide = Vector2fx<sizeof(Float) / sizeof(float)>;
+			Wide::Load(input + i).Limited(value).Store(output + i);
+		});
+	}
+
+	inline void Normalize(std::span<const Vector2f> values, std::span<Vector2f> results) noexcept
+	{
+		const Vector2f* input = values.data();
+		Vector2f* output = results.data();
+		simd::ForEach(static_cast<int32>(values.size()), [&]<typename Float>(const int32 i)
+		{
+			using Wide = Vector2fx<sizeof(Float) / sizeof(float)>;
+			Wide::Load(input + i).Normalized().Store(output + i);
+		});
+	}
+
+	inline void Remap(std::span<const Vector2f> values, const Vector2f& fromA, const Vector2f& fromB, const Vector2f& toA, const Vector2f& toB, std::span<Vector2f> results) noexcept
+	{
+		// (value - fromA) * scale + toA where scale = (toB - toA) / (fromB - fromA), fromA is subtracted first
+		// rather than folded into the offset because the subtraction is exact when the value is close to it
+		const Vector2f scale = math::Divide(toB - toA, fromB - fromA);
+
+		const Vector2f* input = values.data();
+		Vector2f* output = results.data();
+		simd::ForEach(static_cast<int32>(values.size()), [&]<typename Float>(const int32 i)
+		{
+			using Wide = Vector2fx<sizeof(Float) / sizeof(float)>;
+			Wide value = Wide::Load(input + i);
+			value.x = simd::MulAdd(simd::Sub(value.x, simd::Splat<Float>(fromA.x)), simd::Splat<Float>(scale.x), simd::Splat<Float>(toA.x));
+			value.y = simd::MulAdd(simd::Sub(value.y, simd::Splat<Float>(fromA.y)), simd::Splat<Float>(scale.y), simd::Splat<Float>(toA.y));
+			value.Store(output + i);
+		});
+	}
+}
+
+inline void math::Clamp(std::span<const Vector2f> values, const Vector2f& min, const Vector2f& max, std::span<Vector2f> results) noexcept
+{
+	MATH_TIMER(instrument::Timer::Clamp);
+	detail::Clamp(values, min, max, results);
+}
+
+inline void math::Lerp(std::span<const Vector2f> a, std::span<const Vector2f> b, const float t, std::span<Vector2f> results) noexcept
+{
+	MATH_TIMER(instrument::Timer::Lerp);
+	detail::Lerp(a, b, t, results);
+}
+
+inline void math::Limit(std::span<const Vector2f> values, const float value, std::span<Vector2f> results) noexcept
+{
+	{
+		MATH_TIMER(instrument::Timer::Limit);
+		detail::Limit(values, value, results);
+	}
+	// the results are counted after the timer so that counting them isn't part of the time
+	MATH_COUNT(instrument::Counter::LimitVectors, values.size());
+	MATH_COUNT(instrument::Counter::LimitNaN, instrument::detail::CountNaN(results.first(values.size())));
+}
+
+inline void math::Normalize(std::span<const Vector2f> values, std::span<Vector2f> results) noexcept
+{
+	{
+		MATH_TIMER(instrument::Timer::Normalize);
+		detail::Normalize(values, results);
+	}
+	MATH_COUNT(instrument::Counter::NormalizeVectors, values.size());
+	MATH_COUNT(instrument::Counter::NormalizeZeroLength, instrument::detail::CountZero(results.first(values.size())));
+	MATH_COUNT(instrument::Counter::NormalizeNaN, instrument::detail::CountNaN(results.first(values.size())));
+}
+
+inline void math::Remap(std::span<const Vector2f> values, const Vector2f& fromA, const Vector2f& fromB, const Vector2f& toA, const Vector2f& toB, std::span<Vector2f> results) noexcept
+{
+	MATH_TIMER(instrument::Timer::Remap);
+	detail::Remap(values, fromA, fromB, toA, toB, results);
+}
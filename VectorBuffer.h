@@ -0,0 +1,82 @@
+#pragma once
+
+#include <Core/Math.h>
+#include <Core/Vector.h>
+
+#include <memory_resource>
+#include <span>
+
+/// \brief A contiguous array of Vector2f that allocates from a memory resource, such as an Arena for scratch
+/// data that lives for a frame or a Pool to reuse the memory across frames.
+///
+/// The memory is aligned to simd::Alignment and the capacity is a multiple of it, so the batch kernels never
+/// straddle a cache line. The buffer converts to a span so it can be passed to them directly. The resource
+/// must outlive the buffer and the memory moves together with the resource, so a buffer that is moved to
+/// also takes the resource of the buffer that it was moved from.
+class Vector2fBuffer
+{
+public:
+	/// \brief Construct an empty buffer that allocates from the heap.
+	Vector2fBuffer() noexcept = default;
+	/// \brief Construct an empty buffer that allocates from resource.
+	explicit Vector2fBuffer(std::pmr::memory_resource* resource) noexcept : m_Resource(resource) {}
+	/// \brief Construct a buffer of count zero vectors that allocates from resource.
+	explicit Vector2fBuffer(const int32 count, std::pmr::memory_resource* resource = std::pmr::new_delete_resource());
+	/// \brief Construct a buffer that is a copy of the values and allocates from resource.
+	explicit Vector2fBuffer(std::span<const Vector2f> values, std::pmr::memory_resource* resource = std::pmr::new_delete_resource());
+
+	/// \brief Construct a buffer that is a copy of rhs and allocates from the same resource.
+	Vector2fBuffer(const Vector2fBuffer& rhs);
+	Vector2fBuffer(Vector2fBuffer&& rhs) noexcept;
+	~Vector2fBuffer();
+
+	/// \brief Replaces the contents with a copy of rhs, the buffer keeps its own resource.
+	Vector2fBuffer& operator=(const Vector2fBuffer& rhs);
+	Vector2fBuffer& operator=(Vector2fBuffer&& rhs) noexcept;
+
+	/// \brief Returns the vector at index.
+	Vector2f& operator[](const int32 index) noexcept { return m_Data[index]; }
+	const Vector2f& operator[](const int32 index) const noexcept { return m_Data[index]; }
+
+	/// \brief Returns a span of the vectors which is invalidated when the buffer reallocates.
+	operator std::span<Vector2f>() noexcept { return std::span(m_Data, m_Count); }
+	operator std::span<const Vector2f>() const noexcept { return std::span<const Vector2f>(m_Data, m_Count); }
+
+	Vector2f* begin() noexcept { return m_Data; }
+	Vector2f* end() noexcept { return m_Data + m_Count; }
+	const Vector2f* begin() const noexcept { return m_Data; }
+	const Vector2f* end() const noexcept { return m_Data + m_Count; }
+
+	/// \brief Returns the vectors, aligned to simd::Alignment.
+	Vector2f* GetData() noexcept { return m_Data; }
+	const Vector2f* GetData() const noexcept { return m_Data; }
+	/// \brief Returns the number of vectors in the buffer.
+	int32 GetCount() const noexcept { return m_Count; }
+	/// \brief Returns the number of vectors the buffer can hold before it needs to reallocate.
+	int32 GetCapacity() const noexcept { return m_Capacity; }
+	/// \brief Returns the resource that the buffer allocates from.
+	std::pmr::memory_resource* GetResource() const noexcept { return m_Resource; }
+	/// \brief Returns true if the buffer doesn't contain any vectors.
+	bool IsEmpty() const noexcept { return m_Count == 0; }
+
+	/// \brief Adds a vector to the end of the buffer.
+	void Append(const Vector2f& value);
+	/// \brief Removes all vectors from the buffer without releasing its memory.
+	void Clear() noexcept { m_Count = 0; }
+	/// \brief Makes sure the buffer can hold at least capacity vectors without reallocating.
+	void Reserve(const int32 capacity);
+	/// \brief Changes the number of vectors in the buffer, new vectors are initialized to zero.
+	void Resize(const int32 count);
+
+	/// \brief Replaces the contents of the buffer with a copy of the values.
+	void Assign(std::span<const Vector2f> values);
+
+private:
+	void Reallocate(const int32 capacity);
+
+private:
+	Vector2f* m_Data = nullptr;
+	int32 m_Count = 0;
+	int32 m_Capacity = 0;
+	std::pmr::memory_resource* m_Resource = std::pmr::new_delete_resource();
+};
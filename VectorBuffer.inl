@@ -0,0 +1,112 @@
+#pragma once
+
+#include <Core/Math.h>
+#include <Core/Simd.h>
+
+#include <algorithm>
+
+inline Vector2fBuffer::Vector2fBuffer(const int32 count, std::pmr::memory_resource* resource)
+	: m_Resource(resource)
+{
+	Resize(count);
+}
+
+inline Vector2fBuffer::Vector2fBuffer(std::span<const Vector2f> values, std::pmr::memory_resource* resource)
+	: m_Resource(resource)
+{
+	Assign(values);
+}
+
+inline Vector2fBuffer::Vector2fBuffer(const Vector2fBuffer& rhs)
+	: m_Resource(rhs.m_Resource)
+{
+	Assign(rhs);
+}
+
+inline Vector2fBuffer::Vector2fBuffer(Vector2fBuffer&& rhs) noexcept
+	: m_Data(rhs.m_Data)
+	, m_Count(rhs.m_Count)
+	, m_Capacity(rhs.m_Capacity)
+	, m_Resource(rhs.m_Resource)
+{
+	rhs.m_Data = nullptr;
+	rhs.m_Count = rhs.m_Capacity = 0;
+}
+
+inline Vector2fBuffer::~Vector2fBuffer()
+{
+	if (m_Data)
+		m_Resource->deallocate(m_Data, sizeof(Vector2f) * m_Capacity, simd::Alignment);
+}
+
+inline Vector2fBuffer& Vector2fBuffer::operator=(const Vector2fBuffer& rhs)
+{
+	if (this != &rhs)
+		Assign(rhs);
+	return *this;
+}
+
+inline Vector2fBuffer& Vector2fBuffer::operator=(Vector2fBuffer&& rhs) noexcept
+{
+	if (this != &rhs)
+	{
+		if (m_Data)
+			m_Resource->deallocate(m_Data, sizeof(Vector2f) * m_Capacity, simd::Alignment);
+		m_Data = rhs.m_Data;
+		m_Count = rhs.m_Count;
+		m_Capacity = rhs.m_Capacity;
+		m_Resource = rhs.m_Resource;
+		rhs.m_Data = nullptr;
+		rhs.m_Count = rhs.m_Capacity = 0;
+	}
+	return *this;
+}
+
+inline void Vector2fBuffer::Append(const Vector2f& value)
+{
+	if (m_Count == m_Capacity)
+		Reallocate(math::Max(m_Capacity * 2, 16));
+	m_Data[m_Count++] = value;
+}
+
+inline void Vector2fBuffer::Reserve(const int32 capacity)
+{
+	if (m_Capacity < capacity)
+		Reallocate(capacity);
+}
+
+inline void Vector2fBuffer::Resize(const int32 count)
+{
+	Reserve(count);
+	if (m_Count < count)
+		std::fill(m_Data + m_Count, m_Data + count, Vector2f::Zero);
+	m_Count = count;
+}
+
+inline void Vector2fBuffer::Assign(std::span<const Vector2f> values)
+{
+	const int32 count = static_cast<int32>(values.size());
+	if (m_Capacity < count)
+	{
+		// the old vectors are replaced so they aren't copied into the new memory
+		m_Count = 0;
+		Reallocate(count);
+	}
+	std::copy_n(values.data(), count, m_Data);
+	m_Count = count;
+}
+
+inline void Vector2fBuffer::Reallocate(const int32 capacity)
+{
+	// round up so that the capacity fills whole aligned blocks
+	constexpr int32 block = simd::Alignment / sizeof(Vector2f);
+	const int32 rounded = (capacity + block - 1) / block * block;
+
+	Vector2f* memory = static_cast<Vector2f*>(m_Resource->allocate(sizeof(Vector2f) * rounded, simd::Alignment));
+	std::copy_n(m_Data, m_Count, memory);
+	if (m_Data)
+		m_Resource->deallocate(m_Data, sizeof(Vector2f) * m_Capacity, simd::Alignment);
+
+	m_Data = memory;
+	m_Capacity = rounded;
+}
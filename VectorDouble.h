@@ -0,0 +1,284 @@
+#pragma once
+
+#include <Core/Vector.h>
+
+class Vector3d;
+
+/// \brief A geometric object that has length and direction that can be used to represent positions and/or directions in 2d,
+/// with the same members as Vector2f in double precision for positions that are too far from the origin for floats.
+class Vector2d
+{
+public:
+	/// \brief Construct a new vector with uninitialized members.
+	constexpr Vector2d() noexcept : x(), y() {}
+	/// \brief Construct a new vector with both members initialized to value.
+	constexpr explicit Vector2d(const double value) noexcept : x(value), y(value) {}
+	/// \brief Construct a new vector with members initialized to values x and y.
+	constexpr explicit Vector2d(const double x, const double y) noexcept : x(x), y(y) {}
+	/// \brief Construct a new vector with members initialized to the members of a Vector2f.
+	constexpr explicit Vector2d(const Vector2f& value) noexcept : x(value.x), y(value.y) {}
+
+	/// \brief Returns true if both members are identical.
+	constexpr bool operator==(const Vector2d& rhs) const noexcept { return (x == rhs.x) && (y == rhs.y); }
+	/// \brief Returns true if either members aren't identical.
+	constexpr bool operator!=(const Vector2d& rhs) const noexcept { return (x != rhs.x) || (y != rhs.y); }
+
+	/// \brief Adds the two vectors component-wise and returns the result in a new vector.
+	constexpr Vector2d operator+(const Vector2d& rhs) const noexcept { return Vector2d(x + rhs.x, y + rhs.y); }
+	/// \brief Subtracts the two vectors component-wise and returns the result in a new vector.
+	constexpr Vector2d operator-(const Vector2d& rhs) const noexcept { return Vector2d(x - rhs.x, y - rhs.y); }
+
+	/// \brief Adds the two vectors component-wise, stores the result in this vector and returns a reference.
+	constexpr Vector2d& operator+=(const Vector2d& rhs) noexcept { x += rhs.x; y += rhs.y; return *this; }
+	/// \brief Subtracts the two vectors component-wise, stores the result in this vector and returns a reference.
+	constexpr Vector2d& operator-=(const Vector2d& rhs) noexcept { x -= rhs.x; y -= rhs.y; return *this; }
+
+	/// \brief Multiplies the vector by a value and returns the result in a new vector.
+	constexpr Vector2d operator*(const double rhs) const noexcept { return Vector2d(x * rhs, y * rhs); }
+	/// \brief Divides the vector by a value and returns the result in a new vector.
+	constexpr Vector2d operator/(const double rhs) const noexcept { return Vector2d(x / rhs, y / rhs); }
+
+	/// \brief Multiplies the vector by a value, stores the result in this vector and returns a reference.
+	constexpr Vector2d& operator*=(const double rhs) noexcept { x *= rhs; y *= rhs; return *this; }
+	/// \brief Divides the vector by a value, stores the result in this vector and returns a reference.
+	constexpr Vector2d& operator/=(const double rhs) noexcept { x /= rhs; y /= rhs; return *this; }
+
+	/// \brief Returns a new vector with non-negated members.
+	constexpr Vector2d operator+() const noexcept { return *this; }
+	/// \brief Returns a new vector with negated members.
+	constexpr Vector2d operator-() const noexcept { return Vector2d(-x, -y); }
+
+	/// \brief Returns the length of this vector.
+	constexpr double Length() const noexcept;
+	/// \brief Returns the squared length of this vector.
+	constexpr double LengthSqr() const noexcept;
+
+	/// \brief Reduce the vector length so that it doesn't exceed value.
+	/// If the length of the vector is 0 and value is less than 0 then it makes it a NaN vector.
+	constexpr void Limit(const double value) noexcept;
+	/// \brief Normalize this vector have a length of 1 unit.
+	/// If the length of the vector is 0 then it makes it a zero vector.
+	constexpr void Normalize() noexcept;
+	/// \brief Normalize this vector have a length of 1 unit.
+	/// If the length of the vector is 0 then it makes it a NaN vector.
+	constexpr void NormalizeUnsafe() noexcept;
+
+	/// \brief Reduce the vector length so that it doesn't exceed value, the same as Limit because there is no
+	/// fast reciprocal square root for doubles. It is there so that code can switch between Vector2f and Vector2d.
+	constexpr void LimitFast(const double value) noexcept;
+	/// \brief Normalize this vector have a length of 1 unit, the same as Normalize because there is no fast
+	/// reciprocal square root for doubles. If the length of the vector is 0 then it makes it a zero vector.
+	constexpr void NormalizeFast() noexcept;
+
+	/// \brief Returns a vector whose length doesn't exceed value.
+	/// If the length of the vector is 0 and value is less than it returns a NaN vector.
+	[[nodiscard]] constexpr Vector2d Limited(const double value) const noexcept;
+	/// \brief Returns a normalized vector with a length of 1 unit.
+	/// If the length of the vector is 0 then it returns a zero vector.
+	[[nodiscard]] constexpr Vector2d Normalized() const noexcept;
+	/// \brief Returns a normalized vector with a length of 1 unit.
+	/// If the length of the vector is 0 then it returns a NaN vector.
+	[[nodiscard]] constexpr Vector2d NormalizedUnsafe() const noexcept;
+
+	/// \brief Returns a vector whose length doesn't exceed value, the same as Limited.
+	[[nodiscard]] constexpr Vector2d LimitedFast(const double value) const noexcept;
+	/// \brief Returns a normalized vector with a length of 1 unit, the same as Normalized.
+	/// If the length of the vector is 0 then it returns a zero vector.
+	[[nodiscard]] constexpr Vector2d NormalizedFast() const noexcept;
+
+	/// \brief Converts this vector to a Vector3d with 0 in place of Y, and Y in place of Z.
+	constexpr Vector3d X0Y() const noexcept;
+	/// \brief Converts this vector to a Vector3d with 0 in place of Z.
+	constexpr Vector3d XY0() const noexcept;
+	/// \brief Converts this vector to a Vector2f by rounding each member to the nearest float.
+	constexpr Vector2f ToVector2f() const noexcept;
+
+	/// \brief Shorthand for writing Vector2d(1.0, 0.0).
+	static const Vector2d AxisX;
+	/// \brief Shorthand for writing Vector2d(0.0, 1.0).
+	static const Vector2d AxisY;
+	/// \brief Shorthand for writing Vector2d(1.0).
+	static const Vector2d One;
+	/// \brief Shorthand for writing Vector2d(0.0).
+	static const Vector2d Zero;
+
+public:
+	double x, y;
+};
+
+inline constexpr Vector2d Vector2d::AxisX(1.0, 0.0);
+inline constexpr Vector2d Vector2d::AxisY(0.0, 1.0);
+inline constexpr Vector2d Vector2d::One(1.0);
+inline constexpr Vector2d Vector2d::Zero(0.0);
+
+namespace math
+{
+	inline constexpr Vector2d Clamp(const Vector2d& value, const Vector2d& min, const Vector2d& max) noexcept;
+
+	/// \brief Returns the distance between two vectors.
+	inline constexpr double Distance(const Vector2d& a, const Vector2d& b) noexcept;
+
+	/// \brief Returns the squared distance between two vectors.
+	inline constexpr double DistanceSqr(const Vector2d& a, const Vector2d& b) noexcept;
+
+	/// \brief Divides the two vectors component-wise and returns the result in a new vector.
+	inline constexpr Vector2d Divide(const Vector2d& a, const Vector2d& b) noexcept;
+
+	/// \brief Returns the dot product of two vectors.
+	inline constexpr double Dot(const Vector2d& a, const Vector2d& b) noexcept;
+
+	/// \brief Multiplies the two vectors component-wise and returns the result in a new vector.
+	inline constexpr Vector2d Multiply(const Vector2d& a, const Vector2d& b) noexcept;
+
+	/// \brief Rotates a vector 90 degrees (clockwise) to the original vector and returns the result in a new vector.
+	inline constexpr Vector2d Perpendicular(const Vector2d& vector) noexcept;
+
+	/// \brief Reflects a vector off the vector defined by a normal.
+	inline constexpr Vector2d Reflect(const Vector2d& vector, const Vector2d& normal) noexcept;
+}
+
+/// \brief A geometric object that has length and direction that can be used to represent positions and/or directions in 3d,
+/// with the same members as Vector3f in double precision for positions that are too far from the origin for floats.
+class Vector3d
+{
+public:
+	/// \brief Construct a new vector with uninitialized members.
+	constexpr Vector3d() noexcept : x(), y(), z() {}
+	/// \brief Construct a new vector with all members initialized to value.
+	constexpr explicit Vector3d(const double value) noexcept : x(value), y(value), z(value) {}
+	/// \brief Construct a new vector with members initialized to values x, y and z.
+	constexpr explicit Vector3d(const double x, const double y, const double z) noexcept : x(x), y(y), z(z) {}
+	/// \brief Construct a new vector with members initialized to the members of xy and the value z.
+	constexpr explicit Vector3d(const Vector2d& xy, const double z) noexcept : x(xy.x), y(xy.y), z(z) {}
+	/// \brief Construct a new vector with members initialized to the members of a Vector3f.
+	constexpr explicit Vector3d(const Vector3f& value) noexcept : x(value.x), y(value.y), z(value.z) {}
+
+	/// \brief Returns true if all members are identical.
+	constexpr bool operator==(const Vector3d& rhs) const noexcept { return (x == rhs.x) && (y == rhs.y) && (z == rhs.z); }
+	/// \brief Returns true if any members aren't identical.
+	constexpr bool operator!=(const Vector3d& rhs) const noexcept { return (x != rhs.x) || (y != rhs.y) || (z != rhs.z); }
+
+	/// \brief Adds the two vectors component-wise and returns the result in a new vector.
+	constexpr Vector3d operator+(const Vector3d& rhs) const noexcept { return Vector3d(x + rhs.x, y + rhs.y, z + rhs.z); }
+	/// \brief Subtracts the two vectors component-wise and returns the result in a new vector.
+	constexpr Vector3d operator-(const Vector3d& rhs) const noexcept { return Vector3d(x - rhs.x, y - rhs.y, z - rhs.z); }
+
+	/// \brief Adds the two vectors component-wise, stores the result in this vector and returns a reference.
+	constexpr Vector3d& operator+=(const Vector3d& rhs) noexcept { x += rhs.x; y += rhs.y; z += rhs.z; return *this; }
+	/// \brief Subtracts the two vectors component-wise, stores the result in this vector and returns a reference.
+	constexpr Vector3d& operator-=(const Vector3d& rhs) noexcept { x -= rhs.x; y -= rhs.y; z -= rhs.z; return *this; }
+
+	/// \brief Multiplies the vector by a value and returns the result in a new vector.
+	constexpr Vector3d operator*(const double rhs) const noexcept { return Vector3d(x * rhs, y * rhs, z * rhs); }
+	/// \brief Divides the vector by a value and returns the result in a new vector.
+	constexpr Vector3d operator/(const double rhs) const noexcept { return Vector3d(x / rhs, y / rhs, z / rhs); }
+
+	/// \brief Multiplies the vector by a value, stores the result in this vector and returns a reference.
+	constexpr Vector3d& operator*=(const double rhs) noexcept { x *= rhs; y *= rhs; z *= rhs; return *this; }
+	/// \brief Divides the vector by a value, stores the result in this vector and returns a reference.
+	constexpr Vector3d& operator/=(const double rhs) noexcept { x /= rhs; y /= rhs; z /= rhs; return *this; }
+
+	/// \brief Returns a new vector with non-negated members.
+	constexpr Vector3d operator+() const noexcept { return *this; }
+	/// \brief Returns a new vector with negated members.
+	constexpr Vector3d operator-() const noexcept { return Vector3d(-x, -y, -z); }
+
+	/// \brief Returns the length of this vector.
+	constexpr double Length() const noexcept;
+	/// \brief Returns the squared length of this vector.
+	constexpr double LengthSqr() const noexcept;
+
+	/// \brief Reduce the vector length so that it doesn't exceed value.
+	/// If the length of the vector is 0 and value is less than 0 then it makes it a NaN vector.
+	constexpr void Limit(const double value) noexcept;
+	/// \brief Normalize this vector have a length of 1 unit.
+	/// If the length of the vector is 0 then it makes it a zero vector.
+	constexpr void Normalize() noexcept;
+	/// \brief Normalize this vector have a length of 1 unit.
+	/// If the length of the vector is 0 then it makes it a NaN vector.
+	constexpr void NormalizeUnsafe() noexcept;
+
+	/// \brief Reduce the vector length so that it doesn't exceed value, the same as Limit because there is no
+	/// fast reciprocal square root for doubles. It is there so that code can switch between Vector2f and Vector2d.
+	constexpr void LimitFast(const double value) noexcept;
+	/// \brief Normalize this vector have a length of 1 unit, the same as Normalize because there is no fast
+	/// reciprocal square root for doubles. If the length of the vector is 0 then it makes it a zero vector.
+	constexpr void NormalizeFast() noexcept;
+
+	/// \brief Returns a vector whose length doesn't exceed value.
+	/// If the length of the vector is 0 and value is less than it returns a NaN vector.
+	[[nodiscard]] constexpr Vector3d Limited(const double value) const noexcept;
+	/// \brief Returns a normalized vector with a length of 1 unit.
+	/// If the length of the vector is 0 then it returns a zero vector.
+	[[nodiscard]] constexpr Vector3d Normalized() const noexcept;
+	/// \brief Returns a normalized vector with a length of 1 unit.
+	/// If the length of the vector is 0 then it returns a NaN vector.
+	[[nodiscard]] constexpr Vector3d NormalizedUnsafe() const noexcept;
+
+	/// \brief Returns a vector whose length doesn't exceed value, the same as Limited.
+	[[nodiscard]] constexpr Vector3d LimitedFast(const double value) const noexcept;
+	/// \brief Returns a normalized vector with a length of 1 unit, the same as Normalized.
+	/// If the length of the vector is 0 then it returns a zero vector.
+	[[nodiscard]] constexpr Vector3d NormalizedFast() const noexcept;
+
+	/// \brief Converts this vector to a Vector2d by discarding Z.
+	constexpr Vector2d XY() const noexcept;
+	/// \brief Converts this vector to a Vector2d by discarding Y, and Z in place of Y.
+	constexpr Vector2d XZ() const noexcept;
+	/// \brief Converts this vector to a Vector3f by rounding each member to the nearest float.
+	constexpr Vector3f ToVector3f() const noexcept;
+
+	/// \brief Shorthand for writing Vector3d(1.0, 0.0, 0.0).
+	static const Vector3d AxisX;
+	/// \brief Shorthand for writing Vector3d(0.0, 1.0, 0.0).
+	static const Vector3d AxisY;
+	/// \brief Shorthand for writing Vector3d(0.0, 0.0, 1.0).
+	static const Vector3d AxisZ;
+	/// \brief Shorthand for writing Vector3d(1.0).
+	static const Vector3d One;
+	/// \brief Shorthand for writing Vector3d(0.0).
+	static const Vector3d Zero;
+
+public:
+	double x, y, z;
+};
+
+inline constexpr Vector3d Vector3d::AxisX(1.0, 0.0, 0.0);
+inline constexpr Vector3d Vector3d::AxisY(0.0, 1.0, 0.0);
+inline constexpr Vector3d Vector3d::AxisZ(0.0, 0.0, 1.0);
+inline constexpr Vector3d Vector3d::One(1.0);
+inline constexpr Vector3d Vector3d::Zero(0.0);
+
+namespace math
+{
+	inline constexpr Vector3d Clamp(const Vector3d& value, const Vector3d& min, const Vector3d& max) noexcept;
+
+	/// \brief Returns the cross product of two vectors using the right-hand rule.
+	inline constexpr Vector3d Cross(const Vector3d& a, const Vector3d& b) noexcept;
+
+	/// \brief Returns the distance between two vectors.
+	inline constexpr double Distance(const Vector3d& a, const Vector3d& b) noexcept;
+
+	/// \brief Returns the squared distance between two vectors.
+	inline constexpr double DistanceSqr(const Vector3d& a, const Vector3d& b) noexcept;
+
+	/// \brief Divides the two vectors component-wise and returns the result in a new vector.
+	inline constexpr Vector3d Divide(const Vector3d& a, const Vector3d& b) noexcept;
+
+	/// \brief Returns the dot product of two vectors.
+	inline constexpr double Dot(const Vector3d& a, const Vector3d& b) noexcept;
+
+	/// \brief Multiplies the two vectors component-wise and returns the result in a new vector.
+	inline constexpr Vector3d Multiply(const Vector3d& a, const Vector3d& b) noexcept;
+
+	/// \brief Reflects a vector off the plane defined by a normal.
+	inline constexpr Vector3d Reflect(const Vector3d& vector, const Vector3d& normal) noexcept;
+}
+
+#if defined(MATH_EXTERN_TEMPLATES)
+namespace math
+{
+	extern template Vector2d Lerp<Vector2d>(const Vector2d&, const Vector2d&, const float) noexcept;
+	extern template Vector3d Lerp<Vector3d>(const Vector3d&, const Vector3d&, const float) noexcept;
+}
+#endif
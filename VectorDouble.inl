@@ -0,0 +1,359 @@
+#pragma once
+
+#include <Core/Math.h>
+
+#include <cmath>
+
+namespace math::detail
+{
+	inline constexpr double SqrtDouble(const double value) noexcept
+	{
+		if (std::is_constant_evaluated())
+			return Sqrt(value);
+		return std::sqrt(value);
+	}
+}
+
+inline constexpr double Vector2d::Length() const noexcept
+{
+	return math::detail::SqrtDouble(x * x + y * y);
+}
+
+inline constexpr double Vector2d::LengthSqr() const noexcept
+{
+	return x * x + y * y;
+}
+
+inline constexpr void Vector2d::Limit(const double value) noexcept
+{
+	// assumes that value >= 0.0
+	const double length = Length();
+	if (length > value)
+		*this *= (value / length);
+}
+
+inline constexpr void Vector2d::Normalize() noexcept
+{
+	constexpr double epsilon = 0.0000001;
+	const double length = Length();
+	if (length > epsilon)
+	{
+		*this *= 1.0 / length;
+	}
+	else
+	{
+		x = y = 0.0;
+	}
+}
+
+inline constexpr void Vector2d::NormalizeUnsafe() noexcept
+{
+	*this *= 1.0 / Length();
+}
+
+inline constexpr void Vector2d::LimitFast(const double value) noexcept
+{
+	// assumes that value >= 0.0
+	const double lengthSqr = LengthSqr();
+	if (lengthSqr > value * value)
+		*this *= value / math::detail::SqrtDouble(lengthSqr);
+}
+
+inline constexpr void Vector2d::NormalizeFast() noexcept
+{
+	constexpr double epsilon = 0.0000001;
+	const double lengthSqr = LengthSqr();
+	if (lengthSqr > epsilon * epsilon)
+	{
+		*this *= 1.0 / math::detail::SqrtDouble(lengthSqr);
+	}
+	else
+	{
+		x = y = 0.0;
+	}
+}
+
+inline constexpr Vector2d Vector2d::Limited(const double value) const noexcept
+{
+	Vector2d result(*this);
+	result.Limit(value);
+	return result;
+}
+
+inline constexpr Vector2d Vector2d::Normalized() const noexcept
+{
+	Vector2d result(*this);
+	result.Normalize();
+	return result;
+}
+
+inline constexpr Vector2d Vector2d::NormalizedUnsafe() const noexcept
+{
+	Vector2d result(*this);
+	result.NormalizeUnsafe();
+	return result;
+}
+
+inline constexpr Vector2d Vector2d::LimitedFast(const double value) const noexcept
+{
+	Vector2d result(*this);
+	result.LimitFast(value);
+	return result;
+}
+
+inline constexpr Vector2d Vector2d::NormalizedFast() const noexcept
+{
+	Vector2d result(*this);
+	result.NormalizeFast();
+	return result;
+}
+
+inline constexpr Vector3d Vector2d::X0Y() const noexcept
+{
+	return Vector3d(x, 0.0, y);
+}
+
+inline constexpr Vector3d Vector2d::XY0() const noexcept
+{
+	return Vector3d(*this, 0.0);
+}
+
+inline constexpr Vector2f Vector2d::ToVector2f() const noexcept
+{
+	return Vector2f(static_cast<float>(x), static_cast<float>(y));
+}
+
+inline constexpr Vector2d math::Clamp(const Vector2d& value, const Vector2d& min, const Vector2d& max) noexcept
+{
+	return Vector2d(
+		(value.x < min.x) ? min.x : (value.x > max.x) ? max.x : value.x,
+		(value.y < min.y) ? min.y : (value.y > max.y) ? max.y : value.y);
+}
+
+inline constexpr double math::Distance(const Vector2d& a, const Vector2d& b) noexcept
+{
+	return (b - a).Length();
+}
+
+inline constexpr double math::DistanceSqr(const Vector2d& a, const Vector2d& b) noexcept
+{
+	return (b - a).LengthSqr();
+}
+
+inline constexpr Vector2d math::Divide(const Vector2d& a, const Vector2d& b) noexcept
+{
+	return Vector2d(a.x / b.x, a.y / b.y);
+}
+
+inline constexpr double math::Dot(const Vector2d& a, const Vector2d& b) noexcept
+{
+	return a.x * b.x + a.y * b.y;
+}
+
+template<>
+inline constexpr Vector2d math::Max<Vector2d>(const Vector2d& a, const Vector2d& b) noexcept
+{
+	return Vector2d(
+		(a.x > b.x) ? a.x : b.x,
+		(a.y > b.y) ? a.y : b.y);
+}
+
+template<>
+inline constexpr Vector2d math::Min<Vector2d>(const Vector2d& a, const Vector2d& b) noexcept
+{
+	return Vector2d(
+		(a.x < b.x) ? a.x : b.x,
+		(a.y < b.y) ? a.y : b.y);
+}
+
+inline constexpr Vector2d math::Multiply(const Vector2d& a, const Vector2d& b) noexcept
+{
+	return Vector2d(a.x * b.x, a.y * b.y);
+}
+
+inline constexpr Vector2d math::Perpendicular(const Vector2d& vector) noexcept
+{
+	return Vector2d(vector.y, -vector.x);
+}
+
+inline constexpr Vector2d math::Reflect(const Vector2d& vector, const Vector2d& normal) noexcept
+{
+	// -2 * (V dot N) * N + V
+	const double dot2 = -2.0 * math::Dot(vector, normal);
+	return math::Multiply(Vector2d(dot2), normal) + vector;
+}
+
+inline constexpr double Vector3d::Length() const noexcept
+{
+	return math::detail::SqrtDouble(x * x + y * y + z * z);
+}
+
+inline constexpr double Vector3d::LengthSqr() const noexcept
+{
+	return x * x + y * y + z * z;
+}
+
+inline constexpr void Vector3d::Limit(const double value) noexcept
+{
+	// assumes that value >= 0.0
+	const double length = Length();
+	if (length > value)
+		*this *= (value / length);
+}
+
+inline constexpr void Vector3d::Normalize() noexcept
+{
+	constexpr double epsilon = 0.0000001;
+	const double length = Length();
+	if (length > epsilon)
+	{
+		*this *= 1.0 / length;
+	}
+	else
+	{
+		x = y = z = 0.0;
+	}
+}
+
+inline constexpr void Vector3d::NormalizeUnsafe() noexcept
+{
+	*this *= 1.0 / Length();
+}
+
+inline constexpr void Vector3d::LimitFast(const double value) noexcept
+{
+	// assumes that value >= 0.0
+	const double lengthSqr = LengthSqr();
+	if (lengthSqr > value * value)
+		*this *= value / math::detail::SqrtDouble(lengthSqr);
+}
+
+inline constexpr void Vector3d::NormalizeFast() noexcept
+{
+	constexpr double epsilon = 0.0000001;
+	const double lengthSqr = LengthSqr();
+	if (lengthSqr > epsilon * epsilon)
+	{
+		*this *= 1.0 / math::detail::SqrtDouble(lengthSqr);
+	}
+	else
+	{
+		x = y = z = 0.0;
+	}
+}
+
+inline constexpr Vector3d Vector3d::Limited(const double value) const noexcept
+{
+	Vector3d result(*this);
+	result.Limit(value);
+	return result;
+}
+
+inline constexpr Vector3d Vector3d::Normalized() const noexcept
+{
+	Vector3d result(*this);
+	result.Normalize();
+	return result;
+}
+
+inline constexpr Vector3d Vector3d::NormalizedUnsafe() const noexcept
+{
+	Vector3d result(*this);
+	result.NormalizeUnsafe();
+	return result;
+}
+
+inline constexpr Vector3d Vector3d::LimitedFast(const double value) const noexcept
+{
+	Vector3d result(*this);
+	result.LimitFast(value);
+	return result;
+}
+
+inline constexpr Vector3d Vector3d::NormalizedFast() const noexcept
+{
+	Vector3d result(*this);
+	result.NormalizeFast();
+	return result;
+}
+
+inline constexpr Vector2d Vector3d::XY() const noexcept
+{
+	return Vector2d(x, y);
+}
+
+inline constexpr Vector2d Vector3d::XZ() const noexcept
+{
+	return Vector2d(x, z);
+}
+
+inline constexpr Vector3f Vector3d::ToVector3f() const noexcept
+{
+	return Vector3f(static_cast<float>(x), static_cast<float>(y), static_cast<float>(z));
+}
+
+inline constexpr Vector3d math::Clamp(const Vector3d& value, const Vector3d& min, const Vector3d& max) noexcept
+{
+	return Vector3d(
+		(value.x < min.x) ? min.x : (value.x > max.x) ? max.x : value.x,
+		(value.y < min.y) ? min.y : (value.y > max.y) ? max.y : value.y,
+		(value.z < min.z) ? min.z : (value.z > max.z) ? max.z : value.z);
+}
+
+inline constexpr Vector3d math::Cross(const Vector3d& a, const Vector3d& b) noexcept
+{
+	return Vector3d(
+		a.y * b.z - a.z * b.y,
+		a.z * b.x - a.x * b.z,
+		a.x * b.y - a.y * b.x);
+}
+
+inline constexpr double math::Distance(const Vector3d& a, const Vector3d& b) noexcept
+{
+	return (b - a).Length();
+}
+
+inline constexpr double math::DistanceSqr(const Vector3d& a, const Vector3d& b) noexcept
+{
+	return (b - a).LengthSqr();
+}
+
+inline constexpr Vector3d math::Divide(const Vector3d& a, const Vector3d& b) noexcept
+{
+	return Vector3d(a.x / b.x, a.y / b.y, a.z / b.z);
+}
+
+inline constexpr double math::Dot(const Vector3d& a, const Vector3d& b) noexcept
+{
+	return a.x * b.x + a.y * b.y + a.z * b.z;
+}
+
+template<>
+inline constexpr Vector3d math::Max<Vector3d>(const Vector3d& a, const Vector3d& b) noexcept
+{
+	return Vector3d(
+		(a.x > b.x) ? a.x : b.x,
+		(a.y > b.y) ? a.y : b.y,
+		(a.z > b.z) ? a.z : b.z);
+}
+
+template<>
+inline constexpr Vector3d math::Min<Vector3d>(const Vector3d& a, const Vector3d& b) noexcept
+{
+	return Vector3d(
+		(a.x < b.x) ? a.x : b.x,
+		(a.y < b.y) ? a.y : b.y,
+		(a.z < b.z) ? a.z : b.z);
+}
+
+inline constexpr Vector3d math::Multiply(const Vector3d& a, const Vector3d& b) noexcept
+{
+	return Vector3d(a.x * b.x, a.y * b.y, a.z * b.z);
+}
+
+inline constexpr Vector3d math::Reflect(const Vector3d& vector, const Vector3d& normal) noexcept
+{
+	// -2 * (V dot N) * N + V
+	const double dot2 = -2.0 * math::Dot(vector, normal);
+	return math::Multiply(Vector3d(dot2), normal) + vector;
+}
\ No newline at end of file
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <Core/Math.h>
+#include <Core/Vector.h>
+#include <Core/VectorStream.h>
+#include <Core/VectorWide.h>
+
+#include <concepts>
+#include <span>
+#include <type_traits>
+
+/// \brief A lazily evaluated element-wise expression over Vector2fStream, so that a chain of arithmetic such
+/// as a + (b - a) * t is computed in a single pass over memory when it is assigned to a stream instead of a
+/// pass and a temporary stream per operator.
+///
+/// Expressions are built with the operators below from streams, other expressions, Vector2f and float
+/// constants and spans of per-vector floats. They refer to the streams and spans rather than copying them,
+/// so they must be evaluated before any of them is modified or destroyed. Every operand must have the same
+/// count. A stream can be assigned an expression that it is part of because each vector is read before it
+/// is written.
+template<typename Function>
+class Vector2fExpression
+{
+public:
+	/// \brief Construct an expression of count vectors where function(width, index) returns a Vector2fx of
+	/// std::integral_constant width vectors starting at index.
+	constexpr explicit Vector2fExpression(const int32 count, Function function) noexcept : m_Function(function), m_Count(count) {}
+
+	/// \brief Returns the number of vectors in the expression.
+	int32 GetCount() const noexcept { return m_Count; }
+
+	/// \brief Returns Width vectors of the expression starting at index.
+	template<int32 Width>
+	Vector2fx<Width> Evaluate(const int32 index) const noexcept { return m_Function(std::integral_constant<int32, Width>(), index); }
+
+	/// \brief Evaluates every vector of the expression into separate x and y lanes.
+	void Store(float* x, float* y) const noexcept;
+	/// \brief Evaluates every vector of the expression into values which must be the same size.
+	void Store(std::span<Vector2f> values) const noexcept;
+
+private:
+	Function m_Function;
+	int32 m_Count = 0;
+};
+
+namespace math::detail
+{
+	template<typename Type>
+	struct IsVector2fExpression : std::false_type {};
+	template<typename Function>
+	struct IsVector2fExpression<Vector2fExpression<Function>> : std::true_type {};
+}
+
+/// \brief A stream or an expression that can be an operand of an expression.
+template<typename Type>
+concept Vector2fOperand = std::same_as<std::remove_cvref_t<Type>, Vector2fStream> || math::detail::IsVector2fExpression<std::remove_cvref_t<Type>>::value;
+
+/// \brief Adds the operands component-wise.
+template<Vector2fOperand Lhs, Vector2fOperand Rhs>
+inline auto operator+(const Lhs& lhs, const Rhs& rhs) noexcept;
+/// \brief Adds the vector to each vector of the operand.
+template<Vector2fOperand Lhs>
+inline auto operator+(const Lhs& lhs, const Vector2f& rhs) noexcept;
+/// \brief Adds the vector to each vector of the operand.
+template<Vector2fOperand Rhs>
+inline auto operator+(const Vector2f& lhs, const Rhs& rhs) noexcept;
+
+/// \brief Subtracts the operands component-wise.
+template<Vector2fOperand Lhs, Vector2fOperand Rhs>
+inline auto operator-(const Lhs& lhs, const Rhs& rhs) noexcept;
+/// \brief Subtracts the vector from each vector of the operand.
+template<Vector2fOperand Lhs>
+inline auto operator-(const Lhs& lhs, const Vector2f& rhs) noexcept;
+/// \brief Subtracts each vector of the operand from the vector.
+template<Vector2fOperand Rhs>
+inline auto operator-(const Vector2f& lhs, const Rhs& rhs) noexcept;
+
+/// \brief Multiplies each vector of the operand by a value.
+template<Vector2fOperand Lhs>
+inline auto operator*(const Lhs& lhs, const float rhs) noexcept;
+/// \brief Multiplies each vector of the operand by a value.
+template<Vector2fOperand Rhs>
+inline auto operator*(const float lhs, const Rhs& rhs) noexcept;
+/// \brief Multiplies each vector of the operand by the matching value, which must be the same size.
+template<Vector2fOperand Lhs>
+inline auto operator*(const Lhs& lhs, std::span<const float> rhs) noexcept;
+
+/// \brief Divides each vector of the operand by a value.
+template<Vector2fOperand Lhs>
+inline auto operator/(const Lhs& lhs, const float rhs) noexcept;
+/// \brief Divides each vector of the operand by the matching value, which must be the same size.
+template<Vector2fOperand Lhs>
+inline auto operator/(const Lhs& lhs, std::span<const float> rhs) noexcept;
+
+/// \brief Negates each vector of the operand.
+template<Vector2fOperand Value>
+inline auto operator-(const Value& value) noexcept;
+
+namespace math
+{
+	/// \brief Returns an expression of a stream, which is only needed to call the members of Vector2fExpression.
+	inline auto Lazy(const Vector2fStream& stream) noexcept;
+	/// \brief Returns the expression itself.
+	template<typename Function>
+	inline const Vector2fExpression<Function>& Lazy(const Vector2fExpression<Function>& expression) noexcept { return expression; }
+
+	/// \brief Multiplies the operands component-wise.
+	template<Vector2fOperand Lhs, Vector2fOperand Rhs>
+	inline auto Multiply(const Lhs& lhs, const Rhs& rhs) noexcept;
+	/// \brief Divides the operands component-wise.
+	template<Vector2fOperand Lhs, Vector2fOperand Rhs>
+	inline auto Divide(const Lhs& lhs, const Rhs& rhs) noexcept;
+}
@@ -0,0 +1,197 @@
+#pragma once
+
+#include <Core/Math.h>
+#include <Core/Simd.h>
+#include <Core/VectorWide.h>
+
+namespace math::detail
+{
+	template<typename Function>
+	inline auto MakeExpression(const int32 count, Function function) noexcept
+	{
+		return Vector2fExpression<Function>(count, function);
+	}
+}
+
+template<typename Function>
+inline void Vector2fExpression<Function>::Store(float* x, float* y) const noexcept
+{
+	simd::ForEach(m_Count, [&]<typename Float>(const int32 i)
+	{
+		Evaluate<sizeof(Float) / sizeof(float)>(i).Store(x + i, y + i);
+	});
+}
+
+template<typename Function>
+inline void Vector2fExpression<Function>::Store(std::span<Vector2f> values) const noexcept
+{
+	Vector2f* output = values.data();
+	simd::ForEach(m_Count, [&]<typename Float>(const int32 i)
+	{
+		Evaluate<sizeof(Float) / sizeof(float)>(i).Store(output + i);
+	});
+}
+
+template<typename Function>
+inline Vector2fStream::Vector2fStream(const Vector2fExpression<Function>& expression)
+{
+	*this = expression;
+}
+
+template<typename Function>
+inline Vector2fStream& Vector2fStream::operator=(const Vector2fExpression<Function>& expression)
+{
+	// the new vectors don't need to be zeroed because they are all overwritten
+	Reserve(expression.GetCount());
+	m_Count = expression.GetCount();
+	expression.Store(m_X, m_Y);
+	return *this;
+}
+
+template<typename Function>
+inline Vector2fStream& Vector2fStream::operator+=(const Vector2fExpression<Function>& rhs) noexcept
+{
+	(*this + rhs).Store(m_X, m_Y);
+	return *this;
+}
+
+template<typename Function>
+inline Vector2fStream& Vector2fStream::operator-=(const Vector2fExpression<Function>& rhs) noexcept
+{
+	(*this - rhs).Store(m_X, m_Y);
+	return *this;
+}
+
+inline auto math::Lazy(const Vector2fStream& stream) noexcept
+{
+	const float* x = stream.GetX();
+	const float* y = stream.GetY();
+	return detail::MakeExpression(stream.GetCount(), [x, y](auto width, const int32 i)
+	{
+		return Vector2fx<width>::Load(x + i, y + i);
+	});
+}
+
+template<Vector2fOperand Lhs, Vector2fOperand Rhs>
+inline auto operator+(const Lhs& lhs, const Rhs& rhs) noexcept
+{
+	return math::detail::MakeExpression(lhs.GetCount(), [a = math::Lazy(lhs), b = math::Lazy(rhs)](auto width, const int32 i)
+	{
+		return a.template Evaluate<width>(i) + b.template Evaluate<width>(i);
+	});
+}
+
+template<Vector2fOperand Lhs>
+inline auto operator+(const Lhs& lhs, const Vector2f& rhs) noexcept
+{
+	return math::detail::MakeExpression(lhs.GetCount(), [a = math::Lazy(lhs), rhs](auto width, const int32 i)
+	{
+		return a.template Evaluate<width>(i) + Vector2fx<width>(rhs);
+	});
+}
+
+template<Vector2fOperand Rhs>
+inline auto operator+(const Vector2f& lhs, const Rhs& rhs) noexcept
+{
+	return rhs + lhs;
+}
+
+template<Vector2fOperand Lhs, Vector2fOperand Rhs>
+inline auto operator-(const Lhs& lhs, const Rhs& rhs) noexcept
+{
+	return math::detail::MakeExpression(lhs.GetCount(), [a = math::Lazy(lhs), b = math::Lazy(rhs)](auto width, const int32 i)
+	{
+		return a.template Evaluate<width>(i) - b.template Evaluate<width>(i);
+	});
+}
+
+template<Vector2fOperand Lhs>
+inline auto operator-(const Lhs& lhs, const Vector2f& rhs) noexcept
+{
+	return math::detail::MakeExpression(lhs.GetCount(), [a = math::Lazy(lhs), rhs](auto width, const int32 i)
+	{
+		return a.template Evaluate<width>(i) - Vector2fx<width>(rhs);
+	});
+}
+
+template<Vector2fOperand Rhs>
+inline auto operator-(const Vector2f& lhs, const Rhs& rhs) noexcept
+{
+	return math::detail::MakeExpression(rhs.GetCount(), [lhs, b = math::Lazy(rhs)](auto width, const int32 i)
+	{
+		return Vector2fx<width>(lhs) - b.template Evaluate<width>(i);
+	});
+}
+
+template<Vector2fOperand Lhs>
+inline auto operator*(const Lhs& lhs, const float rhs) noexcept
+{
+	return math::detail::MakeExpression(lhs.GetCount(), [a = math::Lazy(lhs), rhs](auto width, const int32 i)
+	{
+		return a.template Evaluate<width>(i) * rhs;
+	});
+}
+
+template<Vector2fOperand Rhs>
+inline auto operator*(const float lhs, const Rhs& rhs) noexcept
+{
+	return rhs * lhs;
+}
+
+template<Vector2fOperand Lhs>
+inline auto operator*(const Lhs& lhs, std::span<const float> rhs) noexcept
+{
+	const float* values = rhs.data();
+	return math::detail::MakeExpression(lhs.GetCount(), [a = math::Lazy(lhs), values](auto width, const int32 i)
+	{
+		using Float = typename Vector2fx<width>::Float;
+		return a.template Evaluate<width>(i) * simd::Load<Float>(values + i);
+	});
+}
+
+template<Vector2fOperand Lhs>
+inline auto operator/(const Lhs& lhs, const float rhs) noexcept
+{
+	return math::detail::MakeExpression(lhs.GetCount(), [a = math::Lazy(lhs), rhs](auto width, const int32 i)
+	{
+		return a.template Evaluate<width>(i) / rhs;
+	});
+}
+
+template<Vector2fOperand Lhs>
+inline auto operator/(const Lhs& lhs, std::span<const float> rhs) noexcept
+{
+	const float* values = rhs.data();
+	return math::detail::MakeExpression(lhs.GetCount(), [a = math::Lazy(lhs), values](auto width, const int32 i)
+	{
+		using Float = typename Vector2fx<width>::Float;
+		return a.template Evaluate<width>(i) / simd::Load<Float>(values + i);
+	});
+}
+
+template<Vector2fOperand Value>
+inline auto operator-(const Value& value) noexcept
+{
+	return math::detail::MakeExpression(value.GetCount(), [a = math::Lazy(value)](auto width, const int32 i)
+	{
+		return -a.template Evaluate<width>(i);
+	});
+}
+
+template<Vector2fOperand Lhs, Vector2fOperand Rhs>
+inline auto math::Multiply(const Lhs& lhs, const Rhs& rhs) noexcept
+{
+	return detail::MakeExpression(lhs.GetCount(), [a = math::Lazy(lhs), b = math::Lazy(rhs)](auto width, const int32 i)
+	{
+		return math::Multiply(a.template Evaluate<width>(i), b.template Evaluate<width>(i));
+	});
+}
+
+template<Vector2fOperand Lhs, Vector2fOperand Rhs>
+inline auto math::Divide(const Lhs& lhs, const Rhs& rhs) noexcept
+{
+	return detail::MakeExpression(lhs.GetCount(), [a = math::Lazy(lhs), b = math::Lazy(rhs)](auto width, const int32 i)
+	{
+		return math::Divide(a.template Evaluate<width>(i), b.template Evaluate<width>(i));
+	});
+}
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <Core/Math.h>
+#include <Core/Vector.h>
+#include <Core/VectorStream.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <span>
+#include <vector>
+
+/// \brief A binary container of Vector2f that is meant to be memory-mapped and used in place.
+///
+/// The file starts with a 64 byte header that holds a magic number, the version, a tag of the element type,
+/// the layout and the count, followed by the vectors either interleaved as an array-of-structures or as a
+/// lane of all x components followed by a lane of all y components. The lanes start at multiples of
+/// simd::Alignment so they are aligned whenever the file is, which a memory mapping always is.
+/// It uses the byte order of the machine.
+enum class Vector2fLayout : uint32_t
+{
+	AoS,
+	SoA,
+};
+
+/// \brief Read only access to the vectors of a file that doesn't own them, so that it can point directly
+/// into the bytes of a MappedFile from MappedFile.h.
+class Vector2fFileView
+{
+public:
+	/// \brief Construct an empty view.
+	constexpr Vector2fFileView() noexcept = default;
+
+	/// \brief Creates a view of the bytes written by Vector2fFileWriter without copying the vectors. It returns
+	/// false if the header doesn't match, the bytes are too short or they aren't aligned to 4 bytes.
+	static bool Deserialize(std::span<const std::byte> bytes, Vector2fFileView& view) noexcept;
+
+	/// \brief Returns the layout of the vectors in the file.
+	Vector2fLayout GetLayout() const noexcept { return m_Layout; }
+	/// \brief Returns the number of vectors in the file.
+	int32 GetCount() const noexcept { return m_Count; }
+	/// \brief Returns true if the file doesn't contain any vectors.
+	bool IsEmpty() const noexcept { return m_Count == 0; }
+
+	/// \brief Returns the vectors of an AoS file, it is empty for a SoA file.
+	std::span<const Vector2f> GetVectors() const noexcept;
+	/// \brief Returns the lane that holds the x components of a SoA file, it is empty for an AoS file.
+	std::span<const float> GetX() const noexcept;
+	/// \brief Returns the lane that holds the y components of a SoA file, it is empty for an AoS file.
+	std::span<const float> GetY() const noexcept;
+
+	/// \brief Copies the vectors into values which must be the same size as the file, for either layout.
+	void CopyTo(std::span<Vector2f> values) const noexcept;
+	/// \brief Replaces the contents of stream with a copy of the vectors, for either layout.
+	void CopyTo(Vector2fStream& stream) const;
+
+private:
+	const std::byte* m_Data = nullptr;
+	Vector2fLayout m_Layout = Vector2fLayout::AoS;
+	int32 m_Count = 0;
+};
+
+/// \brief Writes the vectors of a file to a stream in chunks, so that a file can be written without having
+/// all of its vectors in memory at once. The number of vectors must be known up front so that the header
+/// is written first, a SoA file also needs a stream that can seek past its end, such as a std::ofstream,
+/// because both lanes are written at once.
+class Vector2fFileWriter
+{
+public:
+	/// \brief Writes the header of a file that will contain count vectors in layout to stream.
+	Vector2fFileWriter(std::ostream& stream, const Vector2fLayout layout, const int32 count);
+
+	/// \brief Replaces bytes with a file that contains a copy of the values in layout.
+	static void Serialize(std::span<const Vector2f> values, const Vector2fLayout layout, std::vector<std::byte>& bytes);
+
+	/// \brief Returns the number of vectors that have been written so far.
+	int32 GetWritten() const noexcept { return m_Written; }
+
+	/// \brief Appends the values to the file. If they would exceed the count that the writer was constructed with
+	/// then none of them are written and the failbit of the stream is set.
+	void Write(std::span<const Vector2f> values);
+	/// \brief Returns true if every vector has been written and the stream didn't fail.
+	bool Finish();
+
+private:
+	std::ostream& m_Stream;
+	int64_t m_Start = 0;
+	Vector2fLayout m_Layout = Vector2fLayout::AoS;
+	int32 m_Count = 0;
+	int32 m_Written = 0;
+};
@@ -0,0 +1,240 @@
+#pragma once
+
+#include <Core/Math.h>
+#include <Core/Simd.h>
+#include <Core/VectorStream.h>
+
+#include <cstring>
+#include <limits>
+#include <ostream>
+
+namespace math::detail
+{
+	constexpr uint32_t s_VectorFileMagic = 0x46463256; // "V2FF"
+	constexpr uint32_t s_VectorFileVersion = 1;
+	constexpr uint32_t s_VectorFileTypeVector2f = 1;
+	// the number of vectors that are deinterleaved at a time on the stack when writing a SoA file
+	constexpr int32 s_VectorFileChunk = 256;
+
+	struct VectorFileHeader
+	{
+		uint32_t magic;
+		uint32_t version;
+		uint32_t type;
+		Vector2fLayout layout;
+		uint64_t count;
+		uint8_t reserved[40];
+	};
+
+	static_assert(sizeof(VectorFileHeader) == simd::Alignment, "The vectors must start at a multiple of simd::Alignment.");
+
+	inline VectorFileHeader MakeHeader(const Vector2fLayout layout, const int32 count) noexcept
+	{
+		VectorFileHeader header = {};
+		header.magic = s_VectorFileMagic;
+		header.version = s_VectorFileVersion;
+		header.type = s_VectorFileTypeVector2f;
+		header.layout = layout;
+		header.count = static_cast<uint64_t>(count);
+		return header;
+	}
+
+	// the y lane of a SoA file starts after the x lane rounded up to simd::Alignment
+	inline constexpr size_t GetLaneSize(const int32 count) noexcept
+	{
+		const size_t size = static_cast<size_t>(count) * sizeof(float);
+		return (size + simd::Alignment - 1) / simd::Alignment * simd::Alignment;
+	}
+
+	inline constexpr size_t GetFileSize(const Vector2fLayout layout, const int32 count) noexcept
+	{
+		if (layout == Vector2fLayout::AoS)
+			return sizeof(VectorFileHeader) + static_cast<size_t>(count) * sizeof(Vector2f);
+		return sizeof(VectorFileHeader) + GetLaneSize(count) + static_cast<size_t>(count) * sizeof(float);
+	}
+
+	inline void Deinterleave(std::span<const Vector2f> values, float* x, float* y) noexcept
+	{
+		const float* input = &values.data()->x;
+		simd::ForEach(static_cast<int32>(values.size()), [&]<typename Float>(const int32 i)
+		{
+			Float valueX, valueY;
+			simd::Deinterleave(input + i * 2, valueX, valueY);
+			simd::Store(x + i, valueX);
+			simd::Store(y + i, valueY);
+		});
+	}
+}
+
+inline bool Vector2fFileView::Deserialize(std::span<const std::byte> bytes, Vector2fFileView& view) noexcept
+{
+	using namespace math::detail;
+	if (bytes.size() < sizeof(VectorFileHeader))
+		return false;
+
+	VectorFileHeader header;
+	std::memcpy(&header, bytes.data(), sizeof(VectorFileHeader));
+	if (header.magic != s_VectorFileMagic || header.version != s_VectorFileVersion || header.type != s_VectorFileTypeVector2f)
+		return false;
+	if (header.layout != Vector2fLayout::AoS && header.layout != Vector2fLayout::SoA)
+		return false;
+	if (header.count > static_cast<uint64_t>(std::numeric_limits<int32>::max()))
+		return false;
+
+	const int32 count = static_cast<int32>(header.count);
+	if (bytes.size() < GetFileSize(header.layout, count))
+		return false;
+
+	const std::byte* data = bytes.data() + sizeof(VectorFileHeader);
+	if (reinterpret_cast<uintptr_t>(data) % alignof(float) != 0)
+		return false;
+
+	view.m_Data = data;
+	view.m_Layout = header.layout;
+	view.m_Count = count;
+	return true;
+}
+
+inline std::span<const Vector2f> Vector2fFileView::GetVectors() const noexcept
+{
+	if (m_Layout != Vector2fLayout::AoS)
+		return {};
+	return std::span(reinterpret_cast<const Vector2f*>(m_Data), m_Count);
+}
+
+inline std::span<const float> Vector2fFileView::GetX() const noexcept
+{
+	if (m_Layout != Vector2fLayout::SoA)
+		return {};
+	return std::span(reinterpret_cast<const float*>(m_Data), m_Count);
+}
+
+inline std::span<const float> Vector2fFileView::GetY() const noexcept
+{
+	if (m_Layout != Vector2fLayout::SoA)
+		return {};
+	return std::span(reinterpret_cast<const float*>(m_Data + math::detail::GetLaneSize(m_Count)), m_Count);
+}
+
+inline void Vector2fFileView::CopyTo(std::span<Vector2f> values) const noexcept
+{
+	if (m_Layout == Vector2fLayout::AoS)
+	{
+		if (m_Count > 0)
+			std::memcpy(values.data(), m_Data, static_cast<size_t>(m_Count) * sizeof(Vector2f));
+		return;
+	}
+
+	const float* inputX = GetX().data();
+	const float* inputY = GetY().data();
+	float* output = &values.data()->x;
+	simd::ForEach(m_Count, [&]<typename Float>(const int32 i)
+	{
+		simd::Interleave(output + i * 2, simd::Load<Float>(inputX + i), simd::Load<Float>(inputY + i));
+	});
+}
+
+inline void Vector2fFileView::CopyTo(Vector2fStream& stream) const
+{
+	if (m_Layout == Vector2fLayout::AoS)
+	{
+		stream.Assign(GetVectors());
+		return;
+	}
+
+	stream.Clear();
+	stream.Resize(m_Count);
+	if (m_Count > 0)
+	{
+		std::memcpy(stream.GetX(), GetX().data(), static_cast<size_t>(m_Count) * sizeof(float));
+		std::memcpy(stream.GetY(), GetY().data(), static_cast<size_t>(m_Count) * sizeof(float));
+	}
+}
+
+inline Vector2fFileWriter::Vector2fFileWriter(std::ostream& stream, const Vector2fLayout layout, const int32 count)
+	: m_Stream(stream)
+	, m_Start(static_cast<int64_t>(stream.tellp()))
+	, m_Layout(layout)
+	, m_Count(count)
+{
+	using namespace math::detail;
+	const VectorFileHeader header = MakeHeader(layout, count);
+	m_Stream.write(reinterpret_cast<const char*>(&header), sizeof(VectorFileHeader));
+}
+
+inline void Vector2fFileWriter::Serialize(std::span<const Vector2f> values, const Vector2fLayout layout, std::vector<std::byte>& bytes)
+{
+	using namespace math::detail;
+	const int32 count = static_cast<int32>(values.size());
+
+	const VectorFileHeader header = MakeHeader(layout, count);
+	bytes.assign(GetFileSize(layout, count), std::byte{ 0 });
+	std::memcpy(bytes.data(), &header, sizeof(VectorFileHeader));
+	if (count == 0)
+		return;
+
+	std::byte* data = bytes.data() + sizeof(VectorFileHeader);
+	if (layout == Vector2fLayout::AoS)
+	{
+		std::memcpy(data, values.data(), static_cast<size_t>(count) * sizeof(Vector2f));
+		return;
+	}
+
+	float* x = reinterpret_cast<float*>(data);
+	float* y = reinterpret_cast<float*>(data + GetLaneSize(count));
+	Deinterleave(values, x, y);
+}
+
+inline void Vector2fFileWriter::Write(std::span<const Vector2f> values)
+{
+	using namespace math::detail;
+	const int32 count = static_cast<int32>(values.size());
+
+	// writing past the count would run the x lane into the y lane, so nothing is written and the stream is failed
+	if (count > m_Count - m_Written)
+	{
+		m_Stream.setstate(std::ios::failbit);
+		return;
+	}
+
+	if (m_Layout == Vector2fLayout::AoS)
+	{
+		m_Stream.write(reinterpret_cast<const char*>(values.data()), static_cast<std::streamsize>(count) * sizeof(Vector2f));
+		m_Written += count;
+		return;
+	}
+
+	// each chunk is split into its lanes which are then written to their own position in the file
+	const int64_t startX = m_Start + static_cast<int64_t>(sizeof(VectorFileHeader));
+	const int64_t startY = startX + static_cast<int64_t>(GetLaneSize(m_Count));
+	float x[s_VectorFileChunk];
+	float y[s_VectorFileChunk];
+	for (int32 begin = 0; begin < count; begin += s_VectorFileChunk)
+	{
+		const int32 size = math::Min(count - begin, s_VectorFileChunk);
+		Deinterleave(values.subspan(begin, size), x, y);
+
+		const int64_t offset = static_cast<int64_t>(m_Written) * sizeof(float);
+		m_Stream.seekp(startX + offset);
+		m_Stream.write(reinterpret_cast<const char*>(x), static_cast<std::streamsize>(size) * sizeof(float));
+		m_Stream.seekp(startY + offset);
+		m_Stream.write(reinterpret_cast<const char*>(y), static_cast<std::streamsize>(size) * sizeof(float));
+		m_Written += size;
+	}
+}
+
+inline bool Vector2fFileWriter::Finish()
+{
+	using namespace math::detail;
+	if (m_Layout == Vector2fLayout::SoA && m_Written == m_Count)
+	{
+		// the padding between the lanes is written explicitly and the stream is left at the end of the file
+		const size_t padding = GetLaneSize(m_Count) - static_cast<size_t>(m_Count) * sizeof(float);
+		const char zeros[simd::Alignment] = {};
+		m_Stream.seekp(m_Start + static_cast<int64_t>(sizeof(VectorFileHeader) + m_Count * sizeof(float)));
+		m_Stream.write(zeros, static_cast<std::streamsize>(padding));
+		m_Stream.seekp(m_Start + static_cast<int64_t>(GetFileSize(m_Layout, m_Count)));
+	}
+	m_Stream.flush();
+	return m_Written == m_Count && m_Stream.good();
+}
@@ -0,0 +1,165 @@
+#pragma once
+
+#include <Core/Math.h>
+#include <Core/Vector.h>
+
+#include <concepts>
+#include <type_traits>
+#include <utility>
+
+namespace math::detail
+{
+	/// \brief Calls function once with a std::integral_constant for each index in [0, Size) as
+	/// separate arguments, so that the components can be expanded with a fold-expression.
+	template<int32 Size, typename Function>
+	inline constexpr decltype(auto) Unroll(Function&& function) noexcept
+	{
+		return [&]<int32... Indices>(std::integer_sequence<int32, Indices...>) -> decltype(auto)
+		{
+			return function(std::integral_constant<int32, Indices>()...);
+		}(std::make_integer_sequence<int32, Size>());
+	}
+}
+
+/// \brief A geometric object of Size components of Type, where every operation is unrolled at compile time.
+/// Vector2f, Vector3f, Vector2d and Vector3d remain separate classes with named members, use the aliases
+/// Vector2i and Vector3i for integer grid coordinates rather than the template.
+/// Length and the operations that normalize are only available when Type is a floating point type.
+template<typename Type, int32 Size>
+class Vector
+{
+	static_assert(Size > 0, "A vector must have at least one component.");
+	static_assert(std::is_arithmetic_v<Type>, "A vector must have arithmetic components.");
+
+public:
+	/// \brief Construct a new vector with all members initialized to zero.
+	constexpr Vector() noexcept : values() {}
+	/// \brief Construct a new vector with all members initialized to value.
+	constexpr explicit Vector(const Type value) noexcept : Vector(value, std::make_integer_sequence<int32, Size>()) {}
+	/// \brief Construct a new vector with each member initialized to the matching value.
+	template<typename... Values> requires (sizeof...(Values) == Size && Size > 1 && (std::convertible_to<Values, Type> && ...))
+	constexpr explicit Vector(const Values... components) noexcept : values{ static_cast<Type>(components)... } {}
+	/// \brief Construct a new vector by converting each member of a vector with a different type.
+	template<typename Other> requires (!std::same_as<Other, Type>)
+	constexpr explicit Vector(const Vector<Other, Size>& value) noexcept
+		: Vector(math::detail::Unroll<Size>([&](auto... i) { return Vector(static_cast<Type>(value[i])...); })) {}
+	/// \brief Construct a new vector from the members of a Vector2f.
+	constexpr explicit Vector(const Vector2f& value) noexcept requires (Size == 2) : values{ static_cast<Type>(value.x), static_cast<Type>(value.y) } {}
+
+	/// \brief Returns a reference to the member at index.
+	constexpr Type& operator[](const int32 index) noexcept { return values[index]; }
+	/// \brief Returns the member at index.
+	constexpr Type operator[](const int32 index) const noexcept { return values[index]; }
+
+	/// \brief Returns true if all members are identical.
+	constexpr bool operator==(const Vector& rhs) const noexcept { return math::detail::Unroll<Size>([&](auto... i) { return ((values[i] == rhs.values[i]) && ...); }); }
+	/// \brief Returns true if any members aren't identical.
+	constexpr bool operator!=(const Vector& rhs) const noexcept { return !(*this == rhs); }
+
+	/// \brief Adds the two vectors component-wise and returns the result in a new vector.
+	constexpr Vector operator+(const Vector& rhs) const noexcept { return math::detail::Unroll<Size>([&](auto... i) { return Vector((values[i] + rhs.values[i])...); }); }
+	/// \brief Subtracts the two vectors component-wise and returns the result in a new vector.
+	constexpr Vector operator-(const Vector& rhs) const noexcept { return math::detail::Unroll<Size>([&](auto... i) { return Vector((values[i] - rhs.values[i])...); }); }
+
+	/// \brief Adds the two vectors component-wise, stores the result in this vector and returns a reference.
+	constexpr Vector& operator+=(const Vector& rhs) noexcept { return *this = *this + rhs; }
+	/// \brief Subtracts the two vectors component-wise, stores the result in this vector and returns a reference.
+	constexpr Vector& operator-=(const Vector& rhs) noexcept { return *this = *this - rhs; }
+
+	/// \brief Multiplies the vector by a value and returns the result in a new vector.
+	constexpr Vector operator*(const Type rhs) const noexcept { return math::detail::Unroll<Size>([&](auto... i) { return Vector((values[i] * rhs)...); }); }
+	/// \brief Divides the vector by a value and returns the result in a new vector.
+	constexpr Vector operator/(const Type rhs) const noexcept { return math::detail::Unroll<Size>([&](auto... i) { return Vector((values[i] / rhs)...); }); }
+
+	/// \brief Multiplies the vector by a value, stores the result in this vector and returns a reference.
+	constexpr Vector& operator*=(const Type rhs) noexcept { return *this = *this * rhs; }
+	/// \brief Divides the vector by a value, stores the result in this vector and returns a reference.
+	constexpr Vector& operator/=(const Type rhs) noexcept { return *this = *this / rhs; }
+
+	/// \brief Returns a new vector with non-negated members.
+	constexpr Vector operator+() const noexcept { return *this; }
+	/// \brief Returns a new vector with negated members.
+	constexpr Vector operator-() const noexcept { return math::detail::Unroll<Size>([&](auto... i) { return Vector((-values[i])...); }); }
+
+	/// \brief Returns the length of the vector.
+	constexpr Type Length() const noexcept requires std::floating_point<Type>;
+	/// \brief Returns the squared length of the vector.
+	constexpr Type LengthSqr() const noexcept;
+
+	/// \brief Reduce the vector length so that it doesn't exceed value.
+	/// If the length of the vector is 0 and value is less than it makes it a NaN vector.
+	constexpr void Limit(const Type value) noexcept requires std::floating_point<Type>;
+	/// \brief Normalize this vector have a length of 1 unit.
+	/// If the length of the vector is 0 then it makes it a zero vector.
+	constexpr void Normalize() noexcept requires std::floating_point<Type>;
+
+	/// \brief Returns a vector whose length doesn't exceed value.
+	/// If the length of the vector is 0 and value is less than it returns a NaN vector.
+	[[nodiscard]] constexpr Vector Limited(const Type value) const noexcept requires std::floating_point<Type>;
+	/// \brief Returns a normalized vector with a length of 1 unit.
+	/// If the length of the vector is 0 then it returns a zero vector.
+	[[nodiscard]] constexpr Vector Normalized() const noexcept requires std::floating_point<Type>;
+
+	/// \brief Converts this vector to a Vector2f.
+	constexpr Vector2f ToVector2f() const noexcept requires (Size == 2) { return Vector2f(static_cast<float>(values[0]), static_cast<float>(values[1])); }
+
+public:
+	Type values[Size];
+
+private:
+	template<int32... Indices>
+	constexpr explicit Vector(const Type value, std::integer_sequence<int32, Indices...>) noexcept : values{ ((void)Indices, value)... } {}
+};
+
+using Vector2i = Vector<int32, 2>;
+using Vector3i = Vector<int32, 3>;
+
+namespace math
+{
+	/// \brief Clamps each member of the vector between the matching members of min and max.
+	template<typename Type, int32 Size>
+	inline constexpr Vector<Type, Size> Clamp(const Vector<Type, Size>& value, const Vector<Type, Size>& min, const Vector<Type, Size>& max) noexcept;
+
+	/// \brief Returns the distance between two vectors.
+	template<typename Type, int32 Size> requires std::floating_point<Type>
+	inline constexpr Type Distance(const Vector<Type, Size>& a, const Vector<Type, Size>& b) noexcept;
+
+	/// \brief Returns the squared distance between two vectors.
+	template<typename Type, int32 Size>
+	inline constexpr Type DistanceSqr(const Vector<Type, Size>& a, const Vector<Type, Size>& b) noexcept;
+
+	/// \brief Divides the two vectors component-wise and returns the result in a new vector.
+	template<typename Type, int32 Size>
+	inline constexpr Vector<Type, Size> Divide(const Vector<Type, Size>& a, const Vector<Type, Size>& b) noexcept;
+
+	/// \brief Returns the dot product of two vectors.
+	template<typename Type, int32 Size>
+	inline constexpr Type Dot(const Vector<Type, Size>& a, const Vector<Type, Size>& b) noexcept;
+
+	/// \brief Returns the bigger member of the two vectors component-wise.
+	/// This is an overload rather than a specialization so it is selected without template arguments.
+	template<typename Type, int32 Size>
+	inline constexpr Vector<Type, Size> Max(const Vector<Type, Size>& a, const Vector<Type, Size>& b) noexcept;
+
+	/// \brief Returns the smaller member of the two vectors component-wise.
+	/// This is an overload rather than a specialization so it is selected without template arguments.
+	template<typename Type, int32 Size>
+	inline constexpr Vector<Type, Size> Min(const Vector<Type, Size>& a, const Vector<Type, Size>& b) noexcept;
+
+	/// \brief Multiplies the two vectors component-wise and returns the result in a new vector.
+	template<typename Type, int32 Size>
+	inline constexpr Vector<Type, Size> Multiply(const Vector<Type, Size>& a, const Vector<Type, Size>& b) noexcept;
+
+	/// \brief Rotates a vector 90 degrees (clockwise) to the original vector and returns the result in a new vector.
+	template<typename Type>
+	inline constexpr Vector<Type, 2> Perpendicular(const Vector<Type, 2>& vector) noexcept;
+
+	/// \brief Reflects a vector off the vector defined by a normal.
+	template<typename Type, int32 Size>
+	inline constexpr Vector<Type, Size> Reflect(const Vector<Type, Size>& vector, const Vector<Type, Size>& normal) noexcept;
+}
+
+#if defined(MATH_EXTERN_TEMPLATES)
+extern template class Vector<int32, 2>;
+extern template class Vector<int32, 3>;
+#endif
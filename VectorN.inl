@@ -0,0 +1,130 @@
+#pragma once
+
+#include <Core/Math.h>
+
+#include <cmath>
+
+template<typename Type, int32 Size>
+inline constexpr Type Vector<Type, Size>::Length() const noexcept requires std::floating_point<Type>
+{
+	if constexpr (std::same_as<Type, float>)
+	{
+		return math::Sqrt(LengthSqr());
+	}
+	else
+	{
+		if (std::is_constant_evaluated())
+			return static_cast<Type>(math::detail::Sqrt(static_cast<double>(LengthSqr())));
+		return std::sqrt(LengthSqr());
+	}
+}
+
+template<typename Type, int32 Size>
+inline constexpr Type Vector<Type, Size>::LengthSqr() const noexcept
+{
+	return math::Dot(*this, *this);
+}
+
+template<typename Type, int32 Size>
+inline constexpr void Vector<Type, Size>::Limit(const Type value) noexcept requires std::floating_point<Type>
+{
+	// assumes that value >= 0
+	const Type length = Length();
+	if (length > value)
+		*this *= (value / length);
+}
+
+template<typename Type, int32 Size>
+inline constexpr void Vector<Type, Size>::Normalize() noexcept requires std::floating_point<Type>
+{
+	constexpr Type epsilon = static_cast<Type>(0.0000001);
+	const Type length = Length();
+	if (length > epsilon)
+	{
+		*this *= static_cast<Type>(1) / length;
+	}
+	else
+	{
+		*this = Vector();
+	}
+}
+
+template<typename Type, int32 Size>
+inline constexpr Vector<Type, Size> Vector<Type, Size>::Limited(const Type value) const noexcept requires std::floating_point<Type>
+{
+	Vector result(*this);
+	result.Limit(value);
+	return result;
+}
+
+template<typename Type, int32 Size>
+inline constexpr Vector<Type, Size> Vector<Type, Size>::Normalized() const noexcept requires std::floating_point<Type>
+{
+	Vector result(*this);
+	result.Normalize();
+	return result;
+}
+
+template<typename Type, int32 Size>
+inline constexpr Vector<Type, Size> math::Clamp(const Vector<Type, Size>& value, const Vector<Type, Size>& min, const Vector<Type, Size>& max) noexcept
+{
+	return detail::Unroll<Size>([&](auto... i)
+	{
+		return Vector<Type, Size>(((value[i] < min[i]) ? min[i] : (value[i] > max[i]) ? max[i] : value[i])...);
+	});
+}
+
+template<typename Type, int32 Size> requires std::floating_point<Type>
+inline constexpr Type math::Distance(const Vector<Type, Size>& a, const Vector<Type, Size>& b) noexcept
+{
+	return (b - a).Length();
+}
+
+template<typename Type, int32 Size>
+inline constexpr Type math::DistanceSqr(const Vector<Type, Size>& a, const Vector<Type, Size>& b) noexcept
+{
+	return (b - a).LengthSqr();
+}
+
+template<typename Type, int32 Size>
+inline constexpr Vector<Type, Size> math::Divide(const Vector<Type, Size>& a, const Vector<Type, Size>& b) noexcept
+{
+	return detail::Unroll<Size>([&](auto... i) { return Vector<Type, Size>((a[i] / b[i])...); });
+}
+
+template<typename Type, int32 Size>
+inline constexpr Type math::Dot(const Vector<Type, Size>& a, const Vector<Type, Size>& b) noexcept
+{
+	return detail::Unroll<Size>([&](auto... i) { return static_cast<Type>(((a[i] * b[i]) + ...)); });
+}
+
+template<typename Type, int32 Size>
+inline constexpr Vector<Type, Size> math::Max(const Vector<Type, Size>& a, const Vector<Type, Size>& b) noexcept
+{
+	return detail::Unroll<Size>([&](auto... i) { return Vector<Type, Size>(((a[i] > b[i]) ? a[i] : b[i])...); });
+}
+
+template<typename Type, int32 Size>
+inline constexpr Vector<Type, Size> math::Min(const Vector<Type, Size>& a, const Vector<Type, Size>& b) noexcept
+{
+	return detail::Unroll<Size>([&](auto... i) { return Vector<Type, Size>(((a[i] < b[i]) ? a[i] : b[i])...); });
+}
+
+template<typename Type, int32 Size>
+inline constexpr Vector<Type, Size> math::Multiply(const Vector<Type, Size>& a, const Vector<Type, Size>& b) noexcept
+{
+	return detail::Unroll<Size>([&](auto... i) { return Vector<Type, Size>((a[i] * b[i])...); });
+}
+
+template<typename Type>
+inline constexpr Vector<Type, 2> math::Perpendicular(const Vector<Type, 2>& vector) noexcept
+{
+	return Vector<Type, 2>(vector[1], -vector[0]);
+}
+
+template<typename Type, int32 Size>
+inline constexpr Vector<Type, Size> math::Reflect(const Vector<Type, Size>& vector, const Vector<Type, Size>& normal) noexcept
+{
+	// -2 * (V dot N) * N + V
+	return normal * (static_cast<Type>(-2) * math::Dot(vector, normal)) + vector;
+}
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <Core/Math.h>
+#include <Core/Vector.h>
+
+#include <cstdint>
+#include <span>
+
+/// \brief Half precision vector that stores the bits of two fp16 floats, which halves the size of a Vector2f.
+/// Converting rounds to nearest even, values beyond 65504 become infinity and the precision is 11 bits.
+class Vector2h
+{
+public:
+	/// \brief Construct a new vector with both members initialized to zero.
+	constexpr Vector2h() noexcept : x(), y() {}
+	/// \brief Construct a new vector by converting each component of value to half precision.
+	inline explicit Vector2h(const Vector2f& value) noexcept;
+
+	/// \brief Returns true if both members have identical bits.
+	constexpr bool operator==(const Vector2h& rhs) const noexcept { return (x == rhs.x) && (y == rhs.y); }
+	/// \brief Returns true if either members don't have identical bits.
+	constexpr bool operator!=(const Vector2h& rhs) const noexcept { return (x != rhs.x) || (y != rhs.y); }
+
+	/// \brief Converts the vector back to full precision, which is exact.
+	inline Vector2f ToVector2f() const noexcept;
+
+public:
+	uint16_t x;
+	uint16_t y;
+};
+
+/// \brief Fixed point vector that stores each component as an int16 within a quantization range.
+/// The range is mapped to [-32767, 32767] so that zero is exact when the range is symmetric.
+class Vector2i16
+{
+public:
+	/// \brief Construct a new vector with both members initialized to zero.
+	constexpr Vector2i16() noexcept : x(), y() {}
+	/// \brief Construct a new vector with members initialized to values x and y.
+	constexpr explicit Vector2i16(const int16_t x, const int16_t y) noexcept : x(x), y(y) {}
+
+	/// \brief Returns true if both members are identical.
+	constexpr bool operator==(const Vector2i16& rhs) const noexcept { return (x == rhs.x) && (y == rhs.y); }
+	/// \brief Returns true if either members aren't identical.
+	constexpr bool operator!=(const Vector2i16& rhs) const noexcept { return (x != rhs.x) || (y != rhs.y); }
+
+public:
+	int16_t x;
+	int16_t y;
+};
+
+/// \brief Fixed point vector that stores each component as an int8, used for the directions in Direction.h.
+class Vector2i8
+{
+public:
+	/// \brief Construct a new vector with both members initialized to zero.
+	constexpr Vector2i8() noexcept : x(), y() {}
+	/// \brief Construct a new vector with members initialized to values x and y.
+	constexpr explicit Vector2i8(const int8_t x, const int8_t y) noexcept : x(x), y(y) {}
+
+	/// \brief Returns true if both members are identical.
+	constexpr bool operator==(const Vector2i8& rhs) const noexcept { return (x == rhs.x) && (y == rhs.y); }
+	/// \brief Returns true if either members aren't identical.
+	constexpr bool operator!=(const Vector2i8& rhs) const noexcept { return (x != rhs.x) || (y != rhs.y); }
+
+public:
+	int8_t x;
+	int8_t y;
+};
+
+/// \brief Conversions between full precision vectors and the packed vectors.
+/// The input and output spans of the batch versions must have the same size.
+namespace math
+{
+	/// \brief Converts each vector to half precision.
+	inline void Convert(std::span<const Vector2f> values, std::span<Vector2h> results) noexcept;
+	/// \brief Converts each half precision vector back to full precision.
+	inline void Convert(std::span<const Vector2h> values, std::span<Vector2f> results) noexcept;
+
+	/// \brief Clamps value component-wise between min and max and remaps it to the fixed point range,
+	/// rounding to the nearest step with ties going to even.
+	inline Vector2i16 Quantize(const Vector2f& value, const Vector2f& min, const Vector2f& max) noexcept;
+	/// \brief Quantizes each vector, the results match Quantize unless a fused multiply-add changes a rounding.
+	inline void Quantize(std::span<const Vector2f> values, const Vector2f& min, const Vector2f& max, std::span<Vector2i16> results) noexcept;
+
+	/// \brief Remaps the fixed point value back to the range between min and max.
+	/// The error is at most half of a step, which is (max - min) / 65534, plus a rounding error.
+	inline Vector2f Dequantize(const Vector2i16& value, const Vector2f& min, const Vector2f& max) noexcept;
+	/// \brief Dequantizes each vector, the results match Dequantize unless a fused multiply-add changes a rounding.
+	inline void Dequantize(std::span<const Vector2i16> values, const Vector2f& min, const Vector2f& max, std::span<Vector2f> results) noexcept;
+}
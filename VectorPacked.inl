@@ -0,0 +1,126 @@
+#pragma once
+
+#include <Core/Math.h>
+#include <Core/Simd.h>
+
+namespace math::detail
+{
+	constexpr float s_QuantizeSteps = 65534.f;
+	constexpr float s_QuantizeHalf = 32767.f;
+
+	// the per component constants repeat so that a register loaded at an even index lines up with x and y
+	// and the scalar tail can load them from an odd index, there are enough of them for one float8
+	struct QuantizeLanes
+	{
+		QuantizeLanes(const Vector2f& a, const Vector2f& b) noexcept
+		{
+			for (int32 i = 0; i < 8; i += 2)
+			{
+				x[i + 0] = a.x; x[i + 1] = a.y;
+				y[i + 0] = b.x; y[i + 1] = b.y;
+			}
+		}
+
+		float x[8];
+		float y[8];
+	};
+
+	// (clamp(value) - min) * scale - 32767 where scale = 65534 / (max - min)
+	template<typename Float>
+	inline Float Quantize(const Float value, const Float min, const Float max, const Float scale) noexcept
+	{
+		const Float clamped = simd::Min(simd::Max(value, min), max);
+		return simd::Round(simd::MulAdd(simd::Sub(clamped, min), scale, simd::Splat<Float>(-s_QuantizeHalf)));
+	}
+
+	// (value + 32767) * step + min where step = (max - min) / 65534
+	template<typename Float>
+	inline Float Dequantize(const Float value, const Float min, const Float step) noexcept
+	{
+		return simd::MulAdd(simd::Add(value, simd::Splat<Float>(s_QuantizeHalf)), step, min);
+	}
+}
+
+inline Vector2h::Vector2h(const Vector2f& value) noexcept
+	: x(simd::ToHalf(value.x))
+	, y(simd::ToHalf(value.y))
+{
+}
+
+inline Vector2f Vector2h::ToVector2f() const noexcept
+{
+	return Vector2f(simd::FromHalf(x), simd::FromHalf(y));
+}
+
+inline void math::Convert(std::span<const Vector2f> values, std::span<Vector2h> results) noexcept
+{
+	// the vectors are converted as one interleaved array of floats
+	const float* input = &values.data()->x;
+	uint16_t* output = &results.data()->x;
+	simd::ForEach(static_cast<int32>(values.size()) * 2, [&]<typename Float>(const int32 i)
+	{
+		simd::StoreHalf(output + i, simd::Load<Float>(input + i));
+	});
+}
+
+inline void math::Convert(std::span<const Vector2h> values, std::span<Vector2f> results) noexcept
+{
+	const uint16_t* input = &values.data()->x;
+	float* output = &results.data()->x;
+	simd::ForEach(static_cast<int32>(values.size()) * 2, [&]<typename Float>(const int32 i)
+	{
+		simd::Store(output + i, simd::LoadHalf<Float>(input + i));
+	});
+}
+
+inline Vector2i16 math::Quantize(const Vector2f& value, const Vector2f& min, const Vector2f& max) noexcept
+{
+	const Vector2f scale = math::Divide(Vector2f(detail::s_QuantizeSteps), max - min);
+	return Vector2i16(
+		static_cast<int16_t>(detail::Quantize(value.x, min.x, max.x, scale.x)),
+		static_cast<int16_t>(detail::Quantize(value.y, min.y, max.y, scale.y)));
+}
+
+inline void math::Quantize(std::span<const Vector2f> values, const Vector2f& min, const Vector2f& max, std::span<Vector2i16> results) noexcept
+{
+	const Vector2f scale = math::Divide(Vector2f(detail::s_QuantizeSteps), max - min);
+	const detail::QuantizeLanes bounds(min, max);
+	const detail::QuantizeLanes scales(scale, scale);
+
+	const float* input = &values.data()->x;
+	int16_t* output = &results.data()->x;
+	simd::ForEach(static_cast<int32>(values.size()) * 2, [&]<typename Float>(const int32 i)
+	{
+		const int32 lane = i & 1;
+		const Float value = detail::Quantize(simd::Load<Float>(input + i),
+			simd::Load<Float>(bounds.x + lane),
+			simd::Load<Float>(bounds.y + lane),
+			simd::Load<Float>(scales.x + lane));
+		simd::StoreInt16(output + i, value);
+	});
+}
+
+inline Vector2f math::Dequantize(const Vector2i16& value, const Vector2f& min, const Vector2f& max) noexcept
+{
+	const Vector2f step = (max - min) / detail::s_QuantizeSteps;
+	return Vector2f(
+		detail::Dequantize(static_cast<float>(value.x), min.x, step.x),
+		detail::Dequantize(static_cast<float>(value.y), min.y, step.y));
+}
+
+inline void math::Dequantize(std::span<const Vector2i16> values, const Vector2f& min, const Vector2f& max, std::span<Vector2f> results) noexcept
+{
+	const Vector2f step = (max - min) / detail::s_QuantizeSteps;
+	const detail::QuantizeLanes lanes(min, step);
+
+	const int16_t* input = &values.data()->x;
+	float* output = &results.data()->x;
+	simd::ForEach(static_cast<int32>(values.size()) * 2, [&]<typename Float>(const int32 i)
+	{
+		const int32 lane = i & 1;
+		const Float value = detail::Dequantize(simd::LoadInt16<Float>(input + i),
+			simd::Load<Float>(lanes.x + lane),
+			simd::Load<Float>(lanes.y + lane));
+		simd::Store(output + i, value);
+	});
+}
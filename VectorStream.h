@@ -0,0 +1,139 @@
+#pragma once
+
+#include <Core/Math.h>
+#include <Core/Vector.h>
+
+#include <span>
+
+template<typename Function>
+class Vector2fExpression;
+
+/// \brief A structure-of-arrays container of Vector2f that stores all x and all y members in
+/// separate aligned lanes so that operations over the whole container can be vectorized.
+class Vector2fStream
+{
+public:
+	/// \brief Construct an empty stream.
+	Vector2fStream() noexcept = default;
+	/// \brief Construct a stream of count zero vectors.
+	explicit Vector2fStream(const int32 count);
+	/// \brief Construct a stream that is a copy of the values.
+	explicit Vector2fStream(std::span<const Vector2f> values);
+	/// \brief Construct a stream that holds the result of an expression, see VectorExpression.h.
+	template<typename Function>
+	explicit Vector2fStream(const Vector2fExpression<Function>& expression);
+
+	Vector2fStream(const Vector2fStream& rhs);
+	Vector2fStream(Vector2fStream&& rhs) noexcept;
+	~Vector2fStream();
+
+	Vector2fStream& operator=(const Vector2fStream& rhs);
+	Vector2fStream& operator=(Vector2fStream&& rhs) noexcept;
+	/// \brief Replaces the contents of the stream with the result of an expression in a single pass.
+	template<typename Function>
+	Vector2fStream& operator=(const Vector2fExpression<Function>& expression);
+
+	/// \brief Returns the vector at index.
+	Vector2f operator[](const int32 index) const noexcept { return Vector2f(m_X[index], m_Y[index]); }
+
+	/// \brief Returns the number of vectors in the stream.
+	int32 GetCount() const noexcept { return m_Count; }
+	/// \brief Returns the number of vectors the stream can hold before it needs to reallocate.
+	int32 GetCapacity() const noexcept { return m_Capacity; }
+	/// \brief Returns true if the stream doesn't contain any vectors.
+	bool IsEmpty() const noexcept { return m_Count == 0; }
+
+	/// \brief Returns the lane that holds the x members, aligned to simd::Alignment.
+	float* GetX() noexcept { return m_X; }
+	const float* GetX() const noexcept { return m_X; }
+	/// \brief Returns the lane that holds the y members, aligned to simd::Alignment.
+	float* GetY() noexcept { return m_Y; }
+	const float* GetY() const noexcept { return m_Y; }
+
+	/// \brief Sets the vector at index.
+	void Set(const int32 index, const Vector2f& value) noexcept { m_X[index] = value.x; m_Y[index] = value.y; }
+
+	/// \brief Adds a vector to the end of the stream.
+	void Append(const Vector2f& value);
+	/// \brief Removes all vectors from the stream without releasing its memory.
+	void Clear() noexcept { m_Count = 0; }
+	/// \brief Makes sure the stream can hold at least capacity vectors without reallocating.
+	void Reserve(const int32 capacity);
+	/// \brief Changes the number of vectors in the stream, new vectors are initialized to zero.
+	void Resize(const int32 count);
+
+	/// \brief Replaces the contents of the stream with a copy of the values.
+	void Assign(std::span<const Vector2f> values);
+	/// \brief Copies the contents of the stream into values which must be the same size as the stream.
+	void CopyTo(std::span<Vector2f> values) const noexcept;
+
+	/// \brief Adds the streams component-wise and stores the result in this stream.
+	/// Both streams must have the same count.
+	Vector2fStream& operator+=(const Vector2fStream& rhs) noexcept;
+	/// \brief Subtracts the streams component-wise and stores the result in this stream.
+	/// Both streams must have the same count.
+	Vector2fStream& operator-=(const Vector2fStream& rhs) noexcept;
+
+	/// \brief Adds the result of an expression component-wise in a single pass.
+	template<typename Function>
+	Vector2fStream& operator+=(const Vector2fExpression<Function>& rhs) noexcept;
+	/// \brief Subtracts the result of an expression component-wise in a single pass.
+	template<typename Function>
+	Vector2fStream& operator-=(const Vector2fExpression<Function>& rhs) noexcept;
+
+	/// \brief Adds the vector to every vector in this stream.
+	Vector2fStream& operator+=(const Vector2f& rhs) noexcept;
+	/// \brief Subtracts the vector from every vector in this stream.
+	Vector2fStream& operator-=(const Vector2f& rhs) noexcept;
+
+	/// \brief Multiplies every vector in this stream by a value.
+	Vector2fStream& operator*=(const float rhs) noexcept;
+	/// \brief Divides every vector in this stream by a value.
+	Vector2fStream& operator/=(const float rhs) noexcept;
+
+	/// \brief Writes the length of each vector into values which must be the same size as the stream.
+	void Length(std::span<float> values) const noexcept;
+	/// \brief Writes the squared length of each vector into values which must be the same size as the stream.
+	void LengthSqr(std::span<float> values) const noexcept;
+
+	/// \brief Reduce the length of each vector so that it doesn't exceed value.
+	/// If the length of a vector is 0 and value is less than 0 then it makes it a NaN vector.
+	void Limit(const float value) noexcept;
+	/// \brief Normalize each vector to have a length of 1 unit.
+	/// If the length of a vector is 0 then it makes it a zero vector.
+	void Normalize() noexcept;
+	/// \brief Normalize each vector to have a length of 1 unit.
+	/// If the length of a vector is 0 then it makes it a NaN vector.
+	void NormalizeUnsafe() noexcept;
+
+	/// \brief Reduce the length of each vector so that it doesn't exceed value using simd::RSqrtFast.
+	/// The resulting lengths have a max relative error of 4e-7.
+	void LimitFast(const float value) noexcept;
+	/// \brief Normalize each vector to have a length of 1 unit using simd::RSqrtFast.
+	/// The resulting lengths have a max relative error of 4e-7, if the length of a vector is 0 then it makes it a zero vector.
+	void NormalizeFast() noexcept;
+
+private:
+	void Reallocate(const int32 capacity);
+
+private:
+	float* m_X = nullptr;
+	float* m_Y = nullptr;
+	int32 m_Count = 0;
+	int32 m_Capacity = 0;
+};
+
+namespace math
+{
+	/// \brief Writes the distance between each pair of vectors into values.
+	/// Both streams and the values must have the same count.
+	inline void Distance(const Vector2fStream& a, const Vector2fStream& b, std::span<float> values) noexcept;
+
+	/// \brief Writes the squared distance between each pair of vectors into values.
+	/// Both streams and the values must have the same count.
+	inline void DistanceSqr(const Vector2fStream& a, const Vector2fStream& b, std::span<float> values) noexcept;
+
+	/// \brief Writes the dot product of each pair of vectors into values.
+	/// Both streams and the values must have the same count.
+	inline void Dot(const Vector2fStream& a, const Vector2fStream& b, std::span<float> values) noexcept;
+}
@@ -0,0 +1,333 @@
+#pragma once
+
+#include <Core/Math.h>
+#include <Core/Simd.h>
+
+#include <algorithm>
+#include <new>
+
+inline Vector2fStream::Vector2fStream(const int32 count)
+{
+	Resize(count);
+}
+
+inline Vector2fStream::Vector2fStream(std::span<const Vector2f> values)
+{
+	Assign(values);
+}
+
+inline Vector2fStream::Vector2fStream(const Vector2fStream& rhs)
+{
+	*this = rhs;
+}
+
+inline Vector2fStream::Vector2fStream(Vector2fStream&& rhs) noexcept
+	: m_X(rhs.m_X)
+	, m_Y(rhs.m_Y)
+	, m_Count(rhs.m_Count)
+	, m_Capacity(rhs.m_Capacity)
+{
+	rhs.m_X = rhs.m_Y = nullptr;
+	rhs.m_Count = rhs.m_Capacity = 0;
+}
+
+inline Vector2fStream::~Vector2fStream()
+{
+	// both lanes share the same allocation which starts at x
+	::operator delete[](m_X, std::align_val_t(simd::Alignment));
+}
+
+inline Vector2fStream& Vector2fStream::operator=(const Vector2fStream& rhs)
+{
+	if (this != &rhs)
+	{
+		if (m_Capacity < rhs.m_Count)
+			Reallocate(rhs.m_Count);
+		std::copy_n(rhs.m_X, rhs.m_Count, m_X);
+		std::copy_n(rhs.m_Y, rhs.m_Count, m_Y);
+		m_Count = rhs.m_Count;
+	}
+	return *this;
+}
+
+inline Vector2fStream& Vector2fStream::operator=(Vector2fStream&& rhs) noexcept
+{
+	if (this != &rhs)
+	{
+		::operator delete[](m_X, std::align_val_t(simd::Alignment));
+		m_X = rhs.m_X;
+		m_Y = rhs.m_Y;
+		m_Count = rhs.m_Count;
+		m_Capacity = rhs.m_Capacity;
+		rhs.m_X = rhs.m_Y = nullptr;
+		rhs.m_Count = rhs.m_Capacity = 0;
+	}
+	return *this;
+}
+
+inline void Vector2fStream::Append(const Vector2f& value)
+{
+	if (m_Count == m_Capacity)
+		Reallocate(math::Max(m_Capacity * 2, 16));
+	m_X[m_Count] = value.x;
+	m_Y[m_Count] = value.y;
+	m_Count++;
+}
+
+inline void Vector2fStream::Reserve(const int32 capacity)
+{
+	if (m_Capacity < capacity)
+		Reallocate(capacity);
+}
+
+inline void Vector2fStream::Resize(const int32 count)
+{
+	Reserve(count);
+	if (m_Count < count)
+	{
+		std::fill(m_X + m_Count, m_X + count, 0.f);
+		std::fill(m_Y + m_Count, m_Y + count, 0.f);
+	}
+	m_Count = count;
+}
+
+inline void Vector2fStream::Assign(std::span<const Vector2f> values)
+{
+	const int32 count = static_cast<int32>(values.size());
+	Reserve(count);
+	for (int32 i = 0; i < count; ++i)
+	{
+		m_X[i] = values[i].x;
+		m_Y[i] = values[i].y;
+	}
+	m_Count = count;
+}
+
+inline void Vector2fStream::CopyTo(std::span<Vector2f> values) const noexcept
+{
+	for (int32 i = 0; i < m_Count; ++i)
+		values[i] = Vector2f(m_X[i], m_Y[i]);
+}
+
+inline Vector2fStream& Vector2fStream::operator+=(const Vector2fStream& rhs) noexcept
+{
+	float* x = m_X; float* y = m_Y;
+	const float* rx = rhs.m_X; const float* ry = rhs.m_Y;
+	simd::ForEach(m_Count, [&]<typename Float>(const int32 i)
+	{
+		simd::Store(x + i, simd::Add(simd::Load<Float>(x + i), simd::Load<Float>(rx + i)));
+		simd::Store(y + i, simd::Add(simd::Load<Float>(y + i), simd::Load<Float>(ry + i)));
+	});
+	return *this;
+}
+
+inline Vector2fStream& Vector2fStream::operator-=(const Vector2fStream& rhs) noexcept
+{
+	float* x = m_X; float* y = m_Y;
+	const float* rx = rhs.m_X; const float* ry = rhs.m_Y;
+	simd::ForEach(m_Count, [&]<typename Float>(const int32 i)
+	{
+		simd::Store(x + i, simd::Sub(simd::Load<Float>(x + i), simd::Load<Float>(rx + i)));
+		simd::Store(y + i, simd::Sub(simd::Load<Float>(y + i), simd::Load<Float>(ry + i)));
+	});
+	return *this;
+}
+
+inline Vector2fStream& Vector2fStream::operator+=(const Vector2f& rhs) noexcept
+{
+	float* x = m_X; float* y = m_Y;
+	simd::ForEach(m_Count, [&]<typename Float>(const int32 i)
+	{
+		simd::Store(x + i, simd::Add(simd::Load<Float>(x + i), simd::Splat<Float>(rhs.x)));
+		simd::Store(y + i, simd::Add(simd::Load<Float>(y + i), simd::Splat<Float>(rhs.y)));
+	});
+	return *this;
+}
+
+inline Vector2fStream& Vector2fStream::operator-=(const Vector2f& rhs) noexcept
+{
+	float* x = m_X; float* y = m_Y;
+	simd::ForEach(m_Count, [&]<typename Float>(const int32 i)
+	{
+		simd::Store(x + i, simd::Sub(simd::Load<Float>(x + i), simd::Splat<Float>(rhs.x)));
+		simd::Store(y + i, simd::Sub(simd::Load<Float>(y + i), simd::Splat<Float>(rhs.y)));
+	});
+	return *this;
+}
+
+inline Vector2fStream& Vector2fStream::operator*=(const float rhs) noexcept
+{
+	float* x = m_X; float* y = m_Y;
+	simd::ForEach(m_Count, [&]<typename Float>(const int32 i)
+	{
+		const Float value = simd::Splat<Float>(rhs);
+		simd::Store(x + i, simd::Mul(simd::Load<Float>(x + i), value));
+		simd::Store(y + i, simd::Mul(simd::Load<Float>(y + i), value));
+	});
+	return *this;
+}
+
+inline Vector2fStream& Vector2fStream::operator/=(const float rhs) noexcept
+{
+	float* x = m_X; float* y = m_Y;
+	simd::ForEach(m_Count, [&]<typename Float>(const int32 i)
+	{
+		const Float value = simd::Splat<Float>(rhs);
+		simd::Store(x + i, simd::Div(simd::Load<Float>(x + i), value));
+		simd::Store(y + i, simd::Div(simd::Load<Float>(y + i), value));
+	});
+	return *this;
+}
+
+inline void Vector2fStream::Length(std::span<float> values) const noexcept
+{
+	const float* x = m_X; const float* y = m_Y;
+	float* result = values.data();
+	simd::ForEach(m_Count, [&]<typename Float>(const int32 i)
+	{
+		const Float vx = simd::Load<Float>(x + i);
+		const Float vy = simd::Load<Float>(y + i);
+		simd::Store(result + i, simd::Sqrt(simd::MulAdd(vx, vx, simd::Mul(vy, vy))));
+	});
+}
+
+inline void Vector2fStream::LengthSqr(std::span<float> values) const noexcept
+{
+	const float* x = m_X; const float* y = m_Y;
+	float* result = values.data();
+	simd::ForEach(m_Count, [&]<typename Float>(const int32 i)
+	{
+		const Float vx = simd::Load<Float>(x + i);
+		const Float vy = simd::Load<Float>(y + i);
+		simd::Store(result + i, simd::MulAdd(vx, vx, simd::Mul(vy, vy)));
+	});
+}
+
+inline void Vector2fStream::Limit(const float value) noexcept
+{
+	// assumes that value >= 0.f
+	float* x = m_X; float* y = m_Y;
+	simd::ForEach(m_Count, [&]<typename Float>(const int32 i)
+	{
+		const Float vx = simd::Load<Float>(x + i);
+		const Float vy = simd::Load<Float>(y + i);
+		const Float limit = simd::Splat<Float>(value);
+		const Float length = simd::Sqrt(simd::MulAdd(vx, vx, simd::Mul(vy, vy)));
+		const Float scale = simd::Select(simd::CmpGt(length, limit), simd::Div(limit, length), simd::Splat<Float>(1.f));
+		simd::Store(x + i, simd::Mul(vx, scale));
+		simd::Store(y + i, simd::Mul(vy, scale));
+	});
+}
+
+inline void Vector2fStream::Normalize() noexcept
+{
+	float* x = m_X; float* y = m_Y;
+	simd::ForEach(m_Count, [&]<typename Float>(const int32 i)
+	{
+		constexpr float epsilon = 0.0000001f;
+		const Float vx = simd::Load<Float>(x + i);
+		const Float vy = simd::Load<Float>(y + i);
+		const Float length = simd::Sqrt(simd::MulAdd(vx, vx, simd::Mul(vy, vy)));
+		const Float scale = simd::Select(simd::CmpGt(length, simd::Splat<Float>(epsilon)), simd::Div(simd::Splat<Float>(1.f), length), simd::Splat<Float>(0.f));
+		simd::Store(x + i, simd::Mul(vx, scale));
+		simd::Store(y + i, simd::Mul(vy, scale));
+	});
+}
+
+inline void Vector2fStream::NormalizeUnsafe() noexcept
+{
+	float* x = m_X; float* y = m_Y;
+	simd::ForEach(m_Count, [&]<typename Float>(const int32 i)
+	{
+		const Float vx = simd::Load<Float>(x + i);
+		const Float vy = simd::Load<Float>(y + i);
+		const Float scale = simd::RSqrt(simd::MulAdd(vx, vx, simd::Mul(vy, vy)));
+		simd::Store(x + i, simd::Mul(vx, scale));
+		simd::Store(y + i, simd::Mul(vy, scale));
+	});
+}
+
+inline void Vector2fStream::LimitFast(const float value) noexcept
+{
+	// assumes that value >= 0.f
+	float* x = m_X; float* y = m_Y;
+	simd::ForEach(m_Count, [&]<typename Float>(const int32 i)
+	{
+		const Float vx = simd::Load<Float>(x + i);
+		const Float vy = simd::Load<Float>(y + i);
+		const Float limit = simd::Splat<Float>(value);
+		const Float lengthSqr = simd::MulAdd(vx, vx, simd::Mul(vy, vy));
+		const Float scale = simd::Select(simd::CmpGt(lengthSqr, simd::Mul(limit, limit)), simd::Mul(limit, simd::RSqrtFast(lengthSqr)), simd::Splat<Float>(1.f));
+		simd::Store(x + i, simd::Mul(vx, scale));
+		simd::Store(y + i, simd::Mul(vy, scale));
+	});
+}
+
+inline void Vector2fStream::NormalizeFast() noexcept
+{
+	float* x = m_X; float* y = m_Y;
+	simd::ForEach(m_Count, [&]<typename Float>(const int32 i)
+	{
+		constexpr float epsilon = 0.0000001f;
+		const Float vx = simd::Load<Float>(x + i);
+		const Float vy = simd::Load<Float>(y + i);
+		const Float lengthSqr = simd::MulAdd(vx, vx, simd::Mul(vy, vy));
+		const Float scale = simd::Select(simd::CmpGt(lengthSqr, simd::Splat<Float>(epsilon * epsilon)), simd::RSqrtFast(lengthSqr), simd::Splat<Float>(0.f));
+		simd::Store(x + i, simd::Mul(vx, scale));
+		simd::Store(y + i, simd::Mul(vy, scale));
+	});
+}
+
+inline void Vector2fStream::Reallocate(const int32 capacity)
+{
+	// round up so that the y lane starts on an aligned boundary
+	constexpr int32 block = simd::Alignment / sizeof(float);
+	const int32 rounded = (capacity + block - 1) / block * block;
+
+	float* memory = static_cast<float*>(::operator new[](sizeof(float) * rounded * 2, std::align_val_t(simd::Alignment)));
+	std::copy_n(m_X, m_Count, memory);
+	std::copy_n(m_Y, m_Count, memory + rounded);
+	::operator delete[](m_X, std::align_val_t(simd::Alignment));
+
+	m_X = memory;
+	m_Y = memory + rounded;
+	m_Capacity = rounded;
+}
+
+inline void math::Distance(const Vector2fStream& a, const Vector2fStream& b, std::span<float> values) noexcept
+{
+	const float* ax = a.GetX(); const float* ay = a.GetY();
+	const float* bx = b.GetX(); const float* by = b.GetY();
+	float* result = values.data();
+	simd::ForEach(a.GetCount(), [&]<typename Float>(const int32 i)
+	{
+		const Float dx = simd::Sub(simd::Load<Float>(bx + i), simd::Load<Float>(ax + i));
+		const Float dy = simd::Sub(simd::Load<Float>(by + i), simd::Load<Float>(ay + i));
+		simd::Store(result + i, simd::Sqrt(simd::MulAdd(dx, dx, simd::Mul(dy, dy))));
+	});
+}
+
+inline void math::DistanceSqr(const Vector2fStream& a, const Vector2fStream& b, std::span<float> values) noexcept
+{
+	const float* ax = a.GetX(); const float* ay = a.GetY();
+	const float* bx = b.GetX(); const float* by = b.GetY();
+	float* result = values.data();
+	simd::ForEach(a.GetCount(), [&]<typename Float>(const int32 i)
+	{
+		const Float dx = simd::Sub(simd::Load<Float>(bx + i), simd::Load<Float>(ax + i));
+		const Float dy = simd::Sub(simd::Load<Float>(by + i), simd::Load<Float>(ay + i));
+		simd::Store(result + i, simd::MulAdd(dx, dx, simd::Mul(dy, dy)));
+	});
+}
+
+inline void math::Dot(const Vector2fStream& a, const Vector2fStream& b, std::span<float> values) noexcept
+{
+	const float* ax = a.GetX(); const float* ay = a.GetY();
+	const float* bx = b.GetX(); const float* by = b.GetY();
+	float* result = values.data();
+	simd::ForEach(a.GetCount(), [&]<typename Float>(const int32 i)
+	{
+		const Float x = simd::Mul(simd::Load<Float>(ax + i), simd::Load<Float>(bx + i));
+		simd::Store(result + i, simd::MulAdd(simd::Load<Float>(ay + i), simd::Load<Float>(by + i), x));
+	});
+}
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <Core/Math.h>
+#include <Core/Simd.h>
+#include <Core/Vector.h>
+
+/// \brief A bundle of Width Vector2f that are held in registers with one register per member so that
+/// the same operations as Vector2f can be applied to all of them at once without branching.
+/// Use the aliases Vector2fx4 and Vector2fx8 rather than the template directly, Vector2fx<1> holds a single
+/// vector in floats so that batch kernels can process the tail of an array with the same code.
+template<int32 Width>
+class Vector2fx
+{
+public:
+	using Float = typename simd::Register<Width>::Type;
+
+	/// \brief Construct a new vector with uninitialized members.
+	Vector2fx() noexcept = default;
+	/// \brief Construct a new vector with all members initialized to value.
+	explicit Vector2fx(const float value) noexcept : x(simd::Splat<Float>(value)), y(simd::Splat<Float>(value)) {}
+	/// \brief Construct a new vector with all lanes initialized to value.
+	explicit Vector2fx(const Vector2f& value) noexcept : x(simd::Splat<Float>(value.x)), y(simd::Splat<Float>(value.y)) {}
+	/// \brief Construct a new vector with members initialized to registers x and y.
+	explicit Vector2fx(const Float x, const Float y) noexcept : x(x), y(y) {}
+
+	/// \brief Loads Width vectors from separate x and y lanes.
+	static Vector2fx Load(const float* x, const float* y) noexcept;
+	/// \brief Loads Width vectors from an array of Vector2f.
+	static Vector2fx Load(const Vector2f* values) noexcept;
+
+	/// \brief Stores the Width vectors into separate x and y lanes.
+	void Store(float* x, float* y) const noexcept;
+	/// \brief Stores the Width vectors into an array of Vector2f.
+	void Store(Vector2f* values) const noexcept;
+
+	/// \brief Adds the two vectors component-wise and returns the result in a new vector.
+	Vector2fx operator+(const Vector2fx& rhs) const noexcept { return Vector2fx(simd::Add(x, rhs.x), simd::Add(y, rhs.y)); }
+	/// \brief Subtracts the two vectors component-wise and returns the result in a new vector.
+	Vector2fx operator-(const Vector2fx& rhs) const noexcept { return Vector2fx(simd::Sub(x, rhs.x), simd::Sub(y, rhs.y)); }
+
+	/// \brief Adds the two vectors component-wise, stores the result in this vector and returns a reference.
+	Vector2fx& operator+=(const Vector2fx& rhs) noexcept { x = simd::Add(x, rhs.x); y = simd::Add(y, rhs.y); return *this; }
+	/// \brief Subtracts the two vectors component-wise, stores the result in this vector and returns a reference.
+	Vector2fx& operator-=(const Vector2fx& rhs) noexcept { x = simd::Sub(x, rhs.x); y = simd::Sub(y, rhs.y); return *this; }
+
+	/// \brief Multiplies the vector by a value and returns the result in a new vector.
+	Vector2fx operator*(const float rhs) const noexcept { return Vector2fx(simd::Mul(x, simd::Splat<Float>(rhs)), simd::Mul(y, simd::Splat<Float>(rhs))); }
+	/// \brief Multiplies each lane of the vector by the matching lane of rhs and returns the result in a new vector.
+	Vector2fx operator*(const Float rhs) const noexcept requires (Width > 1) { return Vector2fx(simd::Mul(x, rhs), simd::Mul(y, rhs)); }
+	/// \brief Divides the vector by a value and returns the result in a new vector.
+	Vector2fx operator/(const float rhs) const noexcept { return Vector2fx(simd::Div(x, simd::Splat<Float>(rhs)), simd::Div(y, simd::Splat<Float>(rhs))); }
+	/// \brief Divides each lane of the vector by the matching lane of rhs and returns the result in a new vector.
+	Vector2fx operator/(const Float rhs) const noexcept requires (Width > 1) { return Vector2fx(simd::Div(x, rhs), simd::Div(y, rhs)); }
+
+	/// \brief Multiplies the vector by a value, stores the result in this vector and returns a reference.
+	Vector2fx& operator*=(const float rhs) noexcept { return *this = *this * rhs; }
+	/// \brief Multiplies each lane of the vector by the matching lane of rhs, stores the result in this vector and returns a reference.
+	Vector2fx& operator*=(const Float rhs) noexcept requires (Width > 1) { return *this = *this * rhs; }
+	/// \brief Divides the vector by a value, stores the result in this vector and returns a reference.
+	Vector2fx& operator/=(const float rhs) noexcept { return *this = *this / rhs; }
+	/// \brief Divides each lane of the vector by the matching lane of rhs, stores the result in this vector and returns a reference.
+	Vector2fx& operator/=(const Float rhs) noexcept requires (Width > 1) { return *this = *this / rhs; }
+
+	/// \brief Returns a new vector with non-negated members.
+	Vector2fx operator+() const noexcept { return *this; }
+	/// \brief Returns a new vector with negated members.
+	Vector2fx operator-() const noexcept { return Vector2fx(simd::Neg(x), simd::Neg(y)); }
+
+	/// \brief Returns the length of each vector.
+	Float Length() const noexcept;
+	/// \brief Returns the squared length of each vector.
+	Float LengthSqr() const noexcept;
+
+	/// \brief Reduce the length of each vector so that it doesn't exceed value.
+	/// If the length of a vector is 0 and value is less than 0 then it makes it a NaN vector.
+	void Limit(const float value) noexcept;
+	/// \brief Normalize each vector to have a length of 1 unit.
+	/// If the length of a vector is 0 then it makes it a zero vector.
+	void Normalize() noexcept;
+	/// \brief Normalize each vector to have a length of 1 unit.
+	/// If the length of a vector is 0 then it makes it a NaN vector.
+	void NormalizeUnsafe() noexcept;
+
+	/// \brief Reduce the length of each vector so that it doesn't exceed value using simd::RSqrtFast.
+	/// The resulting lengths have a max relative error of 4e-7.
+	void LimitFast(const float value) noexcept;
+	/// \brief Normalize each vector to have a length of 1 unit using simd::RSqrtFast.
+	/// The resulting lengths have a max relative error of 4e-7, if the length of a vector is 0 then it makes it a zero vector.
+	void NormalizeFast() noexcept;
+
+	/// \brief Returns vectors whose length doesn't exceed value.
+	/// If the length of a vector is 0 and value is less than it returns a NaN vector.
+	[[nodiscard]] Vector2fx Limited(const float value) const noexcept;
+	/// \brief Returns normalized vectors with a length of 1 unit.
+	/// If the length of a vector is 0 then it returns a zero vector.
+	[[nodiscard]] Vector2fx Normalized() const noexcept;
+	/// \brief Returns normalized vectors with a length of 1 unit.
+	/// If the length of a vector is 0 then it returns a NaN vector.
+	[[nodiscard]] Vector2fx NormalizedUnsafe() const noexcept;
+
+	/// \brief Returns vectors whose length doesn't exceed value using simd::RSqrtFast.
+	/// The resulting lengths have a max relative error of 4e-7.
+	[[nodiscard]] Vector2fx LimitedFast(const float value) const noexcept;
+	/// \brief Returns normalized vectors with a length of 1 unit using simd::RSqrtFast.
+	/// The resulting lengths have a max relative error of 4e-7, if the length of a vector is 0 then it returns a zero vector.
+	[[nodiscard]] Vector2fx NormalizedFast() const noexcept;
+
+public:
+	Float x, y;
+};
+
+using Vector2fx4 = Vector2fx<4>;
+using Vector2fx8 = Vector2fx<8>;
+
+namespace math
+{
+	template<int32 Width>
+	inline Vector2fx<Width> Clamp(const Vector2fx<Width>& value, const Vector2fx<Width>& min, const Vector2fx<Width>& max) noexcept;
+
+	/// \brief Returns the distance between each pair of vectors.
+	template<int32 Width>
+	inline typename Vector2fx<Width>::Float Distance(const Vector2fx<Width>& a, const Vector2fx<Width>& b) noexcept;
+
+	/// \brief Returns the squared distance between each pair of vectors.
+	template<int32 Width>
+	inline typename Vector2fx<Width>::Float DistanceSqr(const Vector2fx<Width>& a, const Vector2fx<Width>& b) noexcept;
+
+	/// \brief Divides the two vectors component-wise and returns the result in a new vector.
+	template<int32 Width>
+	inline Vector2fx<Width> Divide(const Vector2fx<Width>& a, const Vector2fx<Width>& b) noexcept;
+
+	/// \brief Returns the dot product of each pair of vectors.
+	template<int32 Width>
+	inline typename Vector2fx<Width>::Float Dot(const Vector2fx<Width>& a, const Vector2fx<Width>& b) noexcept;
+
+	/// \brief Multiplies the two vectors component-wise and returns the result in a new vector.
+	template<int32 Width>
+	inline Vector2fx<Width> Multiply(const Vector2fx<Width>& a, const Vector2fx<Width>& b) noexcept;
+
+	/// \brief Rotates each vector 90 degrees (clockwise) to the original vector and returns the result in a new vector.
+	template<int32 Width>
+	inline Vector2fx<Width> Perpendicular(const Vector2fx<Width>& vector) noexcept;
+
+	/// \brief Reflects each vector off the vector defined by a normal.
+	template<int32 Width>
+	inline Vector2fx<Width> Reflect(const Vector2fx<Width>& vector, const Vector2fx<Width>& normal) noexcept;
+}
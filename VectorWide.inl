@@ -0,0 +1,200 @@
+#pragma once
+
+#include <Core/Math.h>
+#include <Core/Simd.h>
+
+template<int32 Width>
+inline Vector2fx<Width> Vector2fx<Width>::Load(const float* x, const float* y) noexcept
+{
+	return Vector2fx(simd::Load<Float>(x), simd::Load<Float>(y));
+}
+
+template<int32 Width>
+inline Vector2fx<Width> Vector2fx<Width>::Load(const Vector2f* values) noexcept
+{
+	Vector2fx result;
+	simd::Deinterleave(&values->x, result.x, result.y);
+	return result;
+}
+
+template<int32 Width>
+inline void Vector2fx<Width>::Store(float* x, float* y) const noexcept
+{
+	simd::Store(x, this->x);
+	simd::Store(y, this->y);
+}
+
+template<int32 Width>
+inline void Vector2fx<Width>::Store(Vector2f* values) const noexcept
+{
+	simd::Interleave(&values->x, x, y);
+}
+
+template<int32 Width>
+inline typename Vector2fx<Width>::Float Vector2fx<Width>::Length() const noexcept
+{
+	return simd::Sqrt(LengthSqr());
+}
+
+template<int32 Width>
+inline typename Vector2fx<Width>::Float Vector2fx<Width>::LengthSqr() const noexcept
+{
+	return simd::MulAdd(x, x, simd::Mul(y, y));
+}
+
+template<int32 Width>
+inline void Vector2fx<Width>::Limit(const float value) noexcept
+{
+	// assumes that value >= 0.f
+	const Float limit = simd::Splat<Float>(value);
+	const Float length = Length();
+	*this *= simd::Select(simd::CmpGt(length, limit), simd::Div(limit, length), simd::Splat<Float>(1.f));
+}
+
+template<int32 Width>
+inline void Vector2fx<Width>::Normalize() noexcept
+{
+	constexpr float epsilon = 0.0000001f;
+	const Float length = Length();
+	*this *= simd::Select(simd::CmpGt(length, simd::Splat<Float>(epsilon)), simd::Div(simd::Splat<Float>(1.f), length), simd::Splat<Float>(0.f));
+}
+
+template<int32 Width>
+inline void Vector2fx<Width>::NormalizeUnsafe() noexcept
+{
+	*this *= simd::RSqrt(LengthSqr());
+}
+
+template<int32 Width>
+inline void Vector2fx<Width>::LimitFast(const float value) noexcept
+{
+	// assumes that value >= 0.f
+	const Float limit = simd::Splat<Float>(value);
+	const Float lengthSqr = LengthSqr();
+	const Float scale = simd::Mul(limit, simd::RSqrtFast(lengthSqr));
+	*this *= simd::Select(simd::CmpGt(lengthSqr, simd::Mul(limit, limit)), scale, simd::Splat<Float>(1.f));
+}
+
+template<int32 Width>
+inline void Vector2fx<Width>::NormalizeFast() noexcept
+{
+	constexpr float epsilon = 0.0000001f;
+	const Float lengthSqr = LengthSqr();
+	*this *= simd::Select(simd::CmpGt(lengthSqr, simd::Splat<Float>(epsilon * epsilon)), simd::RSqrtFast(lengthSqr), simd::Splat<Float>(0.f));
+}
+
+template<int32 Width>
+inline Vector2fx<Width> Vector2fx<Width>::Limited(const float value) const noexcept
+{
+	Vector2fx result(*this);
+	result.Limit(value);
+	return result;
+}
+
+template<int32 Width>
+inline Vector2fx<Width> Vector2fx<Width>::Normalized() const noexcept
+{
+	Vector2fx result(*this);
+	result.Normalize();
+	return result;
+}
+
+template<int32 Width>
+inline Vector2fx<Width> Vector2fx<Width>::NormalizedUnsafe() const noexcept
+{
+	Vector2fx result(*this);
+	result.NormalizeUnsafe();
+	return result;
+}
+
+template<int32 Width>
+inline Vector2fx<Width> Vector2fx<Width>::LimitedFast(const float value) const noexcept
+{
+	Vector2fx result(*this);
+	result.LimitFast(value);
+	return result;
+}
+
+template<int32 Width>
+inline Vector2fx<Width> Vector2fx<Width>::NormalizedFast() const noexcept
+{
+	Vector2fx result(*this);
+	result.NormalizeFast();
+	return result;
+}
+
+template<int32 Width>
+inline Vector2fx<Width> math::Clamp(const Vector2fx<Width>& value, const Vector2fx<Width>& min, const Vector2fx<Width>& max) noexcept
+{
+	return Vector2fx<Width>(
+		simd::Min(simd::Max(value.x, min.x), max.x),
+		simd::Min(simd::Max(value.y, min.y), max.y));
+}
+
+template<int32 Width>
+inline typename Vector2fx<Width>::Float math::Distance(const Vector2fx<Width>& a, const Vector2fx<Width>& b) noexcept
+{
+	return (b - a).Length();
+}
+
+template<int32 Width>
+inline typename Vector2fx<Width>::Float math::DistanceSqr(const Vector2fx<Width>& a, const Vector2fx<Width>& b) noexcept
+{
+	return (b - a).LengthSqr();
+}
+
+template<int32 Width>
+inline Vector2fx<Width> math::Divide(const Vector2fx<Width>& a, const Vector2fx<Width>& b) noexcept
+{
+	return Vector2fx<Width>(simd::Div(a.x, b.x), simd::Div(a.y, b.y));
+}
+
+template<int32 Width>
+inline typename Vector2fx<Width>::Float math::Dot(const Vector2fx<Width>& a, const Vector2fx<Width>& b) noexcept
+{
+	return simd::MulAdd(a.x, b.x, simd::Mul(a.y, b.y));
+}
+
+template<>
+inline Vector2fx4 math::Max<Vector2fx4>(const Vector2fx4& a, const Vector2fx4& b) noexcept
+{
+	return Vector2fx4(simd::Max(a.x, b.x), simd::Max(a.y, b.y));
+}
+
+template<>
+inline Vector2fx8 math::Max<Vector2fx8>(const Vector2fx8& a, const Vector2fx8& b) noexcept
+{
+	return Vector2fx8(simd::Max(a.x, b.x), simd::Max(a.y, b.y));
+}
+
+template<>
+inline Vector2fx4 math::Min<Vector2fx4>(const Vector2fx4& a, const Vector2fx4& b) noexcept
+{
+	return Vector2fx4(simd::Min(a.x, b.x), simd::Min(a.y, b.y));
+}
+
+template<>
+inline Vector2fx8 math::Min<Vector2fx8>(const Vector2fx8& a, const Vector2fx8& b) noexcept
+{
+	return Vector2fx8(simd::Min(a.x, b.x), simd::Min(a.y, b.y));
+}
+
+template<int32 Width>
+inline Vector2fx<Width> math::Multiply(const Vector2fx<Width>& a, const Vector2fx<Width>& b) noexcept
+{
+	return Vector2fx<Width>(simd::Mul(a.x, b.x), simd::Mul(a.y, b.y));
+}
+
+template<int32 Width>
+inline Vector2fx<Width> math::Perpendicular(const Vector2fx<Width>& vector) noexcept
+{
+	return Vector2fx<Width>(vector.y, simd::Neg(vector.x));
+}
+
+template<int32 Width>
+inline Vector2fx<Width> math::Reflect(const Vector2fx<Width>& vector, const Vector2fx<Width>& normal) noexcept
+{
+	// -2 * (V dot N) * N + V
+	const auto dot2 = simd::Mul(simd::Splat<typename Vector2fx<Width>::Float>(-2.0f), math::Dot(vector, normal));
+	return normal * dot2 + vector;
+}
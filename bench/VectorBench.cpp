@@ -0,0 +1,732 @@
+#include <Core/Math.h>
+#include <Core/Simd.h>
+#include <Core/Trigonometry.h>
+#include <Core/Vector.h>
+#include <Core/VectorStream.h>
+#include <Core/VectorWide.h>
+#include <Core/VectorBatch.h>
+#include <Core/Dispatch.h>
+
+#include <Core/Math.inl>
+#include <Core/Trigonometry.inl>
+#include <Core/Vector.inl>
+#include <Core/VectorStream.inl>
+#include <Core/VectorWide.inl>
+#include <Core/VectorBatch.inl>
+#include <Core/Dispatch.inl>
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <vector>
+
+// Measures the Math.h and Vector.inl operations one element at a time (scalar), over a span with the kernels
+// that the translation unit is compiled for (span), over a span with the kernels that are selected for the
+// cpu at runtime (dispatch), over a Vector2fStream (stream) and in registers of 4 and 8 vectors with
+// Vector2fx (wide). Each one runs at a size that fits in L1, in L2 and that only fits in DRAM.
+//
+// The results report the time per element as ns_per_op and the throughput as items_per_second.
+//
+// Not every function has every form, only the forms that exist in the library are measured. Min, Max, Clamp,
+// Lerp, Sign, Sqr, ToDegrees and ToRadians for a single float are left out because each one compiles to one or
+// two instructions that the loop around them would dominate, their Vector2f versions are measured instead.
+// Vector3f only has the scalar form so only its non-trivial operations are measured.
+
+namespace
+{
+	constexpr int32 s_SizeL1 = 1 << 10;
+	constexpr int32 s_SizeL2 = 1 << 15;
+	constexpr int32 s_SizeDRAM = 1 << 22;
+
+	struct Data
+	{
+		explicit Data(const int32 count)
+			: floats(count), integers(count), vectors(count), others(count), results(count), vectors3(count)
+		{
+			// a fixed linear congruential sequence so that each run measures the same values
+			uint32_t state = 12345;
+			const auto next = [&]()
+			{
+				state = state * 1664525u + 1013904223u;
+				return static_cast<float>(state >> 8) / 16777216.f;
+			};
+			for (int32 i = 0; i < count; ++i)
+			{
+				floats[i] = next() * 1000.f + 0.001f;
+				vectors[i] = Vector2f(next() * 20.f - 10.f, next() * 20.f - 10.f);
+				others[i] = Vector2f(next() * 20.f - 10.f, next() * 20.f - 10.f);
+				vectors3[i] = Vector3f(next() * 20.f - 10.f, next() * 20.f - 10.f, next() * 20.f - 10.f);
+			}
+			stream.Assign(vectors);
+			otherStream.Assign(others);
+		}
+
+		std::vector<float> floats;
+		std::vector<int32> integers;
+		std::vector<Vector2f> vectors;
+		std::vector<Vector2f> others;
+		std::vector<Vector2f> results;
+		std::vector<Vector3f> vectors3;
+		Vector2fStream stream;
+		Vector2fStream otherStream;
+	};
+
+	template<typename Function>
+	void Run(benchmark::State& state, Function&& function)
+	{
+		const int32 count = static_cast<int32>(state.range(0));
+		Data data(count);
+		for (auto _ : state)
+		{
+			function(data, count);
+			benchmark::ClobberMemory();
+		}
+
+		const double elements = static_cast<double>(state.iterations()) * count;
+		state.SetItemsProcessed(static_cast<int64_t>(elements));
+		state.counters["ns_per_op"] = benchmark::Counter(elements * 1e-9, benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+	}
+
+	void Sizes(benchmark::internal::Benchmark* benchmark)
+	{
+		benchmark->Arg(s_SizeL1)->Arg(s_SizeL2)->Arg(s_SizeDRAM);
+	}
+
+	// the sizes are multiples of 8 so the wide loops don't need a tail
+	template<int32 Width, typename Function>
+	void RunWide(benchmark::State& state, Function&& function)
+	{
+		Run(state, [&](Data& data, const int32 count)
+		{
+			for (int32 i = 0; i < count; i += Width)
+			{
+				const Vector2fx<Width> value = Vector2fx<Width>::Load(&data.vectors[i]);
+				const Vector2fx<Width> other = Vector2fx<Width>::Load(&data.others[i]);
+				function(value, other).Store(&data.results[i]);
+			}
+		});
+	}
+
+	template<int32 Width, typename Function>
+	void RunWideFloat(benchmark::State& state, Function&& function)
+	{
+		Run(state, [&](Data& data, const int32 count)
+		{
+			for (int32 i = 0; i < count; i += Width)
+			{
+				const Vector2fx<Width> value = Vector2fx<Width>::Load(&data.vectors[i]);
+				const Vector2fx<Width> other = Vector2fx<Width>::Load(&data.others[i]);
+				simd::Store(&data.floats[i], function(value, other));
+			}
+		});
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Math.h
+
+static void Sqrt_Scalar(benchmark::State& state)
+{
+	Run(state, [](Data& data, const int32 count)
+	{
+		for (int32 i = 0; i < count; ++i)
+			data.floats[i] = math::Sqrt(data.floats[i]) + 0.5f;
+	});
+}
+BENCHMARK(Sqrt_Scalar)->Apply(Sizes);
+
+static void RSqrtFast_Scalar(benchmark::State& state)
+{
+	Run(state, [](Data& data, const int32 count)
+	{
+		for (int32 i = 0; i < count; ++i)
+			data.floats[i] = math::RSqrtFast(data.floats[i]) + 0.5f;
+	});
+}
+BENCHMARK(RSqrtFast_Scalar)->Apply(Sizes);
+
+static void FloorToInt_Scalar(benchmark::State& state)
+{
+	Run(state, [](Data& data, const int32 count)
+	{
+		for (int32 i = 0; i < count; ++i)
+			data.integers[i] = math::FloorToInt(data.floats[i]);
+	});
+}
+BENCHMARK(FloorToInt_Scalar)->Apply(Sizes);
+
+static void FloorToInt_Span(benchmark::State& state)
+{
+	Run(state, [](Data& data, const int32)
+	{
+		math::FloorToInt(data.floats, data.integers);
+	});
+}
+BENCHMARK(FloorToInt_Span)->Apply(Sizes);
+
+static void RoundToInt_Scalar(benchmark::State& state)
+{
+	Run(state, [](Data& data, const int32 count)
+	{
+		for (int32 i = 0; i < count; ++i)
+			data.integers[i] = math::RoundToInt(data.floats[i]);
+	});
+}
+BENCHMARK(RoundToInt_Scalar)->Apply(Sizes);
+
+static void RoundToInt_Span(benchmark::State& state)
+{
+	Run(state, [](Data& data, const int32)
+	{
+		math::RoundToInt(data.floats, data.integers);
+	});
+}
+BENCHMARK(RoundToInt_Span)->Apply(Sizes);
+
+static void Floor_Scalar(benchmark::State& state)
+{
+	Run(state, [](Data& data, const int32 count)
+	{
+		for (int32 i = 0; i < count; ++i)
+			data.floats[i] = math::Floor(data.floats[i] + 0.5f);
+	});
+}
+BENCHMARK(Floor_Scalar)->Apply(Sizes);
+
+static void Ceiling_Scalar(benchmark::State& state)
+{
+	Run(state, [](Data& data, const int32 count)
+	{
+		for (int32 i = 0; i < count; ++i)
+			data.floats[i] = math::Ceiling(data.floats[i] - 0.5f);
+	});
+}
+BENCHMARK(Ceiling_Scalar)->Apply(Sizes);
+
+static void Round_Scalar(benchmark::State& state)
+{
+	Run(state, [](Data& data, const int32 count)
+	{
+		for (int32 i = 0; i < count; ++i)
+			data.floats[i] = math::Round(data.floats[i] + 0.25f);
+	});
+}
+BENCHMARK(Round_Scalar)->Apply(Sizes);
+
+static void CeilingToInt_Scalar(benchmark::State& state)
+{
+	Run(state, [](Data& data, const int32 count)
+	{
+		for (int32 i = 0; i < count; ++i)
+			data.integers[i] = math::CeilingToInt(data.floats[i]);
+	});
+}
+BENCHMARK(CeilingToInt_Scalar)->Apply(Sizes);
+
+static void CeilingToInt_Span(benchmark::State& state)
+{
+	Run(state, [](Data& data, const int32)
+	{
+		math::CeilingToInt(data.floats, data.integers);
+	});
+}
+BENCHMARK(CeilingToInt_Span)->Apply(Sizes);
+
+static void Sin_Scalar(benchmark::State& state)
+{
+	Run(state, [](Data& data, const int32 count)
+	{
+		for (int32 i = 0; i < count; ++i)
+			data.results[i].x = math::Sin(data.floats[i]);
+	});
+}
+BENCHMARK(Sin_Scalar)->Apply(Sizes);
+
+static void Cos_Scalar(benchmark::State& state)
+{
+	Run(state, [](Data& data, const int32 count)
+	{
+		for (int32 i = 0; i < count; ++i)
+			data.results[i].y = math::Cos(data.floats[i]);
+	});
+}
+BENCHMARK(Cos_Scalar)->Apply(Sizes);
+
+template<math::Precision Level>
+static void SinCos_Span(benchmark::State& state)
+{
+	Run(state, [](Data& data, const int32)
+	{
+		math::SinCos<Level>(data.floats, data.results);
+	});
+}
+BENCHMARK(SinCos_Span<math::Precision::Low>)->Apply(Sizes);
+BENCHMARK(SinCos_Span<math::Precision::Medium>)->Apply(Sizes);
+BENCHMARK(SinCos_Span<math::Precision::Full>)->Apply(Sizes);
+
+static void Atan2_Scalar(benchmark::State& state)
+{
+	Run(state, [](Data& data, const int32 count)
+	{
+		for (int32 i = 0; i < count; ++i)
+			data.floats[i] = math::Atan2(data.vectors[i].y, data.vectors[i].x);
+	});
+}
+BENCHMARK(Atan2_Scalar)->Apply(Sizes);
+
+//////////////////////////////////////////////////////////////////////////
+// Vector.inl
+
+static void Length_Scalar(benchmark::State& state)
+{
+	Run(state, [](Data& data, const int32 count)
+	{
+		for (int32 i = 0; i < count; ++i)
+			data.floats[i] = data.vectors[i].Length();
+	});
+}
+BENCHMARK(Length_Scalar)->Apply(Sizes);
+
+static void NormalizeFast_Scalar(benchmark::State& state)
+{
+	Run(state, [](Data& data, const int32 count)
+	{
+		for (int32 i = 0; i < count; ++i)
+			data.results[i] = data.vectors[i].NormalizedFast();
+	});
+}
+BENCHMARK(NormalizeFast_Scalar)->Apply(Sizes);
+
+static void Clamp_Scalar(benchmark::State& state)
+{
+	const Vector2f min(-5.f), max(5.f);
+	Run(state, [&](Data& data, const int32 count)
+	{
+		for (int32 i = 0; i < count; ++i)
+			data.results[i] = math::Clamp(data.vectors[i], min, max);
+	});
+}
+BENCHMARK(Clamp_Scalar)->Apply(Sizes);
+
+static void Clamp_Span(benchmark::State& state)
+{
+	const Vector2f min(-5.f), max(5.f);
+	Run(state, [&](Data& data, const int32)
+	{
+		math::Clamp(data.vectors, min, max, data.results);
+	});
+}
+BENCHMARK(Clamp_Span)->Apply(Sizes);
+
+static void Clamp_Dispatch(benchmark::State& state)
+{
+	const Vector2f min(-5.f), max(5.f);
+	Run(state, [&](Data& data, const int32)
+	{
+		dispatch::Clamp(data.vectors, min, max, data.results);
+	});
+}
+BENCHMARK(Clamp_Dispatch)->Apply(Sizes);
+
+static void Lerp_Scalar(benchmark::State& state)
+{
+	Run(state, [](Data& data, const int32 count)
+	{
+		for (int32 i = 0; i < count; ++i)
+			data.results[i] = math::Lerp(data.vectors[i], data.others[i], 0.25f);
+	});
+}
+BENCHMARK(Lerp_Scalar)->Apply(Sizes);
+
+static void Lerp_Span(benchmark::State& state)
+{
+	Run(state, [](Data& data, const int32)
+	{
+		math::Lerp(data.vectors, data.others, 0.25f, data.results);
+	});
+}
+BENCHMARK(Lerp_Span)->Apply(Sizes);
+
+static void Lerp_Dispatch(benchmark::State& state)
+{
+	Run(state, [](Data& data, const int32)
+	{
+		dispatch::Lerp(data.vectors, data.others, 0.25f, data.results);
+	});
+}
+BENCHMARK(Lerp_Dispatch)->Apply(Sizes);
+
+static void Limit_Scalar(benchmark::State& state)
+{
+	Run(state, [](Data& data, const int32 count)
+	{
+		for (int32 i = 0; i < count; ++i)
+			data.results[i] = data.vectors[i].Limited(5.f);
+	});
+}
+BENCHMARK(Limit_Scalar)->Apply(Sizes);
+
+static void Limit_Span(benchmark::State& state)
+{
+	Run(state, [](Data& data, const int32)
+	{
+		math::Limit(data.vectors, 5.f, data.results);
+	});
+}
+BENCHMARK(Limit_Span)->Apply(Sizes);
+
+static void Limit_Dispatch(benchmark::State& state)
+{
+	Run(state, [](Data& data, const int32)
+	{
+		dispatch::Limit(data.vectors, 5.f, data.results);
+	});
+}
+BENCHMARK(Limit_Dispatch)->Apply(Sizes);
+
+static void Normalize_Scalar(benchmark::State& state)
+{
+	Run(state, [](Data& data, const int32 count)
+	{
+		for (int32 i = 0; i < count; ++i)
+			data.results[i] = data.vectors[i].Normalized();
+	});
+}
+BENCHMARK(Normalize_Scalar)->Apply(Sizes);
+
+static void Normalize_Span(benchmark::State& state)
+{
+	Run(state, [](Data& data, const int32)
+	{
+		math::Normalize(data.vectors, data.results);
+	});
+}
+BENCHMARK(Normalize_Span)->Apply(Sizes);
+
+static void Normalize_Dispatch(benchmark::State& state)
+{
+	Run(state, [](Data& data, const int32)
+	{
+		dispatch::Normalize(data.vectors, data.results);
+	});
+}
+BENCHMARK(Normalize_Dispatch)->Apply(Sizes);
+
+static void Remap_Scalar(benchmark::State& state)
+{
+	const Vector2f fromA(-10.f), fromB(10.f), toA(0.f), toB(1.f);
+	Run(state, [&](Data& data, const int32 count)
+	{
+		for (int32 i = 0; i < count; ++i)
+		{
+			const Vector2f& value = data.vectors[i];
+			data.results[i] = Vector2f(
+				math::Remap(value.x, fromA.x, fromB.x, toA.x, toB.x),
+				math::Remap(value.y, fromA.y, fromB.y, toA.y, toB.y));
+		}
+	});
+}
+BENCHMARK(Remap_Scalar)->Apply(Sizes);
+
+static void Remap_Span(benchmark::State& state)
+{
+	const Vector2f fromA(-10.f), fromB(10.f), toA(0.f), toB(1.f);
+	Run(state, [&](Data& data, const int32)
+	{
+		math::Remap(data.vectors, fromA, fromB, toA, toB, data.results);
+	});
+}
+BENCHMARK(Remap_Span)->Apply(Sizes);
+
+static void Remap_Dispatch(benchmark::State& state)
+{
+	const Vector2f fromA(-10.f), fromB(10.f), toA(0.f), toB(1.f);
+	Run(state, [&](Data& data, const int32)
+	{
+		dispatch::Remap(data.vectors, fromA, fromB, toA, toB, data.results);
+	});
+}
+BENCHMARK(Remap_Dispatch)->Apply(Sizes);
+
+static void Dot_Scalar(benchmark::State& state)
+{
+	Run(state, [](Data& data, const int32 count)
+	{
+		for (int32 i = 0; i < count; ++i)
+			data.floats[i] = math::Dot(data.vectors[i], data.others[i]);
+	});
+}
+BENCHMARK(Dot_Scalar)->Apply(Sizes);
+
+static void Dot_Stream(benchmark::State& state)
+{
+	Run(state, [](Data& data, const int32)
+	{
+		math::Dot(data.stream, data.otherStream, data.floats);
+	});
+}
+BENCHMARK(Dot_Stream)->Apply(Sizes);
+
+template<int32 Width>
+static void Dot_Wide(benchmark::State& state)
+{
+	RunWideFloat<Width>(state, [](const Vector2fx<Width>& a, const Vector2fx<Width>& b) { return math::Dot(a, b); });
+}
+BENCHMARK(Dot_Wide<4>)->Apply(Sizes);
+BENCHMARK(Dot_Wide<8>)->Apply(Sizes);
+
+static void Distance_Scalar(benchmark::State& state)
+{
+	Run(state, [](Data& data, const int32 count)
+	{
+		for (int32 i = 0; i < count; ++i)
+			data.floats[i] = math::Distance(data.vectors[i], data.others[i]);
+	});
+}
+BENCHMARK(Distance_Scalar)->Apply(Sizes);
+
+static void Distance_Stream(benchmark::State& state)
+{
+	Run(state, [](Data& data, const int32)
+	{
+		math::Distance(data.stream, data.otherStream, data.floats);
+	});
+}
+BENCHMARK(Distance_Stream)->Apply(Sizes);
+
+template<int32 Width>
+static void Distance_Wide(benchmark::State& state)
+{
+	RunWideFloat<Width>(state, [](const Vector2fx<Width>& a, const Vector2fx<Width>& b) { return math::Distance(a, b); });
+}
+BENCHMARK(Distance_Wide<4>)->Apply(Sizes);
+BENCHMARK(Distance_Wide<8>)->Apply(Sizes);
+
+static void DistanceSqr_Scalar(benchmark::State& state)
+{
+	Run(state, [](Data& data, const int32 count)
+	{
+		for (int32 i = 0; i < count; ++i)
+			data.floats[i] = math::DistanceSqr(data.vectors[i], data.others[i]);
+	});
+}
+BENCHMARK(DistanceSqr_Scalar)->Apply(Sizes);
+
+static void DistanceSqr_Stream(benchmark::State& state)
+{
+	Run(state, [](Data& data, const int32)
+	{
+		math::DistanceSqr(data.stream, data.otherStream, data.floats);
+	});
+}
+BENCHMARK(DistanceSqr_Stream)->Apply(Sizes);
+
+template<int32 Width>
+static void DistanceSqr_Wide(benchmark::State& state)
+{
+	RunWideFloat<Width>(state, [](const Vector2fx<Width>& a, const Vector2fx<Width>& b) { return math::DistanceSqr(a, b); });
+}
+BENCHMARK(DistanceSqr_Wide<4>)->Apply(Sizes);
+BENCHMARK(DistanceSqr_Wide<8>)->Apply(Sizes);
+
+static void Perpendicular_Scalar(benchmark::State& state)
+{
+	Run(state, [](Data& data, const int32 count)
+	{
+		for (int32 i = 0; i < count; ++i)
+			data.results[i] = math::Perpendicular(data.vectors[i]);
+	});
+}
+BENCHMARK(Perpendicular_Scalar)->Apply(Sizes);
+
+template<int32 Width>
+static void Perpendicular_Wide(benchmark::State& state)
+{
+	RunWide<Width>(state, [](const Vector2fx<Width>& a, const Vector2fx<Width>&) { return math::Perpendicular(a); });
+}
+BENCHMARK(Perpendicular_Wide<4>)->Apply(Sizes);
+BENCHMARK(Perpendicular_Wide<8>)->Apply(Sizes);
+
+static void Reflect_Scalar(benchmark::State& state)
+{
+	const Vector2f normal = Vector2f(1.f, 2.f).Normalized();
+	Run(state, [&](Data& data, const int32 count)
+	{
+		for (int32 i = 0; i < count; ++i)
+			data.results[i] = math::Reflect(data.vectors[i], normal);
+	});
+}
+BENCHMARK(Reflect_Scalar)->Apply(Sizes);
+
+template<int32 Width>
+static void Reflect_Wide(benchmark::State& state)
+{
+	const Vector2fx<Width> normal(Vector2f(1.f, 2.f).Normalized());
+	RunWide<Width>(state, [&](const Vector2fx<Width>& a, const Vector2fx<Width>&) { return math::Reflect(a, normal); });
+}
+BENCHMARK(Reflect_Wide<4>)->Apply(Sizes);
+BENCHMARK(Reflect_Wide<8>)->Apply(Sizes);
+
+static void Normalize_Stream(benchmark::State& state)
+{
+	Run(state, [](Data& data, const int32)
+	{
+		data.stream.Normalize();
+	});
+}
+BENCHMARK(Normalize_Stream)->Apply(Sizes);
+
+template<int32 Width>
+static void Normalize_Wide(benchmark::State& state)
+{
+	RunWide<Width>(state, [](const Vector2fx<Width>& a, const Vector2fx<Width>&) { return a.Normalized(); });
+}
+BENCHMARK(Normalize_Wide<4>)->Apply(Sizes);
+BENCHMARK(Normalize_Wide<8>)->Apply(Sizes);
+
+static void NormalizeUnsafe_Scalar(benchmark::State& state)
+{
+	Run(state, [](Data& data, const int32 count)
+	{
+		for (int32 i = 0; i < count; ++i)
+			data.results[i] = data.vectors[i].NormalizedUnsafe();
+	});
+}
+BENCHMARK(NormalizeUnsafe_Scalar)->Apply(Sizes);
+
+static void NormalizeUnsafe_Stream(benchmark::State& state)
+{
+	Run(state, [](Data& data, const int32)
+	{
+		data.stream.NormalizeUnsafe();
+	});
+}
+BENCHMARK(NormalizeUnsafe_Stream)->Apply(Sizes);
+
+template<int32 Width>
+static void NormalizeUnsafe_Wide(benchmark::State& state)
+{
+	RunWide<Width>(state, [](const Vector2fx<Width>& a, const Vector2fx<Width>&) { return a.NormalizedUnsafe(); });
+}
+BENCHMARK(NormalizeUnsafe_Wide<4>)->Apply(Sizes);
+BENCHMARK(NormalizeUnsafe_Wide<8>)->Apply(Sizes);
+
+static void NormalizeFast_Stream(benchmark::State& state)
+{
+	Run(state, [](Data& data, const int32)
+	{
+		data.stream.NormalizeFast();
+	});
+}
+BENCHMARK(NormalizeFast_Stream)->Apply(Sizes);
+
+template<int32 Width>
+static void NormalizeFast_Wide(benchmark::State& state)
+{
+	RunWide<Width>(state, [](const Vector2fx<Width>& a, const Vector2fx<Width>&) { return a.NormalizedFast(); });
+}
+BENCHMARK(NormalizeFast_Wide<4>)->Apply(Sizes);
+BENCHMARK(NormalizeFast_Wide<8>)->Apply(Sizes);
+
+// the in place stream versions limit the vectors on the first iteration, the branchless kernels run the
+// same instructions either way so the later iterations still measure the same work
+static void Limit_Stream(benchmark::State& state)
+{
+	Run(state, [](Data& data, const int32)
+	{
+		data.stream.Limit(5.f);
+	});
+}
+BENCHMARK(Limit_Stream)->Apply(Sizes);
+
+template<int32 Width>
+static void Limit_Wide(benchmark::State& state)
+{
+	RunWide<Width>(state, [](const Vector2fx<Width>& a, const Vector2fx<Width>&) { return a.Limited(5.f); });
+}
+BENCHMARK(Limit_Wide<4>)->Apply(Sizes);
+BENCHMARK(Limit_Wide<8>)->Apply(Sizes);
+
+static void LimitFast_Scalar(benchmark::State& state)
+{
+	Run(state, [](Data& data, const int32 count)
+	{
+		for (int32 i = 0; i < count; ++i)
+			data.results[i] = data.vectors[i].LimitedFast(5.f);
+	});
+}
+BENCHMARK(LimitFast_Scalar)->Apply(Sizes);
+
+static void LimitFast_Stream(benchmark::State& state)
+{
+	Run(state, [](Data& data, const int32)
+	{
+		data.stream.LimitFast(5.f);
+	});
+}
+BENCHMARK(LimitFast_Stream)->Apply(Sizes);
+
+template<int32 Width>
+static void LimitFast_Wide(benchmark::State& state)
+{
+	RunWide<Width>(state, [](const Vector2fx<Width>& a, const Vector2fx<Width>&) { return a.LimitedFast(5.f); });
+}
+BENCHMARK(LimitFast_Wide<4>)->Apply(Sizes);
+BENCHMARK(LimitFast_Wide<8>)->Apply(Sizes);
+
+static void Length_Stream(benchmark::State& state)
+{
+	Run(state, [](Data& data, const int32)
+	{
+		data.stream.Length(data.floats);
+	});
+}
+BENCHMARK(Length_Stream)->Apply(Sizes);
+
+//////////////////////////////////////////////////////////////////////////
+// Vector3f
+
+static void Vector3f_Normalize_Scalar(benchmark::State& state)
+{
+	Run(state, [](Data& data, const int32 count)
+	{
+		for (int32 i = 0; i < count; ++i)
+			data.vectors3[i] = data.vectors3[i].Normalized() * 2.f;
+	});
+}
+BENCHMARK(Vector3f_Normalize_Scalar)->Apply(Sizes);
+
+static void Vector3f_Cross_Scalar(benchmark::State& state)
+{
+	const Vector3f axis = Vector3f(1.f, 2.f, 3.f).Normalized();
+	Run(state, [&](Data& data, const int32 count)
+	{
+		for (int32 i = 0; i < count; ++i)
+			data.vectors3[i] = math::Cross(data.vectors3[i], axis);
+	});
+}
+BENCHMARK(Vector3f_Cross_Scalar)->Apply(Sizes);
+
+static void Vector3f_Distance_Scalar(benchmark::State& state)
+{
+	const Vector3f point(1.f, 2.f, 3.f);
+	Run(state, [&](Data& data, const int32 count)
+	{
+		for (int32 i = 0; i < count; ++i)
+			data.floats[i] = math::Distance(data.vectors3[i], point);
+	});
+}
+BENCHMARK(Vector3f_Distance_Scalar)->Apply(Sizes);
+
+static void Vector3f_Reflect_Scalar(benchmark::State& state)
+{
+	const Vector3f normal = Vector3f(1.f, 2.f, 3.f).Normalized();
+	Run(state, [&](Data& data, const int32 count)
+	{
+		for (int32 i = 0; i < count; ++i)
+			data.vectors3[i] = math::Reflect(data.vectors3[i], normal);
+	});
+}
+BENCHMARK(Vector3f_Reflect_Scalar)->Apply(Sizes);
+
+BENCHMARK_MAIN();
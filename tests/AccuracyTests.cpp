@@ -0,0 +1,339 @@
+#include <Core/Math.h>
+#include <Core/Direction.h>
+#include <Core/Random.h>
+#include <Core/Trigonometry.h>
+#include <Core/Vector.h>
+#include <Core/VectorPacked.h>
+
+#include <Core/Math.inl>
+#include <Core/Direction.inl>
+#include <Core/Random.inl>
+#include <Core/Trigonometry.inl>
+#include <Core/Vector.inl>
+#include <Core/VectorPacked.inl>
+
+#include "TestHelpers.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+// Sweeps the fast paths against the exact functions that they replace and checks the error budgets that
+// their docs promise. The sweeps cover every float in the binades around KINDA_SMALL_FLOAT, 1 and KINDA_LARGE_FLOAT
+// and a stride through every other binade, the max errors are recorded as properties of each test.
+
+namespace
+{
+	constexpr double s_Degrees = 180.0 / 3.14159265358979323846;
+
+	// the binades that are swept densely, each range covers two binades so that both parities of the exponent are seen
+	const float s_DenseRanges[][2] =
+	{
+		{ KINDA_SMALL_FLOAT, KINDA_SMALL_FLOAT * 4.f },
+		{ 1.f, 4.f },
+		{ KINDA_LARGE_FLOAT, KINDA_LARGE_FLOAT * 4.f },
+	};
+
+	// the smallest member of a vector whose square doesn't underflow
+	constexpr float s_MinMember = 1e-18f;
+
+	// calls function with the floats of the dense ranges and a stride through the positive floats from min to max
+	template<typename Function>
+	void SweepPositive(const float min, const float max, Function&& function)
+	{
+		for (const auto& range : s_DenseRanges)
+		{
+			if (range[1] <= max)
+				test::Sweep(range[0], range[1], 1, function);
+		}
+		test::Sweep(min, max, 4099, function);
+	}
+}
+
+TEST(Accuracy, RSqrtFast)
+{
+	// Math.h documents a max relative error of 4e-7, which is at most 7 floats apart from 1 / math::Sqrt
+	double maxError = 0.0;
+	int64_t maxUlp = 0;
+	SweepPositive(std::numeric_limits<float>::min(), std::numeric_limits<float>::max(), [&](const float value)
+	{
+		const float result = math::RSqrtFast(value);
+		const double expected = 1.0 / std::sqrt(static_cast<double>(value));
+		maxError = std::max(maxError, std::abs(result - expected) / expected);
+		maxUlp = std::max(maxUlp, test::UlpDistance(result, 1.f / math::Sqrt(value)));
+	});
+
+	RecordProperty("max_relative_error", test::ToString(maxError));
+	RecordProperty("max_ulp", test::ToString(maxUlp));
+	EXPECT_LE(maxError, 4e-7);
+	EXPECT_LE(maxUlp, 7);
+}
+
+TEST(Accuracy, Length)
+{
+	// the squares and their sum are rounded before the square root so the length can be 1 float off
+	int64_t maxUlp = 0;
+	SweepPositive(s_MinMember, KINDA_LARGE_FLOAT * 4.f, [&](const float value)
+	{
+		for (const float ratio : { 0.f, 0.3f, 1.f, 7.5f })
+		{
+			const Vector2f vector(value, value * ratio);
+			const double expected = std::hypot(static_cast<double>(vector.x), static_cast<double>(vector.y));
+			maxUlp = std::max(maxUlp, test::UlpDistance(vector.Length(), static_cast<float>(expected)));
+		}
+	});
+
+	RecordProperty("max_ulp", test::ToString(maxUlp));
+	EXPECT_LE(maxUlp, 1);
+}
+
+TEST(Accuracy, NormalizeFast)
+{
+	// Vector.h documents a max relative error of 4e-7 in the length of the result, vectors that aren't longer
+	// than KINDA_SMALL_FLOAT are made into zero vectors so the sweep starts there
+	double maxError = 0.0;
+	int64_t maxUlp = 0;
+	int32 zeroErrors = 0;
+	SweepPositive(KINDA_SMALL_FLOAT, KINDA_LARGE_FLOAT * 4.f, [&](const float value)
+	{
+		for (const float ratio : { -0.f, 0.3f, -1.f, 7.5f })
+		{
+			const Vector2f vector(value, value * ratio);
+			const Vector2f result = vector.NormalizedFast();
+			if (vector.LengthSqr() <= KINDA_SMALL_FLOAT * KINDA_SMALL_FLOAT)
+			{
+				zeroErrors += (result != Vector2f::Zero) ? 1 : 0;
+				continue;
+			}
+
+			const double length = std::hypot(static_cast<double>(result.x), static_cast<double>(result.y));
+			maxError = std::max(maxError, std::abs(length - 1.0));
+
+			const Vector2f expected = vector.Normalized();
+			maxUlp = std::max(maxUlp, std::max(test::UlpDistance(result.x, expected.x), test::UlpDistance(result.y, expected.y)));
+		}
+	});
+
+	RecordProperty("max_relative_error", test::ToString(maxError));
+	RecordProperty("max_ulp", test::ToString(maxUlp));
+	EXPECT_LE(maxError, 4e-7);
+	EXPECT_LE(maxUlp, 8);
+	EXPECT_EQ(zeroErrors, 0);
+	EXPECT_EQ(Vector2f::Zero.NormalizedFast(), Vector2f::Zero);
+	EXPECT_EQ(Vector2f(KINDA_SMALL_FLOAT * 0.5f, 0.f).NormalizedFast(), Vector2f::Zero);
+}
+
+TEST(Accuracy, LimitFast)
+{
+	// Vector.h documents a max relative error of 4e-7 in the length of the result
+	double maxError = 0.0;
+	SweepPositive(KINDA_SMALL_FLOAT, KINDA_LARGE_FLOAT * 4.f, [&](const float value)
+	{
+		for (const float limit : { KINDA_SMALL_FLOAT, 1.f, 1000.f })
+		{
+			const Vector2f vector(value, value * -0.6f);
+			const Vector2f result = vector.LimitedFast(limit);
+			const double length = std::hypot(static_cast<double>(result.x), static_cast<double>(result.y));
+			const double expected = std::min(static_cast<double>(limit), std::hypot(static_cast<double>(vector.x), static_cast<double>(vector.y)));
+			maxError = std::max(maxError, std::abs(length - expected) / expected);
+		}
+	});
+
+	RecordProperty("max_relative_error", test::ToString(maxError));
+	EXPECT_LE(maxError, 4e-7);
+}
+
+template<math::Precision Level>
+static void TestSinCos(const double budget)
+{
+	// Trigonometry.h documents the max absolute error of each precision in the range [-8192, 8192]
+	std::vector<float> radians;
+	test::Sweep(KINDA_SMALL_FLOAT, 8192.f, 61, [&](const float value)
+	{
+		radians.push_back(value);
+		radians.push_back(-value);
+	});
+	test::Sweep(1.f, 4.f, 1, [&](const float value) { radians.push_back(value); });
+	radians.push_back(0.f);
+
+	std::vector<Vector2f> results(radians.size());
+	math::SinCos<Level>(radians, results);
+
+	double maxError = 0.0;
+	int32 mismatches = 0;
+	for (size_t i = 0; i < radians.size(); ++i)
+	{
+		const double radian = radians[i];
+		maxError = std::max(maxError, std::abs(results[i].x - std::cos(radian)));
+		maxError = std::max(maxError, std::abs(results[i].y - std::sin(radian)));
+
+		// the span and single versions only differ when a fused multiply-add changes a rounding
+		const Vector2f single = math::SinCos<Level>(radians[i]);
+		mismatches += (test::UlpDistance(single.x, results[i].x) > 1 || test::UlpDistance(single.y, results[i].y) > 1) ? 1 : 0;
+	}
+
+	::testing::Test::RecordProperty("max_absolute_error", test::ToString(maxError));
+	EXPECT_LE(maxError, budget);
+	EXPECT_EQ(mismatches, 0);
+}
+
+TEST(Accuracy, SinCosLow)
+{
+	TestSinCos<math::Precision::Low>(1.3e-5);
+}
+
+TEST(Accuracy, SinCosMedium)
+{
+	TestSinCos<math::Precision::Medium>(1.2e-7);
+}
+
+TEST(Accuracy, SinCosFull)
+{
+	TestSinCos<math::Precision::Full>(9e-8);
+}
+
+TEST(Accuracy, IntegerConversions)
+{
+	// the conversions must be exact for every float that fits in an int32, [2^22, 2^24] is swept densely as
+	// that is where the floats stop having fractions and the halves are the last fractions that can be seen
+	std::vector<float> values;
+	const auto append = [&](const float value)
+	{
+		values.push_back(value);
+		values.push_back(-value);
+	};
+	for (const auto& range : s_DenseRanges)
+		test::Sweep(range[0], range[1], 1, append);
+	test::Sweep(4194304.f, 16777216.f, 1, append);
+	test::Sweep(std::numeric_limits<float>::denorm_min(), 2147483520.f, 4099, append);
+	values.push_back(0.f);
+
+	std::vector<int32> floors(values.size()), ceilings(values.size()), rounds(values.size());
+	math::FloorToInt(values, floors);
+	math::CeilingToInt(values, ceilings);
+	math::RoundToInt(values, rounds);
+
+	int32 floorErrors = 0, ceilingErrors = 0, roundErrors = 0;
+	for (size_t i = 0; i < values.size(); ++i)
+	{
+		const float value = values[i];
+		const int32 floor = math::Floor<int32>(value);
+		const int32 ceiling = math::Ceiling<int32>(value);
+		const int32 round = static_cast<int32>(std::nearbyint(value));
+		floorErrors += (math::FloorToInt(value) != floor || floors[i] != floor) ? 1 : 0;
+		ceilingErrors += (math::CeilingToInt(value) != ceiling || ceilings[i] != ceiling) ? 1 : 0;
+		roundErrors += (math::RoundToInt(value) != round || rounds[i] != round) ? 1 : 0;
+
+		// math::Round only differs on the ties, which it rounds away from zero
+		const bool isTie = value - std::trunc(value) == 0.5f || value - std::trunc(value) == -0.5f;
+		roundErrors += (!isTie && round != math::Round<int32>(value)) ? 1 : 0;
+	}
+
+	EXPECT_EQ(floorErrors, 0);
+	EXPECT_EQ(ceilingErrors, 0);
+	EXPECT_EQ(roundErrors, 0);
+	EXPECT_EQ(math::RoundToInt(2.5f), 2);
+	EXPECT_EQ(math::RoundToInt(-3.5f), -4);
+}
+
+TEST(Accuracy, Direction2d)
+{
+	// Direction.h documents a max error of 0.71 degrees for uint8_t and 0.0028 degrees for uint16_t
+	double maxError8 = 0.0, maxError16 = 0.0;
+	constexpr int32 count = 1 << 20;
+	for (int32 i = 0; i < count; ++i)
+	{
+		const double angle = 2.0 * 3.14159265358979323846 * (i + 0.5) / count;
+		const Vector2f direction(static_cast<float>(std::cos(angle)), static_cast<float>(std::sin(angle)));
+		const auto error = [&](const Vector2f& decoded)
+		{
+			const double cross = static_cast<double>(decoded.x) * direction.y - static_cast<double>(decoded.y) * direction.x;
+			const double dot = static_cast<double>(decoded.x) * direction.x + static_cast<double>(decoded.y) * direction.y;
+			return std::atan2(std::abs(cross), dot) * s_Degrees;
+		};
+		maxError8 = std::max(maxError8, error(math::DecodeDirection(math::EncodeDirection<uint8_t>(direction))));
+		maxError16 = std::max(maxError16, error(math::DecodeDirection(math::EncodeDirection<uint16_t>(direction))));
+	}
+
+	RecordProperty("max_degrees_uint8", test::ToString(maxError8));
+	RecordProperty("max_degrees_uint16", test::ToString(maxError16));
+	EXPECT_LE(maxError8, 0.71);
+	EXPECT_LE(maxError16, 0.0028);
+}
+
+TEST(Accuracy, DirectionOctahedral)
+{
+	// Direction.h documents a max error of 0.96 degrees for Vector2i8 and 0.0038 degrees for Vector2i16,
+	// the directions are spread evenly over the sphere with a fibonacci spiral
+	double maxError8 = 0.0, maxError16 = 0.0;
+	constexpr int32 count = 1 << 22;
+	for (int32 i = 0; i < count; ++i)
+	{
+		const double z = 1.0 - 2.0 * (i + 0.5) / count;
+		const double radius = std::sqrt(1.0 - z * z);
+		const double angle = i * 2.399963229728653;
+		const Vector3f direction(static_cast<float>(radius * std::cos(angle)), static_cast<float>(radius * std::sin(angle)), static_cast<float>(z));
+		const auto error = [&](const Vector3f& decoded)
+		{
+			const double crossX = static_cast<double>(decoded.y) * direction.z - static_cast<double>(decoded.z) * direction.y;
+			const double crossY = static_cast<double>(decoded.z) * direction.x - static_cast<double>(decoded.x) * direction.z;
+			const double crossZ = static_cast<double>(decoded.x) * direction.y - static_cast<double>(decoded.y) * direction.x;
+			const double dot = static_cast<double>(decoded.x) * direction.x + static_cast<double>(decoded.y) * direction.y + static_cast<double>(decoded.z) * direction.z;
+			return std::atan2(std::sqrt(crossX * crossX + crossY * crossY + crossZ * crossZ), dot) * s_Degrees;
+		};
+		maxError8 = std::max(maxError8, error(math::DecodeDirection(math::EncodeDirection<Vector2i8>(direction))));
+		maxError16 = std::max(maxError16, error(math::DecodeDirection(math::EncodeDirection<Vector2i16>(direction))));
+	}
+
+	RecordProperty("max_degrees_vector2i8", test::ToString(maxError8));
+	RecordProperty("max_degrees_vector2i16", test::ToString(maxError16));
+	EXPECT_LE(maxError8, 0.96);
+	EXPECT_LE(maxError16, 0.0038);
+}
+
+TEST(Accuracy, RandomReplay)
+{
+	// Random.h documents that the vectors of a seed are the same on every instruction set and that the batch
+	// versions match the single versions, so the bits are hashed and compared to a hash of an SSE2 build
+	uint32_t hash = 2166136261u;
+	const auto mix = [&](const float value)
+	{
+		uint32_t bits;
+		std::memcpy(&bits, &value, sizeof(bits));
+		hash = (hash ^ bits) * 16777619u;
+	};
+
+	constexpr int32 count = 999;
+	Random batch(77), single(77);
+	std::vector<Vector2f> directions(count), points(count);
+	std::vector<float> numbers(count);
+	math::RandomUnitVector2f(batch, directions);
+	math::RandomInDisc(batch, Vector2f(3.f, -4.f), 7.f, points);
+	math::RandomInRange(batch, -3.f, 9.f, numbers);
+
+	int32 mismatches = 0;
+	for (const Vector2f& direction : directions)
+	{
+		mismatches += (math::RandomUnitVector2f(single) != direction);
+		mix(direction.x);
+		mix(direction.y);
+	}
+	for (const Vector2f& point : points)
+	{
+		mismatches += (math::RandomInDisc(single, Vector2f(3.f, -4.f), 7.f) != point);
+		mix(point.x);
+		mix(point.y);
+	}
+	for (const float number : numbers)
+	{
+		mismatches += (math::RandomInRange(single, -3.f, 9.f) != number);
+		mix(number);
+	}
+
+	RecordProperty("hash", std::to_string(hash));
+	EXPECT_EQ(mismatches, 0);
+	EXPECT_EQ(hash, 0x0216f3e7u);
+}
@@ -0,0 +1,273 @@
+#include <Core/Math.h>
+#include <Core/Trigonometry.h>
+#include <Core/Vector.h>
+
+#include <Core/Math.inl>
+#include <Core/Trigonometry.inl>
+#include <Core/Vector.inl>
+
+#include "TestHelpers.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+// Times the fast paths against the exact functions that they replace and fails if a fast path falls below its
+// minimum speedup. The minimums are about half of the speedups measured when they were added so that noise from
+// other processes doesn't fail them, they catch the fast paths losing their instructions rather than small changes.
+// The timings are only meaningful in an optimized build so the tests are skipped when assertions are enabled.
+//
+// RSqrtFast, NormalizeFast and LimitFast measured about the same speed as the square root and divide that
+// they replace on a cpu with a fast divider, so their minimums only catch them becoming much slower.
+
+namespace
+{
+#if defined(__SSE4_1__) || defined(__AVX__) || defined(__aarch64__) || defined(_M_ARM64)
+	// math::Floor, Ceiling and Round compile to a single rounding instruction so the conversions can't be much faster
+	constexpr double s_ConversionSpeedup = 0.6;
+#else
+	// math::Floor, Ceiling and Round call into libm while the conversions are a few inline instructions
+	constexpr double s_ConversionSpeedup = 1.5;
+#endif
+
+	constexpr int32 s_Count = 1 << 14;
+	constexpr int32 s_Repeats = 64;
+
+	struct Data
+	{
+		Data()
+			: floats(s_Count), integers(s_Count), vectors(s_Count), results(s_Count)
+		{
+			uint32_t state = 12345;
+			const auto next = [&]()
+			{
+				state = state * 1664525u + 1013904223u;
+				return static_cast<float>(state >> 8) / 16777216.f;
+			};
+			for (int32 i = 0; i < s_Count; ++i)
+			{
+				floats[i] = next() * 2000.f - 1000.f;
+				vectors[i] = Vector2f(next() * 20.f - 10.f, next() * 20.f - 10.f);
+			}
+		}
+
+		std::vector<float> floats;
+		std::vector<int32> integers;
+		std::vector<Vector2f> vectors;
+		std::vector<Vector2f> results;
+	};
+
+	// the results are read through a volatile so that the loops can't be removed
+	template<typename Type>
+	void Consume(const std::vector<Type>& values)
+	{
+		volatile Type sink = values[values.size() / 2];
+		(void)sink;
+	}
+
+	template<typename Fast, typename Exact>
+	void ExpectSpeedup(const double minimum, Fast&& fast, Exact&& exact)
+	{
+#if !defined(NDEBUG)
+		GTEST_SKIP() << "the speedups are only measured in optimized builds";
+#endif
+		const auto repeat = [](auto& function)
+		{
+			return test::Time([&]()
+			{
+				for (int32 i = 0; i < s_Repeats; ++i)
+					function();
+			}, 1);
+		};
+
+		// the two are timed in turns so that a change in the clock speed or the load affects both of them
+		double exactTime = std::numeric_limits<double>::max();
+		double fastTime = std::numeric_limits<double>::max();
+		for (int32 i = 0; i < 7; ++i)
+		{
+			exactTime = std::min(exactTime, repeat(exact));
+			fastTime = std::min(fastTime, repeat(fast));
+		}
+
+		const double speedup = exactTime / fastTime;
+		::testing::Test::RecordProperty("speedup", test::ToString(speedup));
+		std::cout << "speedup " << speedup << " (minimum " << minimum << ")\n";
+		EXPECT_GE(speedup, minimum);
+	}
+}
+
+TEST(Speedup, RSqrtFast)
+{
+	// each result feeds the next so that this measures the latency, which is what an update of a single vector waits on
+	Data data;
+	ExpectSpeedup(0.5,
+		[&]()
+		{
+			float value = 2.f;
+			for (int32 i = 0; i < s_Count; ++i)
+				value = math::RSqrtFast(value + data.vectors[i].x * data.vectors[i].x);
+			data.floats[0] = value;
+			Consume(data.floats);
+		},
+		[&]()
+		{
+			float value = 2.f;
+			for (int32 i = 0; i < s_Count; ++i)
+				value = 1.f / math::Sqrt(value + data.vectors[i].x * data.vectors[i].x);
+			data.floats[0] = value;
+			Consume(data.floats);
+		});
+}
+
+TEST(Speedup, NormalizeFast)
+{
+	Data data;
+	ExpectSpeedup(0.5,
+		[&]()
+		{
+			for (int32 i = 0; i < s_Count; ++i)
+				data.results[i] = data.vectors[i].NormalizedFast();
+			Consume(data.results);
+		},
+		[&]()
+		{
+			for (int32 i = 0; i < s_Count; ++i)
+				data.results[i] = data.vectors[i].Normalized();
+			Consume(data.results);
+		});
+}
+
+TEST(Speedup, LimitFast)
+{
+	Data data;
+	ExpectSpeedup(0.5,
+		[&]()
+		{
+			for (int32 i = 0; i < s_Count; ++i)
+				data.results[i] = data.vectors[i].LimitedFast(5.f);
+			Consume(data.results);
+		},
+		[&]()
+		{
+			for (int32 i = 0; i < s_Count; ++i)
+				data.results[i] = data.vectors[i].Limited(5.f);
+			Consume(data.results);
+		});
+}
+
+template<math::Precision Level>
+static void ExpectSinCosSpeedup(const double minimum)
+{
+#if defined(MATH_SIMD_SCALAR)
+	GTEST_SKIP() << "the span versions are only faster with simd";
+#endif
+	Data data;
+	ExpectSpeedup(minimum,
+		[&]()
+		{
+			math::SinCos<Level>(data.floats, data.results);
+			Consume(data.results);
+		},
+		[&]()
+		{
+			for (int32 i = 0; i < s_Count; ++i)
+				data.results[i] = Vector2f(math::Cos(data.floats[i]), math::Sin(data.floats[i]));
+			Consume(data.results);
+		});
+}
+
+TEST(Speedup, SinCosLow)
+{
+	ExpectSinCosSpeedup<math::Precision::Low>(1.5);
+}
+
+TEST(Speedup, SinCosMedium)
+{
+	ExpectSinCosSpeedup<math::Precision::Medium>(1.5);
+}
+
+TEST(Speedup, SinCosFull)
+{
+	ExpectSinCosSpeedup<math::Precision::Full>(1.5);
+}
+
+TEST(Speedup, FloorToInt)
+{
+	Data data;
+	ExpectSpeedup(s_ConversionSpeedup,
+		[&]()
+		{
+			for (int32 i = 0; i < s_Count; ++i)
+				data.integers[i] = math::FloorToInt(data.floats[i]);
+			Consume(data.integers);
+		},
+		[&]()
+		{
+			for (int32 i = 0; i < s_Count; ++i)
+				data.integers[i] = math::Floor<int32>(data.floats[i]);
+			Consume(data.integers);
+		});
+}
+
+TEST(Speedup, FloorToIntSpan)
+{
+#if defined(MATH_SIMD_SCALAR)
+	GTEST_SKIP() << "the span versions are only faster with simd";
+#endif
+	Data data;
+	ExpectSpeedup(s_ConversionSpeedup,
+		[&]()
+		{
+			math::FloorToInt(data.floats, data.integers);
+			Consume(data.integers);
+		},
+		[&]()
+		{
+			for (int32 i = 0; i < s_Count; ++i)
+				data.integers[i] = math::Floor<int32>(data.floats[i]);
+			Consume(data.integers);
+		});
+}
+
+TEST(Speedup, CeilingToInt)
+{
+	Data data;
+	ExpectSpeedup(s_ConversionSpeedup,
+		[&]()
+		{
+			for (int32 i = 0; i < s_Count; ++i)
+				data.integers[i] = math::CeilingToInt(data.floats[i]);
+			Consume(data.integers);
+		},
+		[&]()
+		{
+			for (int32 i = 0; i < s_Count; ++i)
+				data.integers[i] = math::Ceiling<int32>(data.floats[i]);
+			Consume(data.integers);
+		});
+}
+
+TEST(Speedup, RoundToInt)
+{
+#if defined(MATH_SIMD_SCALAR)
+	GTEST_SKIP() << "without the hardware conversion RoundToInt also calls into libm";
+#endif
+	Data data;
+	ExpectSpeedup(s_ConversionSpeedup,
+		[&]()
+		{
+			for (int32 i = 0; i < s_Count; ++i)
+				data.integers[i] = math::RoundToInt(data.floats[i]);
+			Consume(data.integers);
+		},
+		[&]()
+		{
+			for (int32 i = 0; i < s_Count; ++i)
+				data.integers[i] = math::Round<int32>(data.floats[i]);
+			Consume(data.integers);
+		});
+}
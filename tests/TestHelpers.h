@@ -0,0 +1,63 @@
+#pragma once
+
+#include <Core/Math.h>
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <string>
+
+namespace test
+{
+	/// \brief Returns the number of floats between a and b, so 0 if they are the same float and 1 if they are neighbours.
+	/// Both must be finite, -0 and +0 are equal.
+	inline int64_t UlpDistance(const float a, const float b) noexcept
+	{
+		// mapping the bits to a signed integer that is ordered the same as the floats makes the distance a subtraction
+		const auto ordered = [](const float value)
+		{
+			const int32_t bits = std::bit_cast<int32_t>(value);
+			return static_cast<int64_t>(bits < 0 ? std::numeric_limits<int32_t>::min() - bits : bits);
+		};
+		const int64_t distance = ordered(a) - ordered(b);
+		return distance < 0 ? -distance : distance;
+	}
+
+	/// \brief Returns value with 3 significant digits, std::to_string drops the digits of small errors.
+	inline std::string ToString(const double value)
+	{
+		char buffer[32];
+		std::snprintf(buffer, sizeof(buffer), "%.3g", value);
+		return buffer;
+	}
+
+	/// \brief Calls function with every float from min up to and including max whose bits are a multiple
+	/// of stride apart, so a stride of 1 visits every float. Both must be positive and finite.
+	template<typename Function>
+	inline void Sweep(const float min, const float max, const uint32_t stride, Function&& function)
+	{
+		const uint32_t last = std::bit_cast<uint32_t>(max);
+		for (uint32_t bits = std::bit_cast<uint32_t>(min); bits <= last; bits += stride)
+			function(std::bit_cast<float>(bits));
+	}
+
+	/// \brief Returns the fastest time in seconds of several runs of function, taking the fastest
+	/// run filters out most of the noise from other processes.
+	template<typename Function>
+	inline double Time(Function&& function, const int32 runs = 7)
+	{
+		double best = std::numeric_limits<double>::max();
+		for (int32 i = 0; i < runs; ++i)
+		{
+			const auto start = std::chrono::steady_clock::now();
+			function();
+			const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+			best = std::min(best, elapsed.count());
+		}
+		return best;
+	}
+}